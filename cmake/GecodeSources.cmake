@@ -58,6 +58,7 @@ set(GECODE_INT_SOURCES
   gecode/int/bin-packing/conflict-graph.cpp
   gecode/int/bin-packing/propagate.cpp
   gecode/int/bool.cpp
+  gecode/int/bool/clause-db.cpp
   gecode/int/bool/eqv.cpp
   gecode/int/branch.cpp
   gecode/int/branch/action.cpp
@@ -77,13 +78,18 @@ set(GECODE_INT_SOURCES
   gecode/int/distinct/eqite.cpp
   gecode/int/dom.cpp
   gecode/int/element.cpp
+  gecode/int/element/int-index.cpp
   gecode/int/element/pair.cpp
   gecode/int/exception.cpp
   gecode/int/exec.cpp
   gecode/int/exec/when.cpp
+  gecode/int/extensional-mdd.cpp
   gecode/int/extensional-regular.cpp
   gecode/int/extensional-tuple-set.cpp
+  gecode/int/extensional/bit-set.cpp
   gecode/int/extensional/dfa.cpp
+  gecode/int/extensional/mdd.cpp
+  gecode/int/extensional/serialize.cpp
   gecode/int/extensional/tuple-set.cpp
   gecode/int/gcc.cpp
   gecode/int/int-set.cpp
@@ -240,6 +246,7 @@ set(GECODE_FLATZINC_SOURCES
   gecode/flatzinc/branch.cpp
   gecode/flatzinc/flatzinc.cpp
   gecode/flatzinc/lexer.yy.cpp
+  gecode/flatzinc/model-cache.cpp
   gecode/flatzinc/parser.tab.cpp
   gecode/flatzinc/registry.cpp
 )
@@ -290,6 +297,8 @@ set(GECODE_TEST_SOURCES
   test/flatzinc/empty_domain_2.cpp
   test/flatzinc/eq20.cpp
   test/flatzinc/factory_planning_instance.cpp
+  test/flatzinc/fzn_cache.cpp
+  test/flatzinc/fzn_stream.cpp
   test/flatzinc/golomb.cpp
   test/flatzinc/int_set_as_type1.cpp
   test/flatzinc/int_set_as_type2.cpp
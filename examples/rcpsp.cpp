@@ -0,0 +1,308 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.dev
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/driver.hh>
+#include <gecode/int.hh>
+#include <gecode/minimodel.hh>
+
+using namespace Gecode;
+
+namespace {
+  /**
+   * \brief Specification of a resource-constrained project scheduling instance
+   *
+   * The specification starts with the number of jobs, the number of
+   * resources, and the capacity of each resource. Then, for each job,
+   * its duration, its demand for each resource, its number of
+   * successors, and its successors follow (as in the PSPLIB format,
+   * but without the dummy source and sink jobs).
+   */
+  class RCPSPSpec {
+  protected:
+    /// Raw specification
+    const int* s;
+    /// Offset of the job data for each job
+    int* o;
+  public:
+    /// Constructor
+    RCPSPSpec(const int* s0) : s(s0), o(new int[s[0]]) {
+      int k = 2 + s[1];
+      for (int j=0; j<jobs(); j++) {
+        o[j] = k;
+        k += 2 + resources() + s[k + 1 + resources()];
+      }
+    }
+    /// Destructor
+    ~RCPSPSpec(void) {
+      delete [] o;
+    }
+    /// Return number of jobs
+    int jobs(void) const {
+      return s[0];
+    }
+    /// Return number of resources
+    int resources(void) const {
+      return s[1];
+    }
+    /// Return capacity of resource \a r
+    int capacity(int r) const {
+      return s[2+r];
+    }
+    /// Return duration of job \a j
+    int duration(int j) const {
+      return s[o[j]];
+    }
+    /// Return demand of job \a j for resource \a r
+    int demand(int j, int r) const {
+      return s[o[j]+1+r];
+    }
+    /// Return number of successors of job \a j
+    int successors(int j) const {
+      return s[o[j]+1+resources()];
+    }
+    /// Return \a i-th successor of job \a j
+    int successor(int j, int i) const {
+      return s[o[j]+2+resources()+i];
+    }
+  };
+
+  extern const int* specs[];
+  extern const unsigned int n_specs;
+}
+
+/**
+ * \brief %Example: resource-constrained project scheduling
+ *
+ * Schedule jobs with precedences on several cumulative resources such
+ * that the makespan is minimal. The instances follow the structure of
+ * the PSPLIB single-mode instances.
+ *
+ * The example is useful for comparing the propagation strength of
+ * the cumulative constraint: the option \c -ipl selects the propagation
+ * level. For example, \c -ipl \c basic,advanced uses time-tabling and
+ * edge-finding, \c -ipl \c bnd,basic,advanced adds time-table
+ * edge-finding, and \c -ipl \c dom,basic,advanced adds checking by
+ * energetic reasoning.
+ *
+ * \ingroup Example
+ *
+ */
+class RCPSP : public IntMinimizeScript {
+protected:
+  /// Start times
+  IntVarArray s;
+  /// Makespan
+  IntVar makespan;
+public:
+  /// The actual problem
+  RCPSP(const SizeOptions& opt)
+    : IntMinimizeScript(opt) {
+    RCPSPSpec spec(specs[opt.size()]);
+    int n = spec.jobs();
+
+    // Horizon is the sum of all durations
+    int h = 0;
+    IntArgs p(n);
+    for (int j=0; j<n; j++)
+      h += p[j] = spec.duration(j);
+
+    s = IntVarArray(*this, n, 0, h);
+    makespan = IntVar(*this, 0, h);
+
+    // Precedences between jobs
+    for (int j=0; j<n; j++)
+      for (int i=0; i<spec.successors(j); i++)
+        rel(*this, s[j] + p[j] <= s[spec.successor(j,i)]);
+
+    // The makespan is greater than the end time of each job
+    for (int j=0; j<n; j++)
+      rel(*this, s[j] + p[j] <= makespan);
+
+    // Resource constraints
+    for (int r=0; r<spec.resources(); r++) {
+      IntArgs u(n);
+      for (int j=0; j<n; j++)
+        u[j] = spec.demand(j,r);
+      cumulative(*this, spec.capacity(r), s, p, u, opt.ipl());
+    }
+
+    branch(*this, s, INT_VAR_MIN_MIN(), INT_VAL_MIN());
+    assign(*this, makespan, INT_ASSIGN_MIN());
+  }
+
+  /// Constructor for cloning \a r
+  RCPSP(RCPSP& r) : IntMinimizeScript(r) {
+    s.update(*this, r.s);
+    makespan.update(*this, r.makespan);
+  }
+
+  /// Perform copying during cloning
+  virtual Space*
+  copy(void) {
+    return new RCPSP(*this);
+  }
+
+  /// Minimize the makespan
+  virtual IntVar
+  cost(void) const {
+    return makespan;
+  }
+
+  /// Print solution
+  virtual void
+  print(std::ostream& os) const {
+    os << "\tStart times: " << s << std::endl
+       << "\tMakespan: " << makespan << std::endl;
+  }
+
+};
+
+/** \brief Main-function
+ *  \relates RCPSP
+ */
+int
+main(int argc, char* argv[]) {
+  SizeOptions opt("RCPSP");
+  opt.ipl(IPL_BASIC_ADVANCED);
+  opt.size(0);
+  opt.solutions(0);
+  opt.parse(argc,argv);
+  if (opt.size() >= n_specs) {
+    std::cerr << "Error: size must be between 0 and "
+              << n_specs-1 << std::endl;
+    return 1;
+  }
+  IntMinimizeScript::run<RCPSP,BAB,SizeOptions>(opt);
+  return 0;
+}
+
+namespace {
+
+  /** \name Resource-constrained project scheduling specifications
+   *
+   * \relates RCPSP
+   */
+  //@{
+
+  /// Instance with 12 jobs
+  const int i0[] = {
+    // Number of jobs, number of resources, and capacities
+    12, 4, 9, 12, 12, 9,
+    // Duration, demands, number of successors, successors
+    6, 2, 0, 8, 0, 2, 5, 9,
+    4, 0, 0, 0, 6, 3, 4, 8, 9,
+    4, 0, 0, 0, 2, 3, 4, 5, 9,
+    10, 0, 0, 8, 0, 1, 8,
+    8, 0, 5, 0, 6, 1, 7,
+    2, 0, 5, 0, 0, 0,
+    5, 0, 8, 6, 0, 1, 11,
+    6, 0, 7, 0, 2, 1, 9,
+    6, 0, 7, 0, 0, 2, 10, 11,
+    2, 0, 0, 0, 5, 0,
+    6, 0, 0, 0, 3, 0,
+    5, 6, 0, 0, 2, 0,
+  };
+
+  /// Instance with 20 jobs
+  const int i1[] = {
+    // Number of jobs, number of resources, and capacities
+    20, 4, 11, 14, 12, 14,
+    // Duration, demands, number of successors, successors
+    8, 7, 9, 0, 0, 3, 4, 6, 15,
+    5, 6, 0, 0, 0, 3, 3, 14, 16,
+    10, 6, 0, 0, 0, 1, 4,
+    1, 0, 2, 0, 0, 2, 11, 14,
+    10, 0, 6, 0, 0, 2, 5, 15,
+    2, 0, 3, 6, 0, 3, 9, 10, 11,
+    9, 6, 0, 0, 3, 2, 8, 11,
+    7, 7, 0, 0, 0, 0,
+    4, 5, 0, 0, 0, 1, 15,
+    7, 0, 6, 0, 0, 1, 11,
+    5, 2, 4, 0, 0, 0,
+    2, 5, 0, 0, 0, 1, 14,
+    9, 0, 0, 0, 5, 2, 14, 19,
+    7, 5, 5, 0, 0, 0,
+    5, 3, 0, 0, 8, 2, 15, 19,
+    1, 0, 9, 0, 0, 1, 16,
+    10, 0, 3, 2, 0, 0,
+    4, 6, 0, 0, 0, 1, 19,
+    10, 0, 9, 8, 0, 1, 19,
+    7, 0, 6, 0, 0, 0,
+  };
+
+  /// Instance with 30 jobs
+  const int i2[] = {
+    // Number of jobs, number of resources, and capacities
+    30, 4, 12, 8, 10, 12,
+    // Duration, demands, number of successors, successors
+    10, 4, 0, 5, 0, 2, 1, 2,
+    2, 0, 2, 0, 5, 2, 19, 21,
+    7, 0, 0, 0, 3, 1, 16,
+    7, 0, 0, 0, 4, 2, 20, 28,
+    4, 0, 0, 4, 3, 2, 23, 27,
+    8, 4, 0, 3, 0, 2, 10, 28,
+    6, 0, 0, 0, 3, 2, 20, 27,
+    8, 0, 3, 0, 7, 2, 8, 20,
+    7, 0, 0, 0, 3, 2, 9, 10,
+    1, 7, 0, 0, 6, 1, 11,
+    9, 0, 3, 0, 0, 3, 18, 22, 25,
+    2, 0, 4, 0, 0, 1, 12,
+    3, 7, 0, 0, 0, 0,
+    1, 7, 3, 0, 0, 2, 19, 21,
+    4, 8, 0, 0, 0, 2, 19, 24,
+    6, 0, 0, 0, 8, 0,
+    6, 0, 0, 3, 4, 1, 27,
+    2, 5, 5, 0, 0, 0,
+    6, 4, 3, 0, 0, 2, 25, 26,
+    9, 0, 0, 3, 0, 1, 20,
+    8, 0, 5, 0, 0, 0,
+    9, 7, 2, 0, 0, 1, 22,
+    9, 4, 0, 2, 0, 0,
+    6, 3, 0, 0, 0, 2, 25, 28,
+    4, 0, 0, 4, 0, 1, 25,
+    3, 3, 5, 0, 0, 2, 27, 28,
+    9, 0, 4, 5, 0, 0,
+    2, 7, 0, 0, 0, 1, 28,
+    2, 0, 3, 0, 0, 0,
+    5, 0, 0, 2, 4, 0,
+  };
+
+  /// The instances
+  const int* specs[] = { &i0[0], &i1[0], &i2[0] };
+  /// The number of instances
+  const unsigned int n_specs = sizeof(specs) / sizeof(int*);
+
+  //@}
+}
+
+// STATISTICS: example-any
@@ -38,7 +38,6 @@
 
 #include <fstream>
 #include <string>
-#include <vector>
 
 using namespace Gecode;
 
@@ -106,6 +105,9 @@ public:
  * Benchmarks on satlib.org, for instance,
  * are in the dimacs CNF format.
  *
+ * With the option <code>-ipl advanced</code>, clauses are learned
+ * from failures.
+ *
  * \ingroup Example
  */
 class Sat : public Script {
@@ -116,7 +118,7 @@ public:
   /// The actual problem
   Sat(const SatOptions& opt)
     : Script(opt) {
-    parseDIMACS(opt.filename.c_str());
+    parseDIMACS(opt.filename.c_str(), opt.ipl());
     branch(*this, x, BOOL_VAR_AFC_MAX(), BOOL_VAL_MIN());
   }
 
@@ -137,8 +139,8 @@ public:
     os << "solution:\n" << x << std::endl;
   }
 
-  /// Post constraints according to DIMACS file \a f
-  void parseDIMACS(const char* f) {
+  /// Post constraints according to DIMACS file \a f with propagation level \a ipl
+  void parseDIMACS(const char* f, IntPropLevel ipl) {
     int variables = 0;
     int clauses = 0;
     std::ifstream dimacs(f);
@@ -150,6 +152,8 @@ public:
               << std::endl;
     std::string line;
     int c = 0;
+    // All clauses in DIMACS format
+    IntArgs lits;
     while (dimacs.good()) {
       std::getline(dimacs,line);
       // Comments (ignore them)
@@ -179,8 +183,6 @@ public:
       else if (variables > 0 &&
       ((line[0] >= '0' && line[0] <= '9') || line[0] == '-' || line[0] == ' ')) {
         c++;
-        std::vector<int> pos;
-        std::vector<int> neg;
         int i = 0;
         while (line[i] != 0) {
           if (line[i] == ' ') {
@@ -198,25 +200,12 @@ public:
             i++;
           }
           if (value != 0) {
-            if (positive)
-              pos.push_back(value-1);
-            else
-              neg.push_back(value-1);
+            lits << (positive ? value : -value);
             i++;
           }
         }
-
-        // Create positive BoolVarArgs
-        BoolVarArgs positives(pos.size());
-        for (int i=pos.size(); i--;)
-          positives[i] = x[pos[i]];
-
-        BoolVarArgs negatives(neg.size());
-        for (int i=neg.size(); i--;)
-          negatives[i] = x[neg[i]];
-
-        // Post propagators
-        clause(*this, BOT_OR, positives, negatives, 1);
+        // Terminate clause
+        lits << 0;
       }
       else {
         std::cerr << "format error in dimacs file" << std::endl;
@@ -225,6 +214,8 @@ public:
       }
     }
     dimacs.close();
+    // Post all clauses at once
+    clause(*this, x, lits, ipl);
     if (clauses != c) {
       std::cerr << "error: number of specified clauses seems to be wrong."
                 << std::endl;
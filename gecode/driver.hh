@@ -415,6 +415,7 @@ namespace Gecode {
     Driver::StringOption      _symmetry;    ///< General symmetry options
     Driver::StringOption      _propagation; ///< Propagation options
     Driver::IplOption         _ipl;         ///< Integer propagation level
+    Driver::StringOption      _schedule;    ///< Propagator scheduling policy
     Driver::StringOption      _branching;   ///< Branching options
     Driver::DoubleOption      _decay;       ///< Decay option
     Driver::UnsignedIntOption _seed;        ///< Seed option
@@ -429,6 +430,7 @@ namespace Gecode {
     Driver::DoubleOption      _threads;       ///< How many threads to use
     Driver::UnsignedIntOption _c_d;           ///< Copy recomputation distance
     Driver::UnsignedIntOption _a_d;           ///< Adaptive recomputation distance
+    Driver::BoolOption        _c_d_adaptive;  ///< Whether to adapt copy recomputation distance
     Driver::UnsignedIntOption _d_l;           ///< Discrepancy limit for LDS
     Driver::UnsignedLongLongIntOption
                               _node;          ///< Cutoff for number of nodes
@@ -496,6 +498,11 @@ namespace Gecode {
     /// Return integer propagation level
     IntPropLevel ipl(void) const;
 
+    /// Set default policy for scheduling propagators
+    void schedule(SchedulePolicy sp);
+    /// Return policy for scheduling propagators
+    SchedulePolicy schedule(void) const;
+
     /// Set default branching value
     void branching(int v);
     /// Add branching option value for value \a v, string \a o, and help \a h
@@ -548,6 +555,11 @@ namespace Gecode {
     /// Return adaptive recomputation distance
     unsigned int a_d(void) const;
 
+    /// Set default whether to adapt copy recomputation distance
+    void c_d_adaptive(bool b);
+    /// Return whether to adapt copy recomputation distance
+    bool c_d_adaptive(void) const;
+
     /// Set default discrepancy limit for LDS
     void d_l(unsigned int d);
     /// Return discrepancy limit for LDS
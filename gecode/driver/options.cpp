@@ -620,6 +620,7 @@ namespace Gecode {
       _model("model","model variants"),
       _symmetry("symmetry","symmetry variants"),
       _propagation("propagation","propagation variants"),
+      _schedule("schedule","scheduling of propagators of same cost",SP_FIFO),
       _branching("branching","branching variants"),
       _decay("decay","decay factor",1.0),
       _seed("seed","random number generator seed",1U),
@@ -631,6 +632,8 @@ namespace Gecode {
                Search::Config::threads),
       _c_d("c-d","recomputation commit distance",Search::Config::c_d),
       _a_d("a-d","recomputation adaptation distance",Search::Config::a_d),
+      _c_d_adaptive("c-d-adaptive","adapt recomputation commit distance online",
+                    Search::Config::c_d_adaptive),
       _d_l("d-l","discrepancy limit for LDS",Search::Config::d_l),
       _node("node","node cutoff (0 = none, solution mode)"),
       _fail("fail","failure cutoff (0 = none, solution mode)"),
@@ -673,6 +676,10 @@ namespace Gecode {
     _mode.add(SM_STAT,       "stat");
     _mode.add(SM_GIST,       "gist");
 
+    _schedule.add(SP_FIFO,"fifo","first-in first-out");
+    _schedule.add(SP_LIFO,"lifo","last-in first-out");
+    _schedule.add(SP_AFC,"afc","prefer propagators with high AFC");
+
     _restart.add(RM_NONE,"none");
     _restart.add(RM_CONSTANT,"constant");
     _restart.add(RM_LINEAR,"linear");
@@ -680,8 +687,9 @@ namespace Gecode {
     _restart.add(RM_GEOMETRIC,"geometric");
 
     add(_model); add(_symmetry); add(_propagation); add(_ipl);
-    add(_branching); add(_decay); add(_seed); add(_step);
+    add(_schedule); add(_branching); add(_decay); add(_seed); add(_step);
     add(_search); add(_solutions); add(_threads); add(_c_d); add(_a_d);
+    add(_c_d_adaptive);
     add(_d_l);
     add(_node); add(_fail); add(_time); add(_interrupt);
     add(_assets); add(_slice);
@@ -250,6 +250,15 @@ namespace Gecode {
     return _ipl.value();
   }
 
+  inline void
+  Options::schedule(SchedulePolicy sp) {
+    _schedule.value(sp);
+  }
+  inline SchedulePolicy
+  Options::schedule(void) const {
+    return static_cast<SchedulePolicy>(_schedule.value());
+  }
+
   inline void
   Options::branching(int v) {
     _branching.value(v);
@@ -344,6 +353,15 @@ namespace Gecode {
     return _a_d.value();
   }
 
+  inline void
+  Options::c_d_adaptive(bool b) {
+    _c_d_adaptive.value(b);
+  }
+  inline bool
+  Options::c_d_adaptive(void) const {
+    return _c_d_adaptive.value();
+  }
+
   inline void
   Options::d_l(unsigned int d) {
     _d_l.value(d);
@@ -349,6 +349,7 @@ namespace Gecode { namespace Driver {
             opt.inspect.compare(o.inspect.compare(i));
           if (s == nullptr)
             s = new Script(o);
+          s->schedule(o.schedule());
           (void) GistEngine<Engine<Script> >::explore(s, opt);
         }
         break;
@@ -377,11 +378,13 @@ namespace Gecode { namespace Driver {
           t.start();
           if (s == nullptr)
             s = new Script(o);
+          s->schedule(o.schedule());
           unsigned int n_p = PropagatorGroup::all.size(*s);
           unsigned int n_b = BrancherGroup::all.size(*s);
           so.threads = o.threads();
           so.c_d     = o.c_d();
           so.a_d     = o.a_d();
+          so.c_d_adaptive = o.c_d_adaptive();
           so.d_l     = o.d_l();
           so.assets  = o.assets();
           so.slice   = o.slice();
@@ -452,11 +455,18 @@ namespace Gecode { namespace Driver {
             l_out << endl
                   << "\tsolutions:    " << s_n << endl
                   << "\tpropagations: " << stat.propagate << endl
+#ifdef GECODE_PROPAGATION_STATISTICS
+                  << "\tno-op props:  " << stat.noop << endl
+#endif
                   << "\tnodes:        " << stat.node << endl
                   << "\tfailures:     " << stat.fail << endl
                   << "\trestarts:     " << stat.restart << endl
                   << "\tno-goods:     " << stat.nogood << endl
                   << "\tpeak depth:   " << stat.depth << endl
+                  << "\tclone memory: "
+                  << static_cast<unsigned long long int>
+                     ((stat.copied+1023) / 1024) << " KB" << endl
+                  << "\tclone actors: " << stat.actors << endl
 #ifdef GECODE_PEAKHEAP
                   << "\tpeak memory:  "
                   << static_cast<int>((heap.peak()+1023) / 1024) << " KB"
@@ -478,6 +488,7 @@ namespace Gecode { namespace Driver {
           t.start();
           if (s == nullptr)
             s = new Script(o);
+          s->schedule(o.schedule());
           unsigned int n_p = PropagatorGroup::all.size(*s);
           unsigned int n_b = BrancherGroup::all.size(*s);
 
@@ -487,6 +498,7 @@ namespace Gecode { namespace Driver {
           so.slice   = o.slice();
           so.c_d     = o.c_d();
           so.a_d     = o.a_d();
+          so.c_d_adaptive = o.c_d_adaptive();
           so.d_l     = o.d_l();
           so.stop    = CombinedStop::create(o.node(),o.fail(), o.time(), o.restart_limit(),
                                             o.interrupt());
@@ -514,11 +526,18 @@ namespace Gecode { namespace Driver {
             l_out << endl
                   << "\tsolutions:    " << s_n << endl
                   << "\tpropagations: " << stat.propagate << endl
+#ifdef GECODE_PROPAGATION_STATISTICS
+                  << "\tno-op props:  " << stat.noop << endl
+#endif
                   << "\tnodes:        " << stat.node << endl
                   << "\tfailures:     " << stat.fail << endl
                   << "\trestarts:     " << stat.restart << endl
                   << "\tno-goods:     " << stat.nogood << endl
                   << "\tpeak depth:   " << stat.depth << endl
+                  << "\tclone memory: "
+                  << static_cast<unsigned long long int>
+                     ((stat.copied+1023) / 1024) << " KB" << endl
+                  << "\tclone actors: " << stat.actors << endl
 #ifdef GECODE_PEAKHEAP
                   << "\tpeak memory:  "
                   << static_cast<int>((heap.peak()+1023) / 1024) << " KB"
@@ -542,6 +561,7 @@ namespace Gecode { namespace Driver {
             for (unsigned int k = o.iterations(); !stopped && k--; ) {
               unsigned long long int s_n = 0;
               Script* s1 = new Script(o);
+              s1->schedule(o.schedule());
               Search::Options sok;
               sok.clone   = false;
               sok.threads = o.threads();
@@ -549,6 +569,7 @@ namespace Gecode { namespace Driver {
               sok.slice   = o.slice();
               sok.c_d     = o.c_d();
               sok.a_d     = o.a_d();
+              sok.c_d_adaptive = o.c_d_adaptive();
               sok.d_l     = o.d_l();
               sok.stop    = CombinedStop::create(o.node(),o.fail(), o.time(), o.restart_limit(),
                                                  false);
@@ -234,6 +234,7 @@ namespace Gecode { namespace FlatZinc {
       Gecode::Driver::DoubleOption      _decay;       ///< Decay option
       Gecode::Driver::UnsignedIntOption _c_d;       ///< Copy recomputation distance
       Gecode::Driver::UnsignedIntOption _a_d;       ///< Adaptive recomputation distance
+      Gecode::Driver::BoolOption        _c_d_adaptive; ///< Whether to adapt copy recomputation distance
       Gecode::Driver::UnsignedLongLongIntOption _node;      ///< Cutoff for number of nodes
       Gecode::Driver::UnsignedLongLongIntOption _fail;      ///< Cutoff for number of failures
       Gecode::Driver::DoubleOption _time;      ///< Cutoff for time
@@ -247,6 +248,9 @@ namespace Gecode { namespace FlatZinc {
       Gecode::Driver::UnsignedIntOption _nogoods_limit; ///< Depth limit for extracting no-goods
       Gecode::Driver::BoolOption        _interrupt; ///< Whether to catch SIGINT
       Gecode::Driver::DoubleOption      _step;        ///< Step option
+      Gecode::Driver::UnsignedIntOption _blackbox_cache; ///< Memoized blackbox evaluations per backend
+      Gecode::Driver::BoolOption        _blackbox_binary; ///< Use binary framing for blackbox processes
+      Gecode::Driver::UnsignedIntOption _blackbox_async; ///< Concurrent asynchronous blackbox evaluations
       //@}
 
       /// \name Execution options
@@ -254,6 +258,9 @@ namespace Gecode { namespace FlatZinc {
       Gecode::Driver::StringOption      _mode;       ///< Script mode to run
       Gecode::Driver::BoolOption        _stat;       ///< Emit statistics
       Gecode::Driver::StringValueOption _output;     ///< Output file
+      Gecode::Driver::StringValueOption _fzn_cache;  ///< Compiled model file
+      Gecode::Driver::BoolOption        _fzn_stream; ///< Post constraints while parsing
+      Gecode::Driver::BoolOption        _clause_learning; ///< Learn clauses for bool_clause
 
 #ifdef GECODE_HAS_CPPROFILER
       Gecode::Driver::ProfilerOption    _profiler; ///< Use this execution id for the CP-profiler
@@ -272,6 +279,8 @@ namespace Gecode { namespace FlatZinc {
       _decay("decay","decay factor",0.99),
       _c_d("c-d","recomputation commit distance",Gecode::Search::Config::c_d),
       _a_d("a-d","recomputation adaption distance",Gecode::Search::Config::a_d),
+      _c_d_adaptive("c-d-adaptive","adapt recomputation commit distance online",
+                    Gecode::Search::Config::c_d_adaptive),
       _node("node","node cutoff (0 = none, solution mode)"),
       _fail("fail","failure cutoff (0 = none, solution mode)"),
       _time("time","time (in ms) cutoff (0 = none, solution mode)"),
@@ -287,9 +296,24 @@ namespace Gecode { namespace FlatZinc {
       _interrupt("interrupt","whether to catch Ctrl-C (true) or not (false)",
                  true),
       _step("step","step distance for float optimization",0.0),
+      _blackbox_cache("blackbox-cache",
+                      "memoized blackbox evaluations per backend (0 = none)",
+                      4096),
+      _blackbox_binary("blackbox-binary",
+                       "negotiate binary framing with blackbox processes",
+                       false),
+      _blackbox_async("blackbox-async",
+                      "concurrent asynchronous blackbox evaluations "
+                      "(0 = synchronous)",
+                      0),
       _mode("mode","how to execute script",Gecode::SM_SOLUTION),
       _stat("s","emit statistics"),
-      _output("o","file to send output to")
+      _output("o","file to send output to"),
+      _fzn_cache("fzn-cache","file caching the compiled model"),
+      _fzn_stream("fzn-stream","post constraints while parsing",false),
+      _clause_learning("clause-learning",
+                       "learn clauses from failures of bool_clause constraints",
+                       false)
 
 #ifdef GECODE_HAS_CPPROFILER
       ,
@@ -306,16 +330,19 @@ namespace Gecode { namespace FlatZinc {
       _restart.add(RM_GEOMETRIC,"geometric");
 
       add(_solutions); add(_threads); add(_c_d); add(_a_d);
+      add(_c_d_adaptive);
       add(_allSolutions);
       add(_free);
       add(_decay);
       add(_node); add(_fail); add(_time); add(_time_limit); add(_interrupt);
       add(_seed);
       add(_step);
+      add(_blackbox_cache); add(_blackbox_binary); add(_blackbox_async);
       add(_restart); add(_r_base); add(_r_scale); add(_r_limit);
       add(_nogoods); add(_nogoods_limit);
       add(_mode); add(_stat);
-      add(_output);
+      add(_output); add(_fzn_cache); add(_fzn_stream);
+      add(_clause_learning);
 #ifdef GECODE_HAS_CPPROFILER
       add(_profiler);
 #endif
@@ -346,12 +373,19 @@ namespace Gecode { namespace FlatZinc {
     bool free(void) const { return _free.value(); }
     unsigned int c_d(void) const { return _c_d.value(); }
     unsigned int a_d(void) const { return _a_d.value(); }
+    bool c_d_adaptive(void) const { return _c_d_adaptive.value(); }
     unsigned long long int node(void) const { return _node.value(); }
     unsigned long long int fail(void) const { return _fail.value(); }
     double time(void) const { return _time.value(); }
     int seed(void) const { return _seed.value(); }
     double step(void) const { return _step.value(); }
+    unsigned int blackbox_cache(void) const { return _blackbox_cache.value(); }
+    bool blackbox_binary(void) const { return _blackbox_binary.value(); }
+    unsigned int blackbox_async(void) const { return _blackbox_async.value(); }
     const char* output(void) const { return _output.value(); }
+    const char* fzn_cache(void) const { return _fzn_cache.value(); }
+    bool fzn_stream(void) const { return _fzn_stream.value(); }
+    bool clause_learning(void) const { return _clause_learning.value(); }
 
     Gecode::ScriptMode mode(void) const {
       return static_cast<Gecode::ScriptMode>(_mode.value());
@@ -460,6 +494,11 @@ namespace Gecode { namespace FlatZinc {
     /// Annotations on the solve item
     AST::Array* _solveAnnotations;
 
+    /// Time in milliseconds spent parsing the model
+    double _parseTime = 0.0;
+    /// Peak resident set size in bytes after parsing (0 if unknown)
+    size_t _parsePeakRSS = 0;
+
     /// Copy constructor
     FlatZincSpace(FlatZincSpace&);
   private:
@@ -581,6 +620,13 @@ namespace Gecode { namespace FlatZinc {
 #endif
     /// Whether the introduced variables still need to be copied
     bool needAuxVars;
+    /**
+     * \brief Propagation level for the \c bool_clause constraints
+     *
+     * All \c bool_clause constraints are posted as a single clause
+     * database. With \a IPL_ADVANCED it learns clauses from failures.
+     */
+    IntPropLevel clauseIpl;
     /// Construct empty space
     FlatZincSpace(Rnd& random = defrnd);
 
@@ -603,8 +649,12 @@ namespace Gecode { namespace FlatZinc {
     /// Create new float variable from specification
     void newFloatVar(FloatVarSpec* vs);
 
-    /// Post a constraint specified by \a ce
+    /// Post the constraints specified by \a ces
     void postConstraints(std::vector<ConExpr*>& ces);
+    /// Post the constraint specified by \a ce
+    void postConstraint(const ConExpr& ce);
+    /// Record that parsing the model took \a time milliseconds
+    void parsed(double time);
 
     /// Post the solve item
     void solve(AST::Array* annotation);
@@ -780,6 +830,46 @@ namespace Gecode { namespace FlatZinc {
                        Printer& p, std::ostream& err = std::cerr,
                        FlatZincSpace* fzs=nullptr, Rnd& rnd=defrnd);
 
+  /**
+   * \brief Parse FlatZinc file \a fileName into \a fzs, using the
+   * compiled model cached in \a cacheName, and return it.
+   *
+   * If \a cacheName holds a compiled model of the current contents of
+   * \a fileName, the model is posted from it without lexing or parsing
+   * \a fileName. Otherwise \a fileName is parsed and its compiled model
+   * is written to \a cacheName. No cache is used if \a cacheName is
+   * empty.
+   *
+   * Creates a new empty FlatZincSpace if \a fzs is nullptr.
+   */
+  GECODE_FLATZINC_EXPORT
+  FlatZincSpace* parse(const std::string& fileName,
+                       const std::string& cacheName,
+                       Printer& p, std::ostream& err = std::cerr,
+                       FlatZincSpace* fzs=nullptr, Rnd& rnd=defrnd);
+
+  /**
+   * \brief Parse FlatZinc file \a fileName into \a fzs as configured by
+   * \a opt, and return it.
+   *
+   * Uses the compiled model cache given by the \c -fzn-cache option.
+   * With the \c -fzn-stream option, constraints are posted as soon as
+   * they are parsed and their syntax trees are freed right away. Only
+   * constraints that need to see the whole model are kept until the
+   * solve item: domain constraints parsed before the first posted
+   * constraint and clauses. Equalities between variables parsed before
+   * the first posted constraint still alias the variables, later ones
+   * are posted as constraints. Streaming is not used while a compiled
+   * model is written to the cache.
+   *
+   * Creates a new empty FlatZincSpace if \a fzs is nullptr.
+   */
+  GECODE_FLATZINC_EXPORT
+  FlatZincSpace* parse(const std::string& fileName,
+                       const FlatZincOptions& opt,
+                       Printer& p, std::ostream& err = std::cerr,
+                       FlatZincSpace* fzs=nullptr, Rnd& rnd=defrnd);
+
   /**
    * \brief Parse FlatZinc from \a is into \a fzs and return it.
    *
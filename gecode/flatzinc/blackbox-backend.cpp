@@ -61,6 +61,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstdint>
+#include <cstring>
 #include <exception>
 #include <locale>
 #include <memory>
@@ -437,7 +438,7 @@ BlackBoxLibrary::run(BlackBoxCall& call) {
 
 BlackBoxExec::BlackBoxExec(const std::string &program0,
                            const std::vector<std::string> &args0)
-    : program(program0), args(args0) {}
+    : program(program0), args(args0), framing(false) {}
 
 BlackBoxExec::~BlackBoxExec(void) {
   Support::Lock lock(mutex);
@@ -603,11 +604,261 @@ decode_blackbox_response(const std::string& response, BlackBoxCall& call) {
   }
 }
 
+const char* const blackbox_binary_handshake = "gecode-blackbox-binary 1\n";
+
+namespace {
+
+void
+put_word(std::string& out, uint64_t w) {
+  for (int i = 0; i < 8; i++)
+    out.push_back(static_cast<char>((w >> (8 * i)) & 0xff));
+}
+
+uint64_t
+get_word(const char* p) {
+  uint64_t w = 0;
+  for (int i = 0; i < 8; i++)
+    w |= static_cast<uint64_t>(static_cast<unsigned char>(p[i])) << (8 * i);
+  return w;
+}
+
+uint64_t
+double_word(double d) {
+  uint64_t w;
+  std::memcpy(&w, &d, sizeof(w));
+  return w;
+}
+
+double
+word_double(uint64_t w) {
+  double d;
+  std::memcpy(&d, &w, sizeof(d));
+  return d;
+}
+
+} // namespace
+
+std::string
+encode_blackbox_frames(const BlackBoxCall* calls, size_t n) {
+  size_t words = 1;
+  for (size_t i = 0; i < n; i++)
+    words += 2 + calls[i].int_input.size() + calls[i].float_input.size();
+  std::string out;
+  out.reserve(8 * words);
+  put_word(out, n);
+  for (size_t i = 0; i < n; i++) {
+    put_word(out, calls[i].int_input.size());
+    for (int64_t v : calls[i].int_input)
+      put_word(out, static_cast<uint64_t>(v));
+    put_word(out, calls[i].float_input.size());
+    for (double v : calls[i].float_input)
+      put_word(out, double_word(v));
+  }
+  return out;
+}
+
+size_t
+blackbox_frames_size(const BlackBoxCall* calls, size_t n) {
+  size_t words = 0;
+  for (size_t i = 0; i < n; i++)
+    words += 2 + calls[i].int_output.size() + calls[i].float_output.size();
+  return 8 * words;
+}
+
+void
+decode_blackbox_frames(const std::string& response,
+                       BlackBoxCall* calls, size_t n) {
+  if (response.size() != blackbox_frames_size(calls, n)) {
+    throw Error("BlackBoxExec",
+                "Blackbox process binary response has the wrong size.");
+  }
+  const char* p = response.data();
+  for (size_t i = 0; i < n; i++) {
+    BlackBoxCall& call = calls[i];
+    if (get_word(p) != call.int_output.size()) {
+      throw Error("BlackBoxExec", "Blackbox process binary response does not "
+                                  "have " +
+                                  std::to_string(call.int_output.size()) +
+                                  " integer values.");
+    }
+    p += 8;
+    for (size_t j = 0; j < call.int_output.size(); j++, p += 8) {
+      int64_t value = static_cast<int64_t>(get_word(p));
+      check_int(value, "blackbox process output", j);
+      call.int_output[j] = value;
+    }
+    if (get_word(p) != call.float_output.size()) {
+      throw Error("BlackBoxExec", "Blackbox process binary response does not "
+                                  "have " +
+                                  std::to_string(call.float_output.size()) +
+                                  " floating point values.");
+    }
+    p += 8;
+    for (size_t j = 0; j < call.float_output.size(); j++, p += 8) {
+      double v = word_double(get_word(p));
+#ifdef GECODE_HAS_FLOAT_VARS
+      check_float(v, "blackbox process output", j);
+#endif
+      call.float_output[j] = v;
+    }
+  }
+}
+
+void
+BlackBoxExec::binary(bool b) {
+  framing.store(b);
+}
+
 void
 BlackBoxExec::run(BlackBoxCall& call) {
-  const std::string response =
-    session().exchange(encode_blackbox_request(call));
-  decode_blackbox_response(response, call);
+  run(&call, 1);
+}
+
+void
+BlackBoxExec::run(BlackBoxCall* calls, size_t n) {
+  if (n == 0) {
+    return;
+  }
+  BlackBoxProcessSession& s = session();
+  if (!s.binary && framing.load()) {
+    if (s.exchange(blackbox_binary_handshake) != blackbox_binary_handshake) {
+      throw Error("BlackBoxExec",
+                  "Blackbox process does not support binary framing.");
+    }
+    s.binary = true;
+  }
+  if (s.binary) {
+    const std::string response =
+      s.exchange(encode_blackbox_frames(calls, n),
+                 blackbox_frames_size(calls, n));
+    decode_blackbox_frames(response, calls, n);
+  } else {
+    for (size_t i = 0; i < n; i++) {
+      const std::string response =
+        s.exchange(encode_blackbox_request(calls[i]));
+      decode_blackbox_response(response, calls[i]);
+    }
+  }
+}
+
+BlackBoxCache::BlackBoxCache(const BlackBoxHandle& backend0,
+                             const BlackBoxCacheControlHandle& control0)
+  : backend(backend0), control(control0), hand(0) {}
+
+size_t
+BlackBoxCache::KeyHash::operator()(const Key& k) const {
+  size_t h = k.size();
+  for (uint64_t w : k)
+    cmb_hash(h, static_cast<size_t>(w ^ (w >> 32)));
+  return h;
+}
+
+void
+BlackBoxCache::insert(Key& k, const BlackBoxCall& call, size_t limit) {
+  // Drop entries beyond a limit that has been lowered meanwhile
+  while (entries.size() > limit) {
+    index.erase(entries.back().key);
+    entries.pop_back();
+    control()->evictions++;
+  }
+  if (hand >= entries.size())
+    hand = 0;
+  size_t i;
+  if (entries.size() < limit) {
+    i = entries.size();
+    entries.emplace_back();
+  } else {
+    // Give referenced entries a second chance
+    while (entries[hand].referenced) {
+      entries[hand].referenced = false;
+      hand = (hand + 1) % entries.size();
+    }
+    i = hand;
+    hand = (hand + 1) % entries.size();
+    index.erase(entries[i].key);
+    control()->evictions++;
+  }
+  Entry& e = entries[i];
+  e.int_output = call.int_output;
+  e.float_output = call.float_output;
+  e.referenced = false;
+  e.key.swap(k);
+  index.emplace(e.key, i);
+}
+
+BlackBoxCache::Key
+BlackBoxCache::key(const BlackBoxCall& call) {
+  Key k;
+  k.reserve(4 + call.int_input.size() + call.float_input.size());
+  k.push_back(call.int_input.size());
+  k.push_back(call.float_input.size());
+  k.push_back(call.int_output.size());
+  k.push_back(call.float_output.size());
+  for (int64_t v : call.int_input)
+    k.push_back(static_cast<uint64_t>(v));
+  for (double v : call.float_input) {
+    uint64_t bits;
+    std::memcpy(&bits, &v, sizeof(bits));
+    k.push_back(bits);
+  }
+  return k;
+}
+
+bool
+BlackBoxCache::lookup(const Key& k, BlackBoxCall& call) {
+  auto f = index.find(k);
+  if (f == index.end())
+    return false;
+  Entry& e = entries[f->second];
+  e.referenced = true;
+  call.int_output = e.int_output;
+  call.float_output = e.float_output;
+  return true;
+}
+
+void
+BlackBoxCache::run(BlackBoxCall& call) {
+  run(&call, 1);
+}
+
+void
+BlackBoxCache::run(BlackBoxCall* calls, size_t n) {
+  BlackBoxCacheControl& c = *control();
+  if (c.limit.load(std::memory_order_relaxed) == 0) {
+    backend()->run(calls, n);
+    return;
+  }
+  std::vector<Key> keys(n);
+  // Indices of the calls that must run the backend
+  std::vector<size_t> miss;
+  {
+    Support::Lock lock(mutex);
+    for (size_t i = 0; i < n; i++) {
+      keys[i] = key(calls[i]);
+      if (lookup(keys[i], calls[i]))
+        c.hits++;
+      else
+        miss.push_back(i);
+    }
+  }
+  if (miss.empty())
+    return;
+  c.misses += miss.size();
+  if (miss.size() == n) {
+    backend()->run(calls, n);
+  } else {
+    std::vector<BlackBoxCall> batch;
+    batch.reserve(miss.size());
+    for (size_t i : miss)
+      batch.push_back(calls[i]);
+    backend()->run(batch.data(), batch.size());
+  }
+  Support::Lock lock(mutex);
+  size_t limit = c.limit.load(std::memory_order_relaxed);
+  if (limit > 0)
+    for (size_t i : miss)
+      if (index.find(keys[i]) == index.end())
+        insert(keys[i], calls[i], limit);
 }
 
 } // namespace FlatZinc
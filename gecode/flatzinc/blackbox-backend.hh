@@ -37,9 +37,11 @@
 #ifndef GECODE_FLATZINC_BLACKBOX_BACKEND_HH
 #define GECODE_FLATZINC_BLACKBOX_BACKEND_HH
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <gecode/flatzinc.hh>
@@ -72,6 +74,11 @@ class BlackBoxBackend : public SharedHandle::Object {
 public:
   virtual ~BlackBoxBackend(void) {}
   virtual void run(BlackBoxCall& call) = 0;
+  /// Run the \a n calls in \a calls (one after the other by default)
+  virtual void run(BlackBoxCall* calls, size_t n) {
+    for (size_t i = 0; i < n; i++)
+      run(calls[i]);
+  }
   void run(const std::vector<int64_t>& int_input,
            const std::vector<double>& float_input,
            std::vector<int64_t>& int_output,
@@ -81,6 +88,119 @@ public:
   }
 };
 
+/// Shared handle to a blackbox backend.
+class BlackBoxHandle : public SharedHandle {
+public:
+  BlackBoxHandle(void) : SharedHandle() {}
+  explicit BlackBoxHandle(BlackBoxBackend* backend) : SharedHandle() {
+    object(backend);
+  }
+  explicit BlackBoxHandle(const SharedHandle& handle) : SharedHandle(handle) {}
+  BlackBoxHandle(const BlackBoxHandle& handle) : SharedHandle(handle) {}
+  BlackBoxHandle& operator=(const BlackBoxHandle& handle) {
+    return static_cast<BlackBoxHandle&>(SharedHandle::operator=(handle));
+  }
+  BlackBoxBackend* operator()(void) const {
+    return static_cast<BlackBoxBackend*>(object());
+  }
+};
+
+/// Counters of memoized blackbox evaluations.
+struct BlackBoxCacheStatistics {
+  /// Evaluations answered from a cache
+  unsigned long long int hits;
+  /// Evaluations that had to run the backend
+  unsigned long long int misses;
+  /// Evaluations dropped from a full cache
+  unsigned long long int evictions;
+};
+
+/// Size limit and counters shared by all memo caches of one model.
+class BlackBoxCacheControl : public SharedHandle::Object {
+public:
+  /// Maximal number of memoized evaluations per backend (0 disables caching)
+  std::atomic<size_t> limit;
+  std::atomic<unsigned long long int> hits;
+  std::atomic<unsigned long long int> misses;
+  std::atomic<unsigned long long int> evictions;
+  explicit BlackBoxCacheControl(size_t limit0)
+    : limit(limit0), hits(0), misses(0), evictions(0) {}
+  /// Return a snapshot of the counters
+  BlackBoxCacheStatistics statistics(void) const {
+    BlackBoxCacheStatistics s = {hits.load(), misses.load(), evictions.load()};
+    return s;
+  }
+};
+
+/// Shared handle to the memo cache control of one model.
+class BlackBoxCacheControlHandle : public SharedHandle {
+public:
+  BlackBoxCacheControlHandle(void) : SharedHandle() {}
+  explicit BlackBoxCacheControlHandle(BlackBoxCacheControl* control)
+    : SharedHandle() {
+    object(control);
+  }
+  BlackBoxCacheControlHandle(const BlackBoxCacheControlHandle& handle)
+    : SharedHandle(handle) {}
+  BlackBoxCacheControlHandle&
+  operator=(const BlackBoxCacheControlHandle& handle) {
+    return static_cast<BlackBoxCacheControlHandle&>(
+      SharedHandle::operator=(handle));
+  }
+  BlackBoxCacheControl* operator()(void) const {
+    return static_cast<BlackBoxCacheControl*>(object());
+  }
+};
+
+/**
+ * \brief Bounded memo cache in front of a deterministic backend.
+ *
+ * Evaluations are keyed by the input vectors (and the output sizes) and
+ * replaced with the CLOCK (second chance) policy once the limit of the
+ * shared control is reached. The backend runs outside the cache lock, so
+ * concurrent misses from several workers are evaluated in parallel.
+ */
+class GECODE_FLATZINC_EXPORT BlackBoxCache : public BlackBoxBackend {
+public:
+  using BlackBoxBackend::run;
+  BlackBoxCache(const BlackBoxHandle& backend,
+                const BlackBoxCacheControlHandle& control);
+  void run(BlackBoxCall& call) override;
+  /// Answer the hits from the cache and forward all misses as one batch
+  void run(BlackBoxCall* calls, size_t n) override;
+
+protected:
+  /// Key made from the sizes and the bit patterns of all inputs
+  typedef std::vector<uint64_t> Key;
+  /// Hash function for keys
+  class KeyHash {
+  public:
+    size_t operator()(const Key& k) const;
+  };
+  /// One memoized evaluation
+  class Entry {
+  public:
+    Key key;
+    std::vector<int64_t> int_output;
+    std::vector<double> float_output;
+    /// Whether the entry has been used since the clock hand last passed
+    bool referenced;
+  };
+  BlackBoxHandle backend;
+  BlackBoxCacheControlHandle control;
+  Support::Mutex mutex;
+  std::vector<Entry> entries;
+  std::unordered_map<Key, size_t, KeyHash> index;
+  /// Position of the clock hand in \a entries
+  size_t hand;
+  /// Return the key for \a call
+  static Key key(const BlackBoxCall& call);
+  /// Copy a memoized result for \a k into \a call (requires the lock)
+  bool lookup(const Key& k, BlackBoxCall& call);
+  /// Store the result of \a call under \a k (requires the lock)
+  void insert(Key& k, const BlackBoxCall& call, size_t limit);
+};
+
 /// Dynamic-library backend owned by one blackbox constraint.
 class GECODE_FLATZINC_EXPORT BlackBoxLibrary : public BlackBoxBackend {
 public:
@@ -108,7 +228,15 @@ protected:
 #endif
 };
 
-/// Persistent-process backend shared by equal executable configurations.
+/**
+ * \brief Persistent-process backend shared by equal executable configurations.
+ *
+ * By default every call is one line of text (see encode_blackbox_request).
+ * When binary framing is requested, each process session first sends the
+ * line blackbox_binary_handshake and requires the process to echo it.
+ * From then on a batch of calls is one frame (see encode_blackbox_frames)
+ * and the response is read as a block of known size.
+ */
 class GECODE_FLATZINC_EXPORT BlackBoxExec : public BlackBoxBackend {
 public:
   using BlackBoxBackend::run;
@@ -116,10 +244,16 @@ public:
                const std::vector<std::string>& args);
   ~BlackBoxExec();
   void run(BlackBoxCall& call) override;
+  /// Run a batch of calls in a single exchange if binary framing is used
+  void run(BlackBoxCall* calls, size_t n) override;
+  /// Request binary framing for sessions that have not negotiated it yet
+  void binary(bool b);
 
 protected:
   std::string program;
   std::vector<std::string> args;
+  /// Whether binary framing is requested
+  std::atomic<bool> framing;
   Support::Mutex mutex;
   std::vector<BlackBoxProcessSession*> sessions;
   BlackBoxProcessSession& session(void);
@@ -133,6 +267,32 @@ GECODE_FLATZINC_EXPORT
 void decode_blackbox_response(const std::string& response,
                               BlackBoxCall& call);
 
+/// Line that negotiates binary framing with the executable backend.
+GECODE_FLATZINC_EXPORT extern const char* const blackbox_binary_handshake;
+/**
+ * \brief Encode a batch of \a n requests as one binary frame.
+ *
+ * All numbers are 64 bits wide and little endian. The frame starts with
+ * the number of calls, followed per call by the number of integer
+ * inputs, the integer inputs, the number of float inputs, and the float
+ * inputs (IEEE-754 binary64).
+ */
+GECODE_FLATZINC_EXPORT
+std::string encode_blackbox_frames(const BlackBoxCall* calls, size_t n);
+/// Return the size in bytes of the binary response to \a n calls.
+GECODE_FLATZINC_EXPORT
+size_t blackbox_frames_size(const BlackBoxCall* calls, size_t n);
+/**
+ * \brief Decode and validate the binary response to \a n calls.
+ *
+ * The response has per call the number of integer outputs, the integer
+ * outputs, the number of float outputs, and the float outputs, encoded
+ * as for the request.
+ */
+GECODE_FLATZINC_EXPORT
+void decode_blackbox_frames(const std::string& response,
+                            BlackBoxCall* calls, size_t n);
+
 } // namespace FlatZinc
 } // namespace Gecode
 
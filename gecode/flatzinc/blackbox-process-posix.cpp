@@ -299,7 +299,7 @@ public:
 
   ~PosixProcessSession(void) { close(); }
 
-  std::string exchange(const std::string &out_buf) {
+  void send(const std::string &out_buf) {
     const char *p = out_buf.c_str();
     size_t remaining = out_buf.size();
     while (remaining > 0) {
@@ -319,7 +319,10 @@ public:
       p += n;
       remaining -= static_cast<size_t>(n);
     }
+  }
 
+  std::string exchange(const std::string &out_buf) {
+    send(out_buf);
     std::string in_buffer;
     while (true) {
       errno = 0;
@@ -351,6 +354,34 @@ public:
     return in_buffer;
   }
 
+  std::string exchange(const std::string &out_buf, size_t size) {
+    send(out_buf);
+    std::string in_buffer(size, '\0');
+    size_t received = 0;
+    while (received < size) {
+      errno = 0;
+      size_t n = fread(&in_buffer[received], 1, size - received, file_receive);
+      received += n;
+      if (received == size) {
+        break;
+      }
+      if (feof(file_receive)) {
+        throw Error("BlackBoxExec",
+                    "Blackbox process provided an incomplete response");
+      }
+      int err = errno;
+      if (err == EINTR) {
+        clearerr(file_receive);
+        continue;
+      }
+      throw Error("BlackBoxExec",
+                  std::string("Reading blackbox process output from pipe "
+                              "failed with errno ") +
+                      std::to_string(err));
+    }
+    return in_buffer;
+  }
+
   void close(void) {
     close_posix();
   }
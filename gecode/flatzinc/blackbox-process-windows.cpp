@@ -185,7 +185,7 @@ public:
 
   ~WindowsProcessSession(void) { close(); }
 
-  std::string exchange(const std::string &out_buf) {
+  void send(const std::string &out_buf) {
     size_t written = 0;
     while (written < out_buf.size()) {
       DWORD count = 0;
@@ -200,7 +200,10 @@ public:
       }
       written += count;
     }
+  }
 
+  std::string exchange(const std::string &out_buf) {
+    send(out_buf);
     char c[2] = {0, 0};
     std::ostringstream oss;
     size_t response_size = 0;
@@ -229,6 +232,32 @@ public:
     return oss.str();
   }
 
+  std::string exchange(const std::string &out_buf, size_t size) {
+    send(out_buf);
+    std::string in_buffer(size, '\0');
+    size_t received = 0;
+    while (received < size) {
+      DWORD count = 0;
+      DWORD remaining = static_cast<DWORD>(size - received);
+      BOOL success = ReadFile(pipe_receive, &in_buffer[received], remaining,
+                              &count, NULL);
+      if (!success) {
+        if (GetLastError() == ERROR_BROKEN_PIPE) {
+          throw Error("BlackBoxExec",
+                      "Blackbox process provided an incomplete response");
+        }
+        throw Error(
+            "BlackBoxExec",
+            "Failed to read blackbox process output from pipe");
+      } else if (count == 0) {
+        throw Error("BlackBoxExec",
+                    "Blackbox process provided an incomplete response");
+      }
+      received += count;
+    }
+    return in_buffer;
+  }
+
   void close(void) {
     close_windows();
   }
@@ -12,6 +12,9 @@
 #ifndef GECODE_FLATZINC_BLACKBOX_PROCESS_HH
 #define GECODE_FLATZINC_BLACKBOX_PROCESS_HH
 
+#include <gecode/support.hh>
+
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -28,11 +31,14 @@ protected:
   std::thread::id owner;
 #endif
   BlackBoxProcessSession(void)
+    :
 #ifdef GECODE_HAS_THREADS
-    : owner(std::this_thread::get_id())
+      owner(std::this_thread::get_id()),
 #endif
-  {}
+      binary(false) {}
 public:
+  /// Whether binary framing has been negotiated for this session
+  bool binary;
   virtual ~BlackBoxProcessSession(void) {}
   bool owned_by_current_thread(void) const {
 #ifdef GECODE_HAS_THREADS
@@ -41,7 +47,10 @@ public:
     return true;
 #endif
   }
+  /// Send \a request and return the response line
   virtual std::string exchange(const std::string& request) = 0;
+  /// Send \a request and return a response of exactly \a size bytes
+  virtual std::string exchange(const std::string& request, size_t size) = 0;
 };
 
 /// Create the process implementation selected for the target platform.
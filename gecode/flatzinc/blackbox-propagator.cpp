@@ -46,25 +46,42 @@
 namespace Gecode {
 namespace FlatZinc {
 
-namespace {
+/// An evaluation that runs in the background, shared with its propagator
+class BlackBoxJob : public SharedHandle::Object {
+public:
+  std::vector<int64_t> int_input;
+  std::vector<double> float_input;
+  std::vector<int64_t> int_output;
+  std::vector<double> float_output;
+  /// The exception raised by the evaluation, if any
+  std::exception_ptr exception;
+  /// Signalled when the outputs are available
+  Support::Event done;
+  BlackBoxJob(std::vector<int64_t>& int_in, std::vector<double>& float_in,
+              size_t n_int_out, size_t n_float_out)
+    : int_output(n_int_out), float_output(n_float_out) {
+    int_input.swap(int_in);
+    float_input.swap(float_in);
+  }
+};
 
-class BlackBoxHandle : public SharedHandle {
+class BlackBoxJobHandle : public SharedHandle {
 public:
-  explicit BlackBoxHandle(BlackBoxBackend* backend) : SharedHandle() {
-    object(backend);
+  BlackBoxJobHandle(void) : SharedHandle() {}
+  explicit BlackBoxJobHandle(BlackBoxJob* job) : SharedHandle() {
+    object(job);
   }
-  explicit BlackBoxHandle(const SharedHandle& handle) : SharedHandle(handle) {}
-  BlackBoxHandle(const BlackBoxHandle& handle) : SharedHandle(handle) {}
-  BlackBoxHandle& operator=(const BlackBoxHandle& handle) {
-    return static_cast<BlackBoxHandle&>(SharedHandle::operator=(handle));
+  explicit BlackBoxJobHandle(const SharedHandle& handle)
+    : SharedHandle(handle) {}
+  BlackBoxJobHandle(const BlackBoxJobHandle& handle) : SharedHandle(handle) {}
+  BlackBoxJobHandle& operator=(const BlackBoxJobHandle& handle) {
+    return static_cast<BlackBoxJobHandle&>(SharedHandle::operator=(handle));
   }
-  BlackBoxBackend* operator()(void) const {
-    return static_cast<BlackBoxBackend*>(object());
+  BlackBoxJob* operator()(void) const {
+    return static_cast<BlackBoxJob*>(object());
   }
 };
 
-}
-
 class BlackBoxContext : public SharedHandle::Object {
 protected:
   class ExecEntry {
@@ -72,23 +89,72 @@ protected:
     std::string program;
     std::vector<std::string> args;
     BlackBoxHandle handle;
+    /// The process backend behind \a handle
+    BlackBoxExec* backend;
     ExecEntry(const std::string &program0, const std::vector<std::string> &args0,
-              const BlackBoxHandle &handle0)
-        : program(program0), args(args0), handle(handle0) {}
+              const BlackBoxHandle &handle0, BlackBoxExec* backend0)
+        : program(program0), args(args0), handle(handle0), backend(backend0) {}
   };
   mutable Support::Mutex mutex;
   std::vector<ExecEntry> exec;
   std::exception_ptr exception;
   std::atomic<bool> error_recorded;
+  /// Limit and counters of the memo caches in front of all backends
+  BlackBoxCacheControlHandle cache;
+  /// Whether executable backends use binary framing
+  bool binary;
+  /// Maximal number of evaluations running in the background
+  std::atomic<unsigned int> async_limit;
+  /// Number of evaluations currently running in the background
+  std::atomic<unsigned int> async_running;
+  /// Number of evaluations that ran in the background
+  std::atomic<unsigned long int> async_evaluations;
+  /// Runs one evaluation in a pooled thread
+  class Run : public Support::Runnable {
+  protected:
+    /// Keeps the context alive while the evaluation runs
+    BlackBoxContextHandle handle;
+    BlackBoxContext* context;
+    BlackBoxHandle backend;
+    BlackBoxJobHandle job;
+  public:
+    Run(const BlackBoxContextHandle& handle0, BlackBoxContext* context0,
+        const BlackBoxHandle& backend0, const BlackBoxJobHandle& job0)
+      : handle(handle0), context(context0), backend(backend0), job(job0) {}
+    void run(void) override;
+  };
 
 public:
-  BlackBoxContext(void) : error_recorded(false) {}
+  /// Default number of memoized evaluations per backend
+  static const size_t cache_limit = 4096;
+  BlackBoxContext(void)
+    : error_recorded(false),
+      cache(new BlackBoxCacheControl(cache_limit)), binary(false),
+      async_limit(0), async_running(0), async_evaluations(0) {}
   BlackBoxHandle backendForConstraint(const std::string& mode,
                                       const std::string& target,
                                       const std::vector<std::string>& args);
   void fail(std::exception_ptr e);
   bool failed(void) const;
   void rethrow(void) const;
+  void binaryFraming(bool b);
+  void cacheLimit(size_t n) {
+    cache()->limit.store(n);
+  }
+  BlackBoxCacheStatistics cacheStatistics(void) const {
+    return cache()->statistics();
+  }
+  void asyncLimit(unsigned int n) {
+    async_limit.store(n);
+  }
+  bool asynchronous(void) const {
+    return async_limit.load(std::memory_order_relaxed) > 0;
+  }
+  bool submit(const BlackBoxContextHandle& handle,
+              const BlackBoxHandle& backend, const BlackBoxJobHandle& job);
+  unsigned long int asyncEvaluations(void) const {
+    return async_evaluations.load();
+  }
 };
 
 void
@@ -106,6 +172,43 @@ BlackBoxContextHandle::backendForConstraint(
     ->backendForConstraint(mode, target, args);
 }
 
+void
+BlackBoxContextHandle::binaryFraming(bool b) const {
+  static_cast<BlackBoxContext*>(object())->binaryFraming(b);
+}
+
+void
+BlackBoxContextHandle::cacheLimit(size_t n) const {
+  static_cast<BlackBoxContext*>(object())->cacheLimit(n);
+}
+
+void
+BlackBoxContextHandle::cacheStatistics(BlackBoxCacheStatistics& s) const {
+  s = static_cast<BlackBoxContext*>(object())->cacheStatistics();
+}
+
+void
+BlackBoxContextHandle::asyncLimit(unsigned int n) const {
+  static_cast<BlackBoxContext*>(object())->asyncLimit(n);
+}
+
+bool
+BlackBoxContextHandle::asynchronous(void) const {
+  return static_cast<BlackBoxContext*>(object())->asynchronous();
+}
+
+bool
+BlackBoxContextHandle::submit(const SharedHandle& backend,
+                              const SharedHandle& job) const {
+  return static_cast<BlackBoxContext*>(object())
+    ->submit(*this, BlackBoxHandle(backend), BlackBoxJobHandle(job));
+}
+
+unsigned long int
+BlackBoxContextHandle::asyncEvaluations(void) const {
+  return static_cast<BlackBoxContext*>(object())->asyncEvaluations();
+}
+
 void
 BlackBoxContextHandle::fail(std::exception_ptr e) const {
   static_cast<BlackBoxContext*>(object())->fail(e);
@@ -135,16 +238,62 @@ BlackBoxContext::backendForConstraint(const std::string& mode,
         return e.handle;
       }
     }
-    BlackBoxHandle handle(new BlackBoxExec(target, args));
-    exec.push_back(ExecEntry(target, args, handle));
+    BlackBoxExec* backend = new BlackBoxExec(target, args);
+    backend->binary(binary);
+    BlackBoxHandle handle(new BlackBoxCache(BlackBoxHandle(backend), cache));
+    exec.push_back(ExecEntry(target, args, handle, backend));
     return handle;
   }
   if (mode == "dll") {
-    return BlackBoxHandle(new BlackBoxLibrary(target, args));
+    return BlackBoxHandle(
+      new BlackBoxCache(BlackBoxHandle(new BlackBoxLibrary(target, args)),
+                        cache));
   }
   throw Error("Blackbox", "Unknown blackbox protocol `" + mode + "'");
 }
 
+void
+BlackBoxContext::binaryFraming(bool b) {
+  Support::Lock lock(mutex);
+  binary = b;
+  for (ExecEntry& e : exec)
+    e.backend->binary(b);
+}
+
+void
+BlackBoxContext::Run::run(void) {
+  BlackBoxJob& j = *job();
+  try {
+    BlackBoxCall call = {j.int_input, j.float_input,
+                         j.int_output, j.float_output};
+    backend()->run(call);
+  } catch (...) {
+    j.exception = std::current_exception();
+  }
+  context->async_running--;
+  j.done.signal();
+}
+
+bool
+BlackBoxContext::submit(const BlackBoxContextHandle& handle,
+                        const BlackBoxHandle& backend,
+                        const BlackBoxJobHandle& job) {
+#ifdef GECODE_HAS_THREADS
+  // Claim a slot, evaluate synchronously when all slots are taken
+  unsigned int n = async_running.load();
+  do {
+    if (n >= async_limit.load())
+      return false;
+  } while (!async_running.compare_exchange_weak(n, n+1));
+  async_evaluations++;
+  Support::Thread::run(new Run(handle, this, backend, job));
+  return true;
+#else
+  (void) handle; (void) backend; (void) job;
+  return false;
+#endif
+}
+
 void
 BlackBoxContext::fail(std::exception_ptr e) {
   Support::Lock lock(mutex);
@@ -186,7 +335,11 @@ protected:
 #endif
   BlackBoxHandle backend;
   BlackBoxContextHandle context;
+  /// The evaluation running in the background, if any
+  BlackBoxJobHandle job;
 
+  /// Copy, a pending evaluation is never copied as it is collected
+  /// before the space reaches its fixpoint
   BlackBox(Space& home, BlackBox& p)
     : Propagator(home, p), backend(p.backend), context(p.context) {
     int_input.update(home, p.int_input);
@@ -219,6 +372,10 @@ public:
   }
 
   PropCost cost(const Space&, const ModEventDelta&) const override {
+    // Starting a background evaluation is cheap and should happen early,
+    // collecting it waits for the result and should happen last
+    if (!job && context.asynchronous())
+      return PropCost::unary(PropCost::LO);
     return PropCost::crazy(PropCost::HI, int_input.size()
 #ifdef GECODE_HAS_FLOAT_VARS
       + float_input.size()
@@ -241,11 +398,15 @@ public:
     home.ignore(*this, AP_DISPOSE);
     backend.~BlackBoxHandle();
     context.~BlackBoxContextHandle();
+    job.~BlackBoxJobHandle();
     (void) Propagator::dispose(home);
     return sizeof(*this);
   }
 
   ExecStatus propagate(Space& home, const ModEventDelta&) override;
+  /// Assign the outputs computed by an evaluation
+  ExecStatus assign(Space& home, const std::vector<int64_t>& int_out,
+                    const std::vector<double>& float_out);
 
   Propagator* copy(Space& home) override {
     return new (home) BlackBox(home, *this);
@@ -468,7 +629,34 @@ BlackBoxBounds::post(Home home, ViewArray<Int::IntView>& ivar,
   return ES_OK;
 }
 
+ExecStatus
+BlackBox::assign(Space& home, const std::vector<int64_t>& int_out,
+                 const std::vector<double>& float_out) {
+  for (size_t i = 0; i < int_out.size(); i++) {
+    GECODE_ME_CHECK(int_output[i].eq(home, static_cast<int>(int_out[i])));
+  }
+#ifdef GECODE_HAS_FLOAT_VARS
+  for (size_t i = 0; i < float_out.size(); i++) {
+    GECODE_ME_CHECK(float_output[i].eq(home, float_out[i]));
+  }
+#else
+  (void) float_out;
+#endif
+  return ES_OK;
+}
+
 ExecStatus BlackBox::propagate(Space &home, const ModEventDelta &) {
+  if (job) {
+    // Collect the evaluation started by the previous execution
+    BlackBoxJob& j = *job();
+    j.done.wait();
+    if (j.exception != nullptr) {
+      context.fail(j.exception);
+      return ES_FAILED;
+    }
+    GECODE_ES_CHECK(assign(home, j.int_output, j.float_output));
+    return home.ES_SUBSUMED(*this);
+  }
   if (int_input.assigned()
 #ifdef GECODE_HAS_FLOAT_VARS
       && float_input.assigned()
@@ -489,6 +677,20 @@ ExecStatus BlackBox::propagate(Space &home, const ModEventDelta &) {
     }
 #endif
 
+    if (context.asynchronous()) {
+      // Evaluate in the background and collect the outputs after all
+      // cheaper propagators have run
+      BlackBoxJobHandle j(new BlackBoxJob(int_in, float_in,
+                                          int_out.size(), float_out.size()));
+      if (context.submit(backend, j)) {
+        job = j;
+        return home.ES_NOFIX_PARTIAL(*this,
+                                     Int::IntView::med(Int::ME_INT_VAL));
+      }
+      int_in.swap(j()->int_input);
+      float_in.swap(j()->float_input);
+    }
+
     try {
       BlackBoxCall call = {int_in, float_in, int_out, float_out};
       backend()->run(call);
@@ -497,15 +699,7 @@ ExecStatus BlackBox::propagate(Space &home, const ModEventDelta &) {
       return ES_FAILED;
     }
 
-    for (size_t i = 0; i < int_out.size(); i++) {
-      GECODE_ME_CHECK(int_output[i].eq(home, static_cast<int>(int_out[i])));
-    }
-#ifdef GECODE_HAS_FLOAT_VARS
-    for (size_t i = 0; i < float_out.size(); i++) {
-      GECODE_ME_CHECK(float_output[i].eq(home, float_out[i]));
-    }
-#endif
-
+    GECODE_ES_CHECK(assign(home, int_out, float_out));
     return home.ES_SUBSUMED(*this);
   }
   return ES_FIX;
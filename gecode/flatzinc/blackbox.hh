@@ -51,6 +51,7 @@ namespace Gecode {
 namespace FlatZinc {
 
 class BlackBoxContext;
+struct BlackBoxCacheStatistics;
 
 /// Model-local context shared by blackbox propagators and search support.
 class BlackBoxContextHandle : public SharedHandle {
@@ -69,6 +70,22 @@ public:
   SharedHandle backendForConstraint(const std::string& mode,
                                     const std::string& target,
                                     const std::vector<std::string>& args) const;
+  /// Request binary framing for all executable backends.
+  void binaryFraming(bool b) const;
+  /// Set the maximal number of memoized evaluations per backend.
+  void cacheLimit(size_t n) const;
+  /// Return the counters of the memo caches of all backends.
+  void cacheStatistics(BlackBoxCacheStatistics& s) const;
+  /// Set the number of evaluations that may run concurrently in the
+  /// background (0 evaluates synchronously).
+  void asyncLimit(unsigned int n) const;
+  /// Whether evaluations may run in the background.
+  bool asynchronous(void) const;
+  /// Start evaluating the opaque \a job on the opaque \a backend in the
+  /// background, return false if no evaluation slot is available.
+  bool submit(const SharedHandle& backend, const SharedHandle& job) const;
+  /// Return the number of evaluations that ran in the background.
+  unsigned long int asyncEvaluations(void) const;
   /// Record the first exception raised during blackbox propagation.
   void fail(std::exception_ptr e) const;
   /// Whether blackbox propagation raised an exception.
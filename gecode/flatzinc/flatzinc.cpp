@@ -39,6 +39,7 @@
 
 #include <gecode/flatzinc.hh>
 #include <gecode/flatzinc/blackbox.hh>
+#include <gecode/flatzinc/blackbox-backend.hh>
 #include <gecode/flatzinc/registry.hh>
 #include <gecode/flatzinc/plugin.hh>
 #include <gecode/flatzinc/branch.hh>
@@ -52,6 +53,19 @@
 #include <memory>
 #include <unordered_set>
 
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX 1 // Ensure the words min/max remain available
+#endif
+#ifndef PSAPI_VERSION
+#define PSAPI_VERSION 2 // Take the process memory functions from kernel32
+#endif
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
 
 namespace std {
 
@@ -787,7 +801,7 @@ namespace Gecode { namespace FlatZinc {
 #ifdef GECODE_HAS_FLOAT_VARS
       step(f.step),
 #endif
-      needAuxVars(f.needAuxVars) {
+      needAuxVars(f.needAuxVars), clauseIpl(f.clauseIpl) {
       _optVar = f._optVar;
       _optVarIsInt = f._optVarIsInt;
       _method = f._method;
@@ -865,7 +879,7 @@ namespace Gecode { namespace FlatZinc {
     intVarCount(-1), boolVarCount(-1), floatVarCount(-1), setVarCount(-1),
     _optVar(-1), _optVarIsInt(true), _lns(0), _lnsInitialSolution(0),
     _random(random),
-    _solveAnnotations(nullptr), needAuxVars(true) {
+    _solveAnnotations(nullptr), needAuxVars(true), clauseIpl(IPL_DEF) {
     branchInfo.init();
   }
 
@@ -1023,15 +1037,88 @@ namespace Gecode { namespace FlatZinc {
     };
   }
 
+  namespace {
+    /// Return the peak resident set size of the process in bytes (0 if unknown)
+    size_t
+    peakResidentSetSize(void) {
+#if defined(_WIN32)
+      PROCESS_MEMORY_COUNTERS pmc;
+      if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+        return static_cast<size_t>(pmc.PeakWorkingSetSize);
+      return 0;
+#elif defined(__unix__) || defined(__APPLE__)
+      struct rusage ru;
+      if (getrusage(RUSAGE_SELF, &ru) != 0)
+        return 0;
+#if defined(__APPLE__)
+      // Reported in bytes
+      return static_cast<size_t>(ru.ru_maxrss);
+#else
+      // Reported in kilobytes
+      return static_cast<size_t>(ru.ru_maxrss) * 1024;
+#endif
+#else
+      return 0;
+#endif
+    }
+  }
+
+  void
+  FlatZincSpace::parsed(double time) {
+    _parseTime = time;
+    _parsePeakRSS = peakResidentSetSize();
+  }
+
+  void
+  FlatZincSpace::postConstraint(const ConExpr& ce) {
+    try {
+      registry().post(*this, ce);
+    } catch (Gecode::Exception& e) {
+        throw FlatZinc::Error("Gecode", e.what(), ce.ann);
+    } catch (AST::TypeError& e) {
+        throw FlatZinc::Error("Type error", e.what(), ce.ann);
+    }
+  }
+
   void
   FlatZincSpace::postConstraints(std::vector<ConExpr*>& ces) {
     ConExprOrder ceo;
     std::sort(ces.begin(), ces.end(), ceo);
 
+    // Clauses are collected and posted as a single clause database
+    BoolVarArgs cx;
+    IntArgs cl;
+    std::vector<int> cv(bv.size(),0);
+
     for (unsigned int i=0; i<ces.size(); i++) {
       const ConExpr& ce = *ces[i];
       try {
-        registry().post(*this, ce);
+        if (ce.id == "bool_clause") {
+          for (int j=0; j<2; j++) {
+            AST::Array* a = ce[j]->getArray();
+            for (unsigned int k=0; k<a->a.size(); k++) {
+              int b;
+              if (a->a[k]->isBool()) {
+                // Use the constant for both polarities
+                BoolVar c(*this, a->a[k]->getBool(), a->a[k]->getBool());
+                cx << c;
+                cl << ((j == 0) ? cx.size() : -cx.size());
+                continue;
+              } else if (a->a[k]->isIntVar()) {
+                b = aliasBool2Int(a->a[k]->getIntVar());
+              } else {
+                b = a->a[k]->getBoolVar();
+              }
+              if (cv[b] == 0) {
+                cx << bv[b]; cv[b] = cx.size();
+              }
+              cl << ((j == 0) ? cv[b] : -cv[b]);
+            }
+          }
+          cl << 0;
+        } else {
+          postConstraint(ce);
+        }
       } catch (Gecode::Exception& e) {
           throw FlatZinc::Error("Gecode", e.what(), ce.ann);
       } catch (AST::TypeError& e) {
@@ -1040,6 +1127,13 @@ namespace Gecode { namespace FlatZinc {
       delete ces[i];
       ces[i] = nullptr;
     }
+    if (cl.size() > 0) {
+      try {
+        clause(*this, cx, cl, clauseIpl);
+      } catch (Gecode::Exception& e) {
+          throw FlatZinc::Error("Gecode", e.what());
+      }
+    }
   }
 
   void flattenAnnotations(AST::Array* ann, std::vector<AST::Node*>& out) {
@@ -1903,6 +1997,7 @@ namespace Gecode { namespace FlatZinc {
     std::unique_ptr<SearchTracer> tracer;
     o.c_d = opt.c_d();
     o.a_d = opt.a_d();
+    o.c_d_adaptive = opt.c_d_adaptive();
 
 #ifdef GECODE_HAS_CPPROFILER
     if (opt.profiler_port()) {
@@ -1984,17 +2079,37 @@ namespace Gecode { namespace FlatZinc {
           << std::endl;
       out << "%%%mzn-stat: solveTime=" << solveTime
           << std::endl;
+      out << "%%%mzn-stat: parseTime=" << (_parseTime / 1000.0)
+          << std::endl;
+      if (size_t rss = peakResidentSetSize())
+        out << "%%%mzn-stat: parsePeakRSS=" << _parsePeakRSS << std::endl
+            << "%%%mzn-stat: peakRSS=" << rss << std::endl;
       out << "%%%mzn-stat: solutions="
           << std::abs(noOfSolutions - findSol) << std::endl
           << "%%%mzn-stat: variables="
           << (intVarCount + boolVarCount + setVarCount) << std::endl
           << "%%%mzn-stat: propagators=" << n_p << std::endl
           << "%%%mzn-stat: propagations=" << sstat.propagate+stat.propagate << std::endl
+#ifdef GECODE_PROPAGATION_STATISTICS
+          << "%%%mzn-stat: noopPropagations=" << sstat.noop+stat.noop << std::endl
+#endif
           << "%%%mzn-stat: nodes=" << stat.node << std::endl
           << "%%%mzn-stat: failures=" << stat.fail << std::endl
           << "%%%mzn-stat: restarts=" << stat.restart << std::endl
           << "%%%mzn-stat: peakDepth=" << stat.depth << std::endl
-          << "%%%mzn-stat-end" << std::endl
+          << "%%%mzn-stat: cloneMemory=" << stat.copied << std::endl
+          << "%%%mzn-stat: cloneActors=" << stat.actors << std::endl;
+      if (black_box_context) {
+        BlackBoxCacheStatistics bs;
+        black_box_context.cacheStatistics(bs);
+        out << "%%%mzn-stat: blackboxCacheHits=" << bs.hits << std::endl
+            << "%%%mzn-stat: blackboxCacheMisses=" << bs.misses << std::endl
+            << "%%%mzn-stat: blackboxCacheEvictions=" << bs.evictions
+            << std::endl
+            << "%%%mzn-stat: blackboxAsyncEvaluations="
+            << black_box_context.asyncEvaluations() << std::endl;
+      }
+      out << "%%%mzn-stat-end" << std::endl
           << std::endl;
     }
   }
@@ -2044,6 +2159,12 @@ namespace Gecode { namespace FlatZinc {
       throw FlatZinc::Error("FlatZinc",
         "Gist mode is unavailable in this build");
 #endif
+    BlackBoxContextHandle& black_box_context = BlackBoxAccess::context(*this);
+    if (black_box_context) {
+      black_box_context.cacheLimit(opt.blackbox_cache());
+      black_box_context.binaryFraming(opt.blackbox_binary());
+      black_box_context.asyncLimit(opt.blackbox_async());
+    }
     switch (_method) {
     case MIN:
     case MAX:
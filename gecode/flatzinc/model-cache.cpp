@@ -0,0 +1,700 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.dev
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/flatzinc/parser.hh>
+
+#include <cstring>
+#include <memory>
+
+namespace Gecode { namespace FlatZinc {
+
+  namespace {
+
+    /// Identifies files holding a compiled model
+    const char compiled_magic[8] = {'G','F','Z','N','B','I','N','\n'};
+    /// Version of the compiled model format
+    const unsigned int compiled_version = 1;
+
+    /// Configuration the compiled model depends on
+    unsigned char
+    compiled_config(void) {
+      unsigned char c = 0;
+#ifdef GECODE_HAS_SET_VARS
+      c |= 1;
+#endif
+#ifdef GECODE_HAS_FLOAT_VARS
+      c |= 2;
+#endif
+      return c;
+    }
+
+    /// Tags for abstract syntax tree nodes
+    enum NodeTag {
+      NT_NULL, NT_BOOL, NT_INT, NT_FLOAT, NT_SET,
+      NT_BOOLVAR, NT_INTVAR, NT_FLOATVAR, NT_SETVAR,
+      NT_ARRAY, NT_CALL, NT_ACCESS, NT_ATOM, NT_STRING
+    };
+
+    /// Write the parts of a compiled model in little-endian byte order
+    class CompiledWriter {
+    protected:
+      /// The output stream
+      std::ostream& os;
+    public:
+      /// Initialize for stream \a os0
+      CompiledWriter(std::ostream& os0) : os(os0) {}
+      /// Write byte \a b
+      void byte(unsigned char b) {
+        os.put(static_cast<char>(b));
+      }
+      /// Write Boolean \a b
+      void boolean(bool b) {
+        byte(b ? 1 : 0);
+      }
+      /// Write 32-bit word \a w
+      void word32(std::uint32_t w) {
+        char b[4];
+        for (int i=0; i<4; i++)
+          b[i] = static_cast<char>((w >> (8*i)) & 0xff);
+        os.write(b, 4);
+      }
+      /// Write 64-bit word \a w
+      void word64(std::uint64_t w) {
+        char b[8];
+        for (int i=0; i<8; i++)
+          b[i] = static_cast<char>((w >> (8*i)) & 0xff);
+        os.write(b, 8);
+      }
+      /// Write integer \a i
+      void integer(int i) {
+        word32(static_cast<std::uint32_t>(i));
+      }
+      /// Write size \a n
+      void size(size_t n) {
+        word32(static_cast<std::uint32_t>(n));
+      }
+      /// Write double \a d
+      void real(double d) {
+        std::uint64_t w;
+        std::memcpy(&w, &d, sizeof(w));
+        word64(w);
+      }
+      /// Write string \a s
+      void string(const std::string& s) {
+        size(s.size());
+        os.write(s.data(), static_cast<std::streamsize>(s.size()));
+      }
+      /// Write the contents of set literal \a s
+      void setLit(const AST::SetLit& s) {
+        boolean(s.interval);
+        if (s.interval) {
+          integer(s.min); integer(s.max);
+        } else {
+          size(s.s.size());
+          for (int v : s.s)
+            integer(v);
+        }
+      }
+      /// Write optional set literal \a o
+      void setLit(const Option<AST::SetLit*>& o) {
+        boolean(o());
+        if (o())
+          setLit(*o.some());
+      }
+      /// Write node \a n (possibly NULL)
+      void node(AST::Node* n) {
+        if (n == NULL) {
+          byte(NT_NULL);
+        } else if (AST::BoolLit* b = dynamic_cast<AST::BoolLit*>(n)) {
+          byte(NT_BOOL); boolean(b->b);
+        } else if (AST::IntLit* i = dynamic_cast<AST::IntLit*>(n)) {
+          byte(NT_INT); integer(i->i);
+        } else if (AST::FloatLit* f = dynamic_cast<AST::FloatLit*>(n)) {
+          byte(NT_FLOAT); real(f->d);
+        } else if (AST::SetLit* s = dynamic_cast<AST::SetLit*>(n)) {
+          byte(NT_SET); setLit(*s);
+        } else if (AST::BoolVar* v = dynamic_cast<AST::BoolVar*>(n)) {
+          byte(NT_BOOLVAR); integer(v->i); string(v->n);
+        } else if (AST::IntVar* v = dynamic_cast<AST::IntVar*>(n)) {
+          byte(NT_INTVAR); integer(v->i); string(v->n);
+        } else if (AST::FloatVar* v = dynamic_cast<AST::FloatVar*>(n)) {
+          byte(NT_FLOATVAR); integer(v->i); string(v->n);
+        } else if (AST::SetVar* v = dynamic_cast<AST::SetVar*>(n)) {
+          byte(NT_SETVAR); integer(v->i); string(v->n);
+        } else if (AST::Array* a = dynamic_cast<AST::Array*>(n)) {
+          byte(NT_ARRAY); size(a->a.size());
+          for (AST::Node* e : a->a)
+            node(e);
+        } else if (AST::Call* c = dynamic_cast<AST::Call*>(n)) {
+          byte(NT_CALL); string(c->id); node(c->args);
+        } else if (AST::ArrayAccess* aa = dynamic_cast<AST::ArrayAccess*>(n)) {
+          byte(NT_ACCESS); node(aa->a); node(aa->idx);
+        } else if (AST::Atom* at = dynamic_cast<AST::Atom*>(n)) {
+          byte(NT_ATOM); string(at->id);
+        } else if (AST::String* st = dynamic_cast<AST::String*>(n)) {
+          byte(NT_STRING); string(st->s);
+        } else {
+          throw Error("FlatZinc", "cannot compile unknown syntax tree node");
+        }
+      }
+      /// Write the flags common to all variable specifications in \a vs
+      void varSpec(const VarSpec& vs) {
+        boolean(vs.introduced); boolean(vs.funcDep); boolean(vs.alias);
+        if (vs.alias) {
+          integer(vs.i);
+        } else {
+          boolean(vs.assigned);
+          if (vs.assigned)
+            integer(vs.i);
+        }
+      }
+      /// Write integer variable specification \a vs
+      void intVarSpec(const IntVarSpec& vs) {
+        varSpec(vs);
+        if (!vs.alias && !vs.assigned)
+          setLit(vs.domain);
+      }
+      /// Write Boolean variable specification \a vs
+      void boolVarSpec(const BoolVarSpec& vs) {
+        varSpec(vs);
+        if (!vs.alias && !vs.assigned)
+          setLit(vs.domain);
+      }
+      /// Write float variable specification \a vs
+      void floatVarSpec(const FloatVarSpec& vs) {
+        boolean(vs.introduced); boolean(vs.funcDep); boolean(vs.alias);
+        if (vs.alias) {
+          integer(vs.i);
+        } else {
+          boolean(vs.assigned);
+          boolean(vs.domain());
+          if (vs.domain()) {
+            real(vs.domain.some().first); real(vs.domain.some().second);
+          }
+        }
+      }
+      /// Write set variable specification \a vs
+      void setVarSpec(const SetVarSpec& vs) {
+        boolean(vs.introduced); boolean(vs.funcDep); boolean(vs.alias);
+        if (vs.alias) {
+          integer(vs.i);
+        } else {
+          boolean(vs.assigned);
+          setLit(vs.upperBound);
+        }
+      }
+      /// Write the names and specifications in \a vars
+      template<class Spec>
+      void varSpecs(const std::vector<varspec>& vars,
+                    void (CompiledWriter::*spec)(const Spec&)) {
+        size(vars.size());
+        for (const varspec& v : vars) {
+          string(v.first);
+          (this->*spec)(*static_cast<const Spec*>(v.second));
+        }
+      }
+      /// Write constraints \a cs
+      void conExprs(const std::vector<ConExpr*>& cs) {
+        size(cs.size());
+        for (const ConExpr* c : cs) {
+          string(c->id); node(c->args); node(c->ann);
+        }
+      }
+      /// Write index tuples \a t
+      template<size_t n>
+      void tuples(const std::vector<std::array<int,n> >& t) {
+        size(t.size());
+        for (const std::array<int,n>& a : t)
+          for (int i : a)
+            integer(i);
+      }
+    };
+
+    /// Thrown when a compiled model is truncated or malformed
+    class CompiledMalformed {};
+
+    /// Read the parts of a compiled model from a buffer
+    class CompiledReader {
+    protected:
+      /// Current position
+      const char* p;
+      /// End of buffer
+      const char* e;
+      /// Make sure that \a n more bytes are available
+      void need(size_t n) {
+        if (static_cast<size_t>(e-p) < n)
+          throw CompiledMalformed();
+      }
+    public:
+      /// Initialize for buffer \a s
+      CompiledReader(const std::string& s)
+        : p(s.data()), e(s.data()+s.size()) {}
+      /// Whether all of the buffer has been read
+      bool done(void) const {
+        return p == e;
+      }
+      /// Read a byte
+      unsigned char byte(void) {
+        need(1);
+        return static_cast<unsigned char>(*p++);
+      }
+      /// Read a Boolean
+      bool boolean(void) {
+        unsigned char b = byte();
+        if (b > 1)
+          throw CompiledMalformed();
+        return b == 1;
+      }
+      /// Read a 32-bit word
+      std::uint32_t word32(void) {
+        need(4);
+        std::uint32_t w = 0;
+        for (int i=0; i<4; i++)
+          w |= static_cast<std::uint32_t>(static_cast<unsigned char>(p[i]))
+            << (8*i);
+        p += 4;
+        return w;
+      }
+      /// Read a 64-bit word
+      std::uint64_t word64(void) {
+        need(8);
+        std::uint64_t w = 0;
+        for (int i=0; i<8; i++)
+          w |= static_cast<std::uint64_t>(static_cast<unsigned char>(p[i]))
+            << (8*i);
+        p += 8;
+        return w;
+      }
+      /// Read an integer
+      int integer(void) {
+        return static_cast<int>(word32());
+      }
+      /// Read a size of a sequence with elements of at least \a m bytes
+      size_t size(size_t m=1) {
+        size_t n = word32();
+        if (n > static_cast<size_t>(e-p) / m)
+          throw CompiledMalformed();
+        return n;
+      }
+      /// Read a double
+      double real(void) {
+        std::uint64_t w = word64();
+        double d;
+        std::memcpy(&d, &w, sizeof(d));
+        return d;
+      }
+      /// Read a string
+      std::string string(void) {
+        size_t n = size();
+        std::string s(p, n);
+        p += n;
+        return s;
+      }
+      /// Read the contents of a set literal into \a s
+      void setLit(AST::SetLit& s) {
+        s.interval = boolean();
+        if (s.interval) {
+          s.min = integer(); s.max = integer();
+        } else {
+          s.s.resize(size(4));
+          for (int& v : s.s)
+            v = integer();
+        }
+      }
+      /// Read an optional set literal
+      Option<AST::SetLit*> setLit(void) {
+        if (!boolean())
+          return Option<AST::SetLit*>::none();
+        std::unique_ptr<AST::SetLit> s(new AST::SetLit());
+        setLit(*s);
+        return Option<AST::SetLit*>::some(s.release());
+      }
+      /// Read a node (possibly NULL)
+      AST::Node* node(void) {
+        switch (byte()) {
+        case NT_NULL:
+          return NULL;
+        case NT_BOOL:
+          return new AST::BoolLit(boolean());
+        case NT_INT:
+          return new AST::IntLit(integer());
+        case NT_FLOAT:
+          return new AST::FloatLit(real());
+        case NT_SET:
+          {
+            std::unique_ptr<AST::SetLit> s(new AST::SetLit());
+            setLit(*s);
+            return s.release();
+          }
+        case NT_BOOLVAR:
+          {
+            int i = integer();
+            return new AST::BoolVar(i, string());
+          }
+        case NT_INTVAR:
+          {
+            int i = integer();
+            return new AST::IntVar(i, string());
+          }
+        case NT_FLOATVAR:
+          {
+            int i = integer();
+            return new AST::FloatVar(i, string());
+          }
+        case NT_SETVAR:
+          {
+            int i = integer();
+            return new AST::SetVar(i, string());
+          }
+        case NT_ARRAY:
+          {
+            std::unique_ptr<AST::Array> a(new AST::Array(size()));
+            for (AST::Node*& n : a->a)
+              n = node();
+            return a.release();
+          }
+        case NT_CALL:
+          {
+            std::unique_ptr<AST::Call> c(new AST::Call(string(), NULL));
+            c->args = node();
+            return c.release();
+          }
+        case NT_ACCESS:
+          {
+            std::unique_ptr<AST::ArrayAccess>
+              aa(new AST::ArrayAccess(NULL, NULL));
+            aa->a = node();
+            aa->idx = node();
+            return aa.release();
+          }
+        case NT_ATOM:
+          return new AST::Atom(string());
+        case NT_STRING:
+          return new AST::String(string());
+        default:
+          throw CompiledMalformed();
+        }
+      }
+      /// Read a node that must be an array or NULL
+      AST::Array* array(void) {
+        std::unique_ptr<AST::Node> n(node());
+        if (n == NULL)
+          return NULL;
+        AST::Array* a = dynamic_cast<AST::Array*>(n.get());
+        if (a == NULL)
+          throw CompiledMalformed();
+        n.release();
+        return a;
+      }
+      /// Read an integer variable specification
+      IntVarSpec* intVarSpec(void) {
+        bool introduced = boolean();
+        bool funcDep = boolean();
+        if (boolean())
+          return new IntVarSpec(Alias(integer()), introduced, funcDep);
+        if (boolean())
+          return new IntVarSpec(integer(), introduced, funcDep);
+        return new IntVarSpec(setLit(), introduced, funcDep);
+      }
+      /// Read a Boolean variable specification
+      BoolVarSpec* boolVarSpec(void) {
+        bool introduced = boolean();
+        bool funcDep = boolean();
+        if (boolean())
+          return new BoolVarSpec(Alias(integer()), introduced, funcDep);
+        if (boolean())
+          return new BoolVarSpec(integer() != 0, introduced, funcDep);
+        Option<AST::SetLit*> d = setLit();
+        return new BoolVarSpec(d, introduced, funcDep);
+      }
+      /// Read a float variable specification
+      FloatVarSpec* floatVarSpec(void) {
+        bool introduced = boolean();
+        bool funcDep = boolean();
+        if (boolean())
+          return new FloatVarSpec(Alias(integer()), introduced, funcDep);
+        bool assigned = boolean();
+        Option<std::pair<double,double> > d =
+          Option<std::pair<double,double> >::none();
+        if (boolean()) {
+          double l = real();
+          double u = real();
+          d = Option<std::pair<double,double> >::some(
+                std::pair<double,double>(l,u));
+        }
+        FloatVarSpec* vs = new FloatVarSpec(d, introduced, funcDep);
+        vs->assigned = assigned;
+        return vs;
+      }
+      /// Read a set variable specification
+      SetVarSpec* setVarSpec(void) {
+        bool introduced = boolean();
+        bool funcDep = boolean();
+        if (boolean())
+          return new SetVarSpec(Alias(integer()), introduced, funcDep);
+        bool assigned = boolean();
+        Option<AST::SetLit*> ub = setLit();
+        if (assigned) {
+          if (!ub())
+            throw CompiledMalformed();
+          return new SetVarSpec(ub.some(), introduced, funcDep);
+        }
+        return new SetVarSpec(ub, introduced, funcDep);
+      }
+      /// Read names and specifications into \a vars
+      template<class Spec>
+      void varSpecs(std::vector<varspec>& vars,
+                    Spec* (CompiledReader::*spec)(void)) {
+        size_t n = size();
+        vars.reserve(n);
+        for (size_t i=0; i<n; i++) {
+          std::string name = string();
+          vars.push_back(varspec(name, NULL));
+          vars.back().second = (this->*spec)();
+        }
+      }
+      /// Read constraints into \a cs
+      void conExprs(std::vector<ConExpr*>& cs) {
+        size_t n = size();
+        cs.reserve(n);
+        for (size_t i=0; i<n; i++) {
+          std::string id = string();
+          std::unique_ptr<AST::Array> args(array());
+          if (args == NULL)
+            throw CompiledMalformed();
+          AST::Array* ann = array();
+          cs.push_back(new ConExpr(id, args.release(), ann));
+        }
+      }
+      /// Read index tuples into \a t
+      template<size_t n>
+      void tuples(std::vector<std::array<int,n> >& t) {
+        t.resize(size(4*n));
+        for (std::array<int,n>& a : t)
+          for (int& i : a)
+            i = integer();
+      }
+    };
+
+    /// The parts of a compiled model that own memory
+    class CompiledModel {
+    public:
+      std::vector<varspec> intvars;
+      std::vector<varspec> boolvars;
+      std::vector<varspec> setvars;
+      std::vector<varspec> floatvars;
+      std::vector<ConExpr*> domainConstraints;
+      std::vector<ConExpr*> constraints;
+      std::vector<std::pair<std::string,AST::Node*> > output;
+      AST::Array* ann;
+      CompiledModel(void) : ann(NULL) {}
+      /// Delete everything not handed over to a parser state
+      ~CompiledModel(void) {
+        for (std::vector<varspec>* vs : {&intvars, &boolvars,
+                                         &setvars, &floatvars})
+          for (varspec& v : *vs)
+            delete v.second;
+        for (ConExpr* c : domainConstraints)
+          delete c;
+        for (ConExpr* c : constraints)
+          delete c;
+        for (std::pair<std::string,AST::Node*>& o : output)
+          delete o.second;
+        delete ann;
+      }
+    };
+
+  }
+
+  std::uint64_t
+  sourceHash(const char* s, size_t n) {
+    // 64-bit FNV-1a
+    std::uint64_t h = 14695981039346656037ULL;
+    for (size_t i=0; i<n; i++) {
+      h ^= static_cast<unsigned char>(s[i]);
+      h *= 1099511628211ULL;
+    }
+    return h ^ static_cast<std::uint64_t>(n);
+  }
+
+  void
+  writeCompiledModel(std::ostream& os, std::uint64_t hash,
+                     const ParserState& pp, const SolveItem& si) {
+    CompiledWriter w(os);
+    os.write(compiled_magic, sizeof(compiled_magic));
+    w.word32(compiled_version);
+    w.string(GECODE_VERSION);
+    w.byte(compiled_config());
+    w.word64(hash);
+
+    w.varSpecs<IntVarSpec>(pp.intvars, &CompiledWriter::intVarSpec);
+    w.varSpecs<BoolVarSpec>(pp.boolvars, &CompiledWriter::boolVarSpec);
+    w.varSpecs<SetVarSpec>(pp.setvars, &CompiledWriter::setVarSpec);
+    w.varSpecs<FloatVarSpec>(pp.floatvars, &CompiledWriter::floatVarSpec);
+    w.conExprs(pp.domainConstraints);
+    w.conExprs(pp.constraints);
+    w.size(pp._output.size());
+    for (const std::pair<std::string,AST::Node*>& o : pp._output) {
+      w.string(o.first); w.node(o.second);
+    }
+
+    w.integer(pp.status_idx);
+    w.integer(pp.complete_idx);
+    w.tuples(pp.last_val_int);
+    w.tuples(pp.sol_int);
+    w.tuples(pp.uniform_int);
+    w.tuples(pp.sol_bool);
+    w.tuples(pp.last_val_bool);
+#ifdef GECODE_HAS_SET_VARS
+    w.tuples(pp.sol_set);
+    w.tuples(pp.last_val_set);
+#endif
+#ifdef GECODE_HAS_FLOAT_VARS
+    w.tuples(pp.last_val_float);
+    w.tuples(pp.sol_float);
+    w.size(pp.uniform_float.size());
+    for (const std::tuple<FloatVal,FloatVal,int>& u : pp.uniform_float) {
+      w.real(std::get<0>(u).min()); w.real(std::get<0>(u).max());
+      w.real(std::get<1>(u).min()); w.real(std::get<1>(u).max());
+      w.integer(std::get<2>(u));
+    }
+#endif
+
+    w.byte(static_cast<unsigned char>(si.kind));
+    w.integer(si.objective);
+    w.node(si.ann);
+  }
+
+  bool
+  readCompiledModel(std::istream& is, std::uint64_t hash,
+                    ParserState& pp, SolveItem& si) {
+    is.seekg(0, std::ios::end);
+    std::streamoff n = is.tellg();
+    is.seekg(0, std::ios::beg);
+    if (!is || (n < static_cast<std::streamoff>(sizeof(compiled_magic))))
+      return false;
+    std::string data(static_cast<size_t>(n), '\0');
+    if (!is.read(&data[0], n))
+      return false;
+
+    CompiledModel m;
+    SolveItem s;
+    try {
+      CompiledReader r(data);
+      for (char c : compiled_magic)
+        if (static_cast<char>(r.byte()) != c)
+          return false;
+      if ((r.word32() != compiled_version) ||
+          (r.string() != GECODE_VERSION) ||
+          (r.byte() != compiled_config()) ||
+          (r.word64() != hash))
+        return false;
+
+      r.varSpecs<IntVarSpec>(m.intvars, &CompiledReader::intVarSpec);
+      r.varSpecs<BoolVarSpec>(m.boolvars, &CompiledReader::boolVarSpec);
+      r.varSpecs<SetVarSpec>(m.setvars, &CompiledReader::setVarSpec);
+      r.varSpecs<FloatVarSpec>(m.floatvars, &CompiledReader::floatVarSpec);
+      r.conExprs(m.domainConstraints);
+      r.conExprs(m.constraints);
+      size_t n_output = r.size();
+      m.output.reserve(n_output);
+      for (size_t i=0; i<n_output; i++) {
+        std::string name = r.string();
+        m.output.push_back(std::make_pair(name, static_cast<AST::Node*>(NULL)));
+        m.output.back().second = r.node();
+        if (m.output.back().second == NULL)
+          throw CompiledMalformed();
+      }
+
+      pp.status_idx = r.integer();
+      pp.complete_idx = r.integer();
+      r.tuples(pp.last_val_int);
+      r.tuples(pp.sol_int);
+      r.tuples(pp.uniform_int);
+      r.tuples(pp.sol_bool);
+      r.tuples(pp.last_val_bool);
+#ifdef GECODE_HAS_SET_VARS
+      r.tuples(pp.sol_set);
+      r.tuples(pp.last_val_set);
+#endif
+#ifdef GECODE_HAS_FLOAT_VARS
+      r.tuples(pp.last_val_float);
+      r.tuples(pp.sol_float);
+      pp.uniform_float.resize(r.size(36));
+      for (std::tuple<FloatVal,FloatVal,int>& u : pp.uniform_float) {
+        double l0 = r.real(); double u0 = r.real();
+        double l1 = r.real(); double u1 = r.real();
+        u = std::make_tuple(FloatVal(l0,u0), FloatVal(l1,u1), r.integer());
+      }
+#endif
+
+      unsigned char kind = r.byte();
+      if (kind > SolveItem::SI_MAXIMIZE)
+        throw CompiledMalformed();
+      s.kind = static_cast<SolveItem::Kind>(kind);
+      s.objective = r.integer();
+      m.ann = r.array();
+      if (!r.done())
+        throw CompiledMalformed();
+    } catch (CompiledMalformed&) {
+      pp.status_idx = -1;
+      pp.complete_idx = -1;
+      pp.last_val_int.clear(); pp.sol_int.clear(); pp.uniform_int.clear();
+      pp.sol_bool.clear(); pp.last_val_bool.clear();
+#ifdef GECODE_HAS_SET_VARS
+      pp.sol_set.clear(); pp.last_val_set.clear();
+#endif
+#ifdef GECODE_HAS_FLOAT_VARS
+      pp.last_val_float.clear(); pp.sol_float.clear();
+      pp.uniform_float.clear();
+#endif
+      return false;
+    }
+
+    // Hand over the model to the parser state
+    pp.intvars.swap(m.intvars);
+    pp.boolvars.swap(m.boolvars);
+    pp.setvars.swap(m.setvars);
+    pp.floatvars.swap(m.floatvars);
+    pp.domainConstraints.swap(m.domainConstraints);
+    pp.constraints.swap(m.constraints);
+    pp._output.swap(m.output);
+    si = s;
+    si.ann = m.ann;
+    m.ann = NULL;
+    return true;
+  }
+
+}}
+
+// STATISTICS: flatzinc-any
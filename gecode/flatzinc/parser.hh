@@ -57,6 +57,7 @@ extern "C" int isatty(int);
 #include <array>
 #include <iostream>
 #include <algorithm>
+#include <cstdint>
 
 #include <gecode/flatzinc/option.hh>
 #include <gecode/flatzinc/varspec.hh>
@@ -186,12 +187,12 @@ namespace Gecode { namespace FlatZinc {
   public:
     ParserState(const std::string& b, std::ostream& err0,
                 Gecode::FlatZinc::FlatZincSpace* fg0)
-    : buf(b.c_str()), pos(0), length(b.size()), fg(fg0),
+    : yyscanner(NULL), buf(b.c_str()), pos(0), length(b.size()), fg(fg0),
       hadError(false), err(err0) {}
 
     ParserState(char* buf0, int length0, std::ostream& err0,
                 Gecode::FlatZinc::FlatZincSpace* fg0)
-    : buf(buf0), pos(0), length(length0), fg(fg0),
+    : yyscanner(NULL), buf(buf0), pos(0), length(length0), fg(fg0),
       hadError(false), err(err0) {}
 
     void* yyscanner;
@@ -233,6 +234,15 @@ namespace Gecode { namespace FlatZinc {
     bool hadError;
     std::ostream& err;
 
+    /// Stream receiving the compiled model, if any
+    std::ostream* compiled = NULL;
+    /// Hash of the source the compiled model is written for
+    std::uint64_t hash = 0;
+    /// Whether constraints are posted as soon as they are parsed
+    bool stream = false;
+    /// Whether the variables have already been created in \a fg
+    bool varsCreated = false;
+
     int fillBuffer(char* lexBuf, unsigned int lexBufSize) {
       if (pos >= length)
         return 0;
@@ -269,6 +279,46 @@ namespace Gecode { namespace FlatZinc {
 
   };
 
+  /// Solve item of a parsed model
+  class SolveItem {
+  public:
+    /// Kind of solve item
+    enum Kind {
+      SI_SATISFY, //< Satisfaction problem
+      SI_MINIMIZE, //< Minimize the objective
+      SI_MAXIMIZE //< Maximize the objective
+    };
+    /// The kind of solve item
+    Kind kind;
+    /// Objective variable (float variables \f$i\f$ as \f$-i-1\f$)
+    int objective;
+    /// Solve annotations (possibly NULL)
+    AST::Array* ann;
+  };
+
+  /// Return a hash of the %FlatZinc source \a s of length \a n
+  std::uint64_t sourceHash(const char* s, size_t n);
+
+  /**
+   * \brief Write the parsed model in \a pp with solve item \a si to \a os
+   *
+   * The compiled model stores the variable specifications, constraints,
+   * output items, and solve item with all names resolved. It is only
+   * valid for the source with hash \a hash and for the version and
+   * configuration of %Gecode that wrote it.
+   */
+  void writeCompiledModel(std::ostream& os, std::uint64_t hash,
+                          const ParserState& pp, const SolveItem& si);
+
+  /**
+   * \brief Read the compiled model for source hash \a hash from \a is
+   *
+   * Returns false and leaves \a pp unchanged if \a is does not hold a
+   * valid compiled model for \a hash and this version of %Gecode.
+   */
+  bool readCompiledModel(std::istream& is, std::uint64_t hash,
+                         ParserState& pp, SolveItem& si);
+
 }}
 
 #endif
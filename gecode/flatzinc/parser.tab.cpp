@@ -77,6 +77,8 @@
 #include <gecode/flatzinc/complete.hh>
 #include <iostream>
 #include <fstream>
+#include <cstdio>
+#include <memory>
 
 #if defined __GNUC__
 #pragma GCC diagnostic ignored "-Wunused-but-set-variable"
@@ -108,18 +110,20 @@ using namespace Gecode::FlatZinc;
 
 void yyerror(void* parm, const char *str) {
   ParserState* pp = static_cast<ParserState*>(parm);
-  pp->err << "Error: " << str
-          << " in line no. " << yyget_lineno(pp->yyscanner)
-          << std::endl;
+  pp->err << "Error: " << str;
+  if (pp->yyscanner != NULL)
+    pp->err << " in line no. " << yyget_lineno(pp->yyscanner);
+  pp->err << std::endl;
   pp->hadError = true;
 }
 
 void yyassert(ParserState* pp, bool cond, const char* str)
 {
   if (!cond) {
-    pp->err << "Error: " << str
-            << " in line no. " << yyget_lineno(pp->yyscanner)
-            << std::endl;
+    pp->err << "Error: " << str;
+    if (pp->yyscanner != NULL)
+      pp->err << " in line no. " << yyget_lineno(pp->yyscanner);
+    pp->err << std::endl;
     pp->hadError = true;
   }
 }
@@ -303,7 +307,8 @@ int getBaseSetVar(ParserState* pp, int i) {
  *
  */
 
-void initfg(ParserState* pp) {
+void initvars(ParserState* pp) {
+  pp->varsCreated = true;
   if (!pp->hadError)
     pp->fg->init(pp->intvars.size(),
                  pp->boolvars.size(),
@@ -318,8 +323,6 @@ void initfg(ParserState* pp) {
         yyerror(pp, e.toString().c_str());
       }
     }
-    delete pp->intvars[i].second;
-    pp->intvars[i].second = NULL;
   }
   for (unsigned int i=0; i<pp->boolvars.size(); i++) {
     if (!pp->hadError) {
@@ -330,8 +333,6 @@ void initfg(ParserState* pp) {
         yyerror(pp, e.toString().c_str());
       }
     }
-    delete pp->boolvars[i].second;
-    pp->boolvars[i].second = NULL;
   }
   for (unsigned int i=0; i<pp->setvars.size(); i++) {
     if (!pp->hadError) {
@@ -341,8 +342,6 @@ void initfg(ParserState* pp) {
         yyerror(pp, e.toString().c_str());
       }
     }
-    delete pp->setvars[i].second;
-    pp->setvars[i].second = NULL;
   }
   for (unsigned int i=0; i<pp->floatvars.size(); i++) {
     if (!pp->hadError) {
@@ -353,6 +352,25 @@ void initfg(ParserState* pp) {
         yyerror(pp, e.toString().c_str());
       }
     }
+  }
+}
+
+void initfg(ParserState* pp) {
+  if (!pp->varsCreated)
+    initvars(pp);
+  for (unsigned int i=0; i<pp->intvars.size(); i++) {
+    delete pp->intvars[i].second;
+    pp->intvars[i].second = NULL;
+  }
+  for (unsigned int i=0; i<pp->boolvars.size(); i++) {
+    delete pp->boolvars[i].second;
+    pp->boolvars[i].second = NULL;
+  }
+  for (unsigned int i=0; i<pp->setvars.size(); i++) {
+    delete pp->setvars[i].second;
+    pp->setvars[i].second = NULL;
+  }
+  for (unsigned int i=0; i<pp->floatvars.size(); i++) {
     delete pp->floatvars[i].second;
     pp->floatvars[i].second = NULL;
   }
@@ -500,6 +518,70 @@ void initfg(ParserState* pp) {
   }
 }
 
+/*
+ * Add a parsed constraint
+ *
+ * When streaming, constraints are posted as soon as they are parsed,
+ * which requires creating the variables first. Domain constraints
+ * parsed before that are kept so that they are still posted first, and
+ * clauses are kept so that they are posted as a single clause database.
+ *
+ */
+
+void addConstraint(ParserState* pp, ConExpr* ce, bool domain) {
+  if (!pp->stream || (domain && !pp->varsCreated) ||
+      (ce->id == "bool_clause")) {
+    if (domain)
+      pp->domainConstraints.push_back(ce);
+    else
+      pp->constraints.push_back(ce);
+    return;
+  }
+  std::unique_ptr<ConExpr> c(ce);
+  if (!pp->varsCreated) {
+    initvars(pp);
+    if (!pp->hadError)
+      pp->fg->postConstraints(pp->domainConstraints);
+    pp->domainConstraints.clear();
+  }
+  if (!pp->hadError)
+    pp->fg->postConstraint(*c);
+}
+
+/*
+ * Post the model and the solve item
+ *
+ */
+
+void solvefg(ParserState* pp, const SolveItem& si) {
+  if ((pp->compiled != NULL) && !pp->hadError)
+    writeCompiledModel(*pp->compiled, pp->hash, *pp, si);
+  initfg(pp);
+  if (!pp->hadError) {
+    try {
+      switch (si.kind) {
+      case SolveItem::SI_SATISFY:
+        pp->fg->solve(si.ann); break;
+      case SolveItem::SI_MINIMIZE:
+      case SolveItem::SI_MAXIMIZE:
+        {
+          int v = si.objective < 0 ? (-si.objective-1) : si.objective;
+          bool vi = si.objective >= 0;
+          if (si.kind == SolveItem::SI_MINIMIZE)
+            pp->fg->minimize(v,vi,si.ann);
+          else
+            pp->fg->maximize(v,vi,si.ann);
+        }
+        break;
+      }
+    } catch (Gecode::FlatZinc::Error& e) {
+      yyerror(pp, e.toString().c_str());
+    }
+  } else {
+    delete si.ann;
+  }
+}
+
 void fillPrinter(ParserState& pp, Gecode::FlatZinc::Printer& p) {
   p.init(pp.getOutput());
   for (unsigned int i=0; i<pp.intvars.size(); i++) {
@@ -569,10 +651,15 @@ AST::Node* arrayOutput(AST::Call* ann) {
  *
  */
 
-namespace Gecode { namespace FlatZinc {
+namespace {
 
-  FlatZincSpace* parse(const std::string& filename, Printer& p, std::ostream& err,
-                       FlatZincSpace* fzs, Rnd& rnd) {
+  /// Parse \a filename, possibly using a cache or streaming constraints
+  FlatZincSpace* parseFile(const std::string& filename,
+                           const std::string& cachename, bool stream,
+                           Printer& p, std::ostream& err,
+                           FlatZincSpace* fzs, Rnd& rnd) {
+    Support::Timer t;
+    t.start();
 #ifdef HAVE_MMAP
     int fd;
     char* data;
@@ -610,6 +697,29 @@ namespace Gecode { namespace FlatZinc {
     }
     ParserState pp(s, err, fzs);
 #endif
+    std::ofstream compiled;
+    std::string compiledname = cachename + ".tmp";
+    if (!cachename.empty()) {
+      pp.hash = sourceHash(pp.buf, pp.length);
+      // Post the compiled model if it is up to date
+      std::ifstream cache(cachename.c_str(), std::ios::binary);
+      SolveItem si;
+      if (cache.is_open() && readCompiledModel(cache, pp.hash, pp, si)) {
+        solvefg(&pp, si);
+        fillPrinter(pp, p);
+        if (pp.hadError)
+          return NULL;
+        pp.fg->parsed(t.stop());
+        return pp.fg;
+      }
+      // Otherwise compile the model while parsing
+      compiled.open(compiledname.c_str(),
+                    std::ios::binary | std::ios::trunc);
+      if (compiled.is_open())
+        pp.compiled = &compiled;
+    }
+    // The compiled model needs all constraints at the solve item
+    pp.stream = stream && (pp.compiled == NULL);
     yylex_init(&pp.yyscanner);
     yyset_extra(&pp, pp.yyscanner);
     // yydebug = 1;
@@ -618,11 +728,56 @@ namespace Gecode { namespace FlatZinc {
 
     if (pp.yyscanner)
       yylex_destroy(pp.yyscanner);
-    return pp.hadError ? NULL : pp.fg;
+    if (pp.compiled != NULL) {
+      compiled.close();
+      if (pp.hadError || compiled.fail()) {
+        std::remove(compiledname.c_str());
+      } else if (std::rename(compiledname.c_str(), cachename.c_str()) != 0) {
+        std::remove(cachename.c_str());
+        if (std::rename(compiledname.c_str(), cachename.c_str()) != 0)
+          std::remove(compiledname.c_str());
+      }
+    }
+    if (pp.hadError)
+      return NULL;
+    pp.fg->parsed(t.stop());
+    return pp.fg;
+  }
+
+}
+
+namespace Gecode { namespace FlatZinc {
+
+  FlatZincSpace* parse(const std::string& filename, Printer& p, std::ostream& err,
+                       FlatZincSpace* fzs, Rnd& rnd) {
+    return parseFile(filename, std::string(), false, p, err, fzs, rnd);
+  }
+
+  FlatZincSpace* parse(const std::string& filename,
+                       const std::string& cachename,
+                       Printer& p, std::ostream& err,
+                       FlatZincSpace* fzs, Rnd& rnd) {
+    return parseFile(filename, cachename, false, p, err, fzs, rnd);
+  }
+
+  FlatZincSpace* parse(const std::string& filename,
+                       const FlatZincOptions& opt,
+                       Printer& p, std::ostream& err,
+                       FlatZincSpace* fzs, Rnd& rnd) {
+    std::string cachename;
+    if (opt.fzn_cache() != nullptr)
+      cachename = opt.fzn_cache();
+    if (fzs == NULL)
+      fzs = new FlatZincSpace(rnd);
+    fzs->clauseIpl = opt.clause_learning() ? IPL_ADVANCED : IPL_DEF;
+    return parseFile(filename, cachename, opt.fzn_stream(),
+                     p, err, fzs, rnd);
   }
 
   FlatZincSpace* parse(std::istream& is, Printer& p, std::ostream& err,
                        FlatZincSpace* fzs, Rnd& rnd) {
+    Support::Timer t;
+    t.start();
     std::string s = string(istreambuf_iterator<char>(is),
                            istreambuf_iterator<char>());
 
@@ -638,13 +793,16 @@ namespace Gecode { namespace FlatZinc {
 
     if (pp.yyscanner)
       yylex_destroy(pp.yyscanner);
-    return pp.hadError ? NULL : pp.fg;
+    if (pp.hadError)
+      return NULL;
+    pp.fg->parsed(t.stop());
+    return pp.fg;
   }
 
 }}
 
 
-#line 648 "gecode/flatzinc/parser.tab.cpp"
+#line 806 "gecode/flatzinc/parser.tab.cpp"
 
 # ifndef YY_CAST
 #  ifdef __cplusplus
@@ -1188,23 +1346,23 @@ static const yytype_int8 yytranslate[] =
 /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,   716,   716,   718,   720,   723,   724,   726,   728,   731,
-     732,   734,   736,   739,   740,   747,   750,   752,   755,   756,
-     759,   763,   764,   765,   766,   769,   771,   773,   774,   777,
-     778,   781,   782,   788,   788,   791,   823,   855,   894,   927,
-     936,   946,   955,   967,  1037,  1103,  1174,  1242,  1263,  1283,
-    1303,  1326,  1330,  1345,  1369,  1370,  1374,  1376,  1379,  1379,
-    1381,  1385,  1387,  1402,  1425,  1426,  1430,  1432,  1436,  1440,
-    1442,  1457,  1480,  1481,  1485,  1487,  1490,  1493,  1495,  1510,
-    1533,  1534,  1538,  1540,  1543,  1548,  1549,  1554,  1555,  1560,
-    1561,  1566,  1567,  1571,  1737,  1751,  1776,  1778,  1780,  1786,
-    1788,  1801,  1803,  1812,  1814,  1821,  1822,  1826,  1828,  1833,
-    1834,  1838,  1840,  1845,  1846,  1850,  1852,  1857,  1858,  1862,
-    1864,  1872,  1874,  1878,  1880,  1885,  1886,  1890,  1892,  1894,
-    1896,  1898,  1994,  2009,  2010,  2014,  2016,  2024,  2058,  2065,
-    2072,  2098,  2099,  2107,  2108,  2112,  2114,  2118,  2122,  2126,
-    2128,  2132,  2134,  2136,  2139,  2139,  2142,  2144,  2146,  2148,
-    2150,  2256,  2267
+       0,   874,   874,   876,   878,   881,   882,   884,   886,   889,
+     890,   892,   894,   897,   898,   905,   908,   910,   913,   914,
+     917,   921,   922,   923,   924,   927,   929,   931,   932,   935,
+     936,   939,   940,   946,   946,   949,   981,  1013,  1052,  1085,
+    1094,  1104,  1113,  1125,  1195,  1261,  1332,  1400,  1421,  1441,
+    1461,  1484,  1488,  1503,  1527,  1528,  1532,  1534,  1537,  1537,
+    1539,  1543,  1545,  1560,  1583,  1584,  1588,  1590,  1594,  1598,
+    1600,  1615,  1638,  1639,  1643,  1645,  1648,  1651,  1653,  1668,
+    1691,  1692,  1696,  1698,  1701,  1706,  1707,  1712,  1713,  1718,
+    1719,  1724,  1725,  1729,  1895,  1904,  1919,  1921,  1923,  1929,
+    1931,  1944,  1946,  1955,  1957,  1964,  1965,  1969,  1971,  1976,
+    1977,  1981,  1983,  1988,  1989,  1993,  1995,  2000,  2001,  2005,
+    2007,  2015,  2017,  2021,  2023,  2028,  2029,  2033,  2035,  2037,
+    2039,  2041,  2137,  2152,  2153,  2157,  2159,  2167,  2201,  2208,
+    2215,  2241,  2242,  2250,  2251,  2255,  2257,  2261,  2265,  2269,
+    2271,  2275,  2277,  2279,  2282,  2282,  2285,  2287,  2289,  2291,
+    2293,  2399,  2410
 };
 #endif
 
@@ -2286,31 +2444,31 @@ yyreduce:
   switch (yyn)
     {
   case 15: /* preddecl_item: FZ_PREDICATE FZ_ID '(' pred_arg_list ')'  */
-#line 748 "./gecode/flatzinc/parser.yxx"
+#line 906 "./gecode/flatzinc/parser.yxx"
       { free((yyvsp[-3].sValue)); }
-#line 2292 "gecode/flatzinc/parser.tab.cpp"
+#line 2450 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 20: /* pred_arg: pred_arg_type ':' FZ_ID  */
-#line 760 "./gecode/flatzinc/parser.yxx"
+#line 918 "./gecode/flatzinc/parser.yxx"
       { free((yyvsp[0].sValue)); }
-#line 2298 "gecode/flatzinc/parser.tab.cpp"
+#line 2456 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 25: /* pred_arg_simple_type: int_ti_expr_tail  */
-#line 770 "./gecode/flatzinc/parser.yxx"
+#line 928 "./gecode/flatzinc/parser.yxx"
       { if ((yyvsp[0].oSet)()) delete (yyvsp[0].oSet).some(); }
-#line 2304 "gecode/flatzinc/parser.tab.cpp"
+#line 2462 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 26: /* pred_arg_simple_type: FZ_SET FZ_OF int_ti_expr_tail  */
-#line 772 "./gecode/flatzinc/parser.yxx"
+#line 930 "./gecode/flatzinc/parser.yxx"
       { if ((yyvsp[0].oSet)()) delete (yyvsp[0].oSet).some(); }
-#line 2310 "gecode/flatzinc/parser.tab.cpp"
+#line 2468 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 35: /* vardecl_item: FZ_VAR int_ti_expr_tail ':' var_par_id annotations non_array_expr_opt  */
-#line 792 "./gecode/flatzinc/parser.yxx"
+#line 950 "./gecode/flatzinc/parser.yxx"
       {
         ParserState* pp = static_cast<ParserState*>(parm);
         bool print = (yyvsp[-1].argVec) != NULL && (yyvsp[-1].argVec)->hasAtom("output_var");
@@ -2342,11 +2500,11 @@ yyreduce:
         }
         delete (yyvsp[-1].argVec); free((yyvsp[-2].sValue));
       }
-#line 2346 "gecode/flatzinc/parser.tab.cpp"
+#line 2504 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 36: /* vardecl_item: FZ_VAR bool_ti_expr_tail ':' var_par_id annotations non_array_expr_opt  */
-#line 824 "./gecode/flatzinc/parser.yxx"
+#line 982 "./gecode/flatzinc/parser.yxx"
       {
         ParserState* pp = static_cast<ParserState*>(parm);
         bool print = (yyvsp[-1].argVec) != NULL && (yyvsp[-1].argVec)->hasAtom("output_var");
@@ -2378,11 +2536,11 @@ yyreduce:
         }
         delete (yyvsp[-1].argVec); free((yyvsp[-2].sValue));
       }
-#line 2382 "gecode/flatzinc/parser.tab.cpp"
+#line 2540 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 37: /* vardecl_item: FZ_VAR float_ti_expr_tail ':' var_par_id annotations non_array_expr_opt  */
-#line 856 "./gecode/flatzinc/parser.yxx"
+#line 1014 "./gecode/flatzinc/parser.yxx"
       {
         ParserState* pp = static_cast<ParserState*>(parm);
         bool print = (yyvsp[-1].argVec) != NULL && (yyvsp[-1].argVec)->hasAtom("output_var");
@@ -2421,11 +2579,11 @@ yyreduce:
         }
         delete (yyvsp[-1].argVec); free((yyvsp[-2].sValue));
       }
-#line 2425 "gecode/flatzinc/parser.tab.cpp"
+#line 2583 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 38: /* vardecl_item: FZ_VAR FZ_SET FZ_OF int_ti_expr_tail ':' var_par_id annotations non_array_expr_opt  */
-#line 895 "./gecode/flatzinc/parser.yxx"
+#line 1053 "./gecode/flatzinc/parser.yxx"
       {
         ParserState* pp = static_cast<ParserState*>(parm);
         bool print = (yyvsp[-1].argVec) != NULL && (yyvsp[-1].argVec)->hasAtom("output_var");
@@ -2458,11 +2616,11 @@ yyreduce:
         }
         delete (yyvsp[-1].argVec); free((yyvsp[-2].sValue));
       }
-#line 2462 "gecode/flatzinc/parser.tab.cpp"
+#line 2620 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 39: /* vardecl_item: FZ_INT ':' var_par_id annotations '=' non_array_expr  */
-#line 928 "./gecode/flatzinc/parser.yxx"
+#line 1086 "./gecode/flatzinc/parser.yxx"
       {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[0].arg)->isInt(), "Invalid int initializer");
@@ -2471,11 +2629,11 @@ yyreduce:
           "Duplicate symbol");
         delete (yyvsp[-2].argVec); free((yyvsp[-3].sValue));
       }
-#line 2475 "gecode/flatzinc/parser.tab.cpp"
+#line 2633 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 40: /* vardecl_item: FZ_FLOAT ':' var_par_id annotations '=' non_array_expr  */
-#line 937 "./gecode/flatzinc/parser.yxx"
+#line 1095 "./gecode/flatzinc/parser.yxx"
       {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[0].arg)->isFloat(), "Invalid float initializer");
@@ -2485,11 +2643,11 @@ yyreduce:
           "Duplicate symbol");
         delete (yyvsp[-2].argVec); free((yyvsp[-3].sValue));
       }
-#line 2489 "gecode/flatzinc/parser.tab.cpp"
+#line 2647 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 41: /* vardecl_item: FZ_BOOL ':' var_par_id annotations '=' non_array_expr  */
-#line 947 "./gecode/flatzinc/parser.yxx"
+#line 1105 "./gecode/flatzinc/parser.yxx"
       {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[0].arg)->isBool(), "Invalid bool initializer");
@@ -2498,11 +2656,11 @@ yyreduce:
           "Duplicate symbol");
         delete (yyvsp[-2].argVec); free((yyvsp[-3].sValue));
       }
-#line 2502 "gecode/flatzinc/parser.tab.cpp"
+#line 2660 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 42: /* vardecl_item: FZ_SET FZ_OF FZ_INT ':' var_par_id annotations '=' non_array_expr  */
-#line 956 "./gecode/flatzinc/parser.yxx"
+#line 1114 "./gecode/flatzinc/parser.yxx"
       {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[0].arg)->isSet(), "Invalid set initializer");
@@ -2514,11 +2672,11 @@ yyreduce:
         delete set;
         delete (yyvsp[-2].argVec); free((yyvsp[-3].sValue));
       }
-#line 2518 "gecode/flatzinc/parser.tab.cpp"
+#line 2676 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 43: /* vardecl_item: FZ_ARRAY '[' FZ_INT_LIT FZ_DOTDOT FZ_INT_LIT ']' FZ_OF FZ_VAR int_ti_expr_tail ':' var_par_id annotations vardecl_int_var_array_init  */
-#line 969 "./gecode/flatzinc/parser.yxx"
+#line 1127 "./gecode/flatzinc/parser.yxx"
       {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[-10].iValue)==1, "Arrays must start at 1");
@@ -2587,11 +2745,11 @@ yyreduce:
         }
         delete (yyvsp[-1].argVec); free((yyvsp[-2].sValue));
       }
-#line 2591 "gecode/flatzinc/parser.tab.cpp"
+#line 2749 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 44: /* vardecl_item: FZ_ARRAY '[' FZ_INT_LIT FZ_DOTDOT FZ_INT_LIT ']' FZ_OF FZ_VAR bool_ti_expr_tail ':' var_par_id annotations vardecl_bool_var_array_init  */
-#line 1039 "./gecode/flatzinc/parser.yxx"
+#line 1197 "./gecode/flatzinc/parser.yxx"
       {
         ParserState* pp = static_cast<ParserState*>(parm);
         bool print = (yyvsp[-1].argVec) != NULL && (yyvsp[-1].argVec)->hasCall("output_array");
@@ -2656,11 +2814,11 @@ yyreduce:
         }
         delete (yyvsp[-1].argVec); free((yyvsp[-2].sValue));
       }
-#line 2660 "gecode/flatzinc/parser.tab.cpp"
+#line 2818 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 45: /* vardecl_item: FZ_ARRAY '[' FZ_INT_LIT FZ_DOTDOT FZ_INT_LIT ']' FZ_OF FZ_VAR float_ti_expr_tail ':' var_par_id annotations vardecl_float_var_array_init  */
-#line 1106 "./gecode/flatzinc/parser.yxx"
+#line 1264 "./gecode/flatzinc/parser.yxx"
       {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[-10].iValue)==1, "Arrays must start at 1");
@@ -2729,11 +2887,11 @@ yyreduce:
         if ((yyvsp[-4].oPFloat)()) delete (yyvsp[-4].oPFloat).some();
         delete (yyvsp[-1].argVec); free((yyvsp[-2].sValue));
       }
-#line 2733 "gecode/flatzinc/parser.tab.cpp"
+#line 2891 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 46: /* vardecl_item: FZ_ARRAY '[' FZ_INT_LIT FZ_DOTDOT FZ_INT_LIT ']' FZ_OF FZ_VAR FZ_SET FZ_OF int_ti_expr_tail ':' var_par_id annotations vardecl_set_var_array_init  */
-#line 1176 "./gecode/flatzinc/parser.yxx"
+#line 1334 "./gecode/flatzinc/parser.yxx"
       {
         ParserState* pp = static_cast<ParserState*>(parm);
         bool print = (yyvsp[-1].argVec) != NULL && (yyvsp[-1].argVec)->hasCall("output_array");
@@ -2800,11 +2958,11 @@ yyreduce:
         }
         delete (yyvsp[-1].argVec); free((yyvsp[-2].sValue));
       }
-#line 2804 "gecode/flatzinc/parser.tab.cpp"
+#line 2962 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 47: /* vardecl_item: FZ_ARRAY '[' FZ_INT_LIT FZ_DOTDOT FZ_INT_LIT ']' FZ_OF FZ_INT ':' var_par_id annotations '=' '[' int_list ']'  */
-#line 1244 "./gecode/flatzinc/parser.yxx"
+#line 1402 "./gecode/flatzinc/parser.yxx"
       {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[-12].iValue)==1, "Arrays must start at 1");
@@ -2824,11 +2982,11 @@ yyreduce:
         free((yyvsp[-5].sValue));
         delete (yyvsp[-4].argVec);
       }
-#line 2828 "gecode/flatzinc/parser.tab.cpp"
+#line 2986 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 48: /* vardecl_item: FZ_ARRAY '[' FZ_INT_LIT FZ_DOTDOT FZ_INT_LIT ']' FZ_OF FZ_BOOL ':' var_par_id annotations '=' '[' bool_list ']'  */
-#line 1265 "./gecode/flatzinc/parser.yxx"
+#line 1423 "./gecode/flatzinc/parser.yxx"
       {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[-12].iValue)==1, "Arrays must start at 1");
@@ -2847,11 +3005,11 @@ yyreduce:
         free((yyvsp[-5].sValue));
         delete (yyvsp[-4].argVec);
       }
-#line 2851 "gecode/flatzinc/parser.tab.cpp"
+#line 3009 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 49: /* vardecl_item: FZ_ARRAY '[' FZ_INT_LIT FZ_DOTDOT FZ_INT_LIT ']' FZ_OF FZ_FLOAT ':' var_par_id annotations '=' '[' float_list ']'  */
-#line 1285 "./gecode/flatzinc/parser.yxx"
+#line 1443 "./gecode/flatzinc/parser.yxx"
       {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[-12].iValue)==1, "Arrays must start at 1");
@@ -2870,11 +3028,11 @@ yyreduce:
         delete (yyvsp[-1].floatSetValue);
         delete (yyvsp[-4].argVec); free((yyvsp[-5].sValue));
       }
-#line 2874 "gecode/flatzinc/parser.tab.cpp"
+#line 3032 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 50: /* vardecl_item: FZ_ARRAY '[' FZ_INT_LIT FZ_DOTDOT FZ_INT_LIT ']' FZ_OF FZ_SET FZ_OF FZ_INT ':' var_par_id annotations '=' '[' set_literal_list ']'  */
-#line 1305 "./gecode/flatzinc/parser.yxx"
+#line 1463 "./gecode/flatzinc/parser.yxx"
       {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[-14].iValue)==1, "Arrays must start at 1");
@@ -2894,19 +3052,19 @@ yyreduce:
         delete (yyvsp[-1].setValueList);
         delete (yyvsp[-4].argVec); free((yyvsp[-5].sValue));
       }
-#line 2898 "gecode/flatzinc/parser.tab.cpp"
+#line 3056 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 51: /* int_init: FZ_INT_LIT  */
-#line 1327 "./gecode/flatzinc/parser.yxx"
+#line 1485 "./gecode/flatzinc/parser.yxx"
       {
         (yyval.varSpec) = new IntVarSpec((yyvsp[0].iValue),false,false);
       }
-#line 2906 "gecode/flatzinc/parser.tab.cpp"
+#line 3064 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 52: /* int_init: var_par_id  */
-#line 1331 "./gecode/flatzinc/parser.yxx"
+#line 1489 "./gecode/flatzinc/parser.yxx"
       {
         SymbolEntry e;
         ParserState* pp = static_cast<ParserState*>(parm);
@@ -2921,11 +3079,11 @@ yyreduce:
         }
         free((yyvsp[0].sValue));
       }
-#line 2925 "gecode/flatzinc/parser.tab.cpp"
+#line 3083 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 53: /* int_init: var_par_id '[' FZ_INT_LIT ']'  */
-#line 1346 "./gecode/flatzinc/parser.yxx"
+#line 1504 "./gecode/flatzinc/parser.yxx"
       {
         vector<int> v;
         SymbolEntry e;
@@ -2946,47 +3104,47 @@ yyreduce:
         }
         free((yyvsp[-3].sValue));
       }
-#line 2950 "gecode/flatzinc/parser.tab.cpp"
+#line 3108 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 54: /* int_init_list: %empty  */
-#line 1369 "./gecode/flatzinc/parser.yxx"
+#line 1527 "./gecode/flatzinc/parser.yxx"
       { (yyval.varSpecVec) = new vector<VarSpec*>(0); }
-#line 2956 "gecode/flatzinc/parser.tab.cpp"
+#line 3114 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 55: /* int_init_list: int_init_list_head list_tail  */
-#line 1371 "./gecode/flatzinc/parser.yxx"
+#line 1529 "./gecode/flatzinc/parser.yxx"
       { (yyval.varSpecVec) = (yyvsp[-1].varSpecVec); }
-#line 2962 "gecode/flatzinc/parser.tab.cpp"
+#line 3120 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 56: /* int_init_list_head: int_init  */
-#line 1375 "./gecode/flatzinc/parser.yxx"
+#line 1533 "./gecode/flatzinc/parser.yxx"
       { (yyval.varSpecVec) = new vector<VarSpec*>(1); (*(yyval.varSpecVec))[0] = (yyvsp[0].varSpec); }
-#line 2968 "gecode/flatzinc/parser.tab.cpp"
+#line 3126 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 57: /* int_init_list_head: int_init_list_head ',' int_init  */
-#line 1377 "./gecode/flatzinc/parser.yxx"
+#line 1535 "./gecode/flatzinc/parser.yxx"
       { (yyval.varSpecVec) = (yyvsp[-2].varSpecVec); (yyval.varSpecVec)->push_back((yyvsp[0].varSpec)); }
-#line 2974 "gecode/flatzinc/parser.tab.cpp"
+#line 3132 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 60: /* int_var_array_literal: '[' int_init_list ']'  */
-#line 1382 "./gecode/flatzinc/parser.yxx"
+#line 1540 "./gecode/flatzinc/parser.yxx"
       { (yyval.varSpecVec) = (yyvsp[-1].varSpecVec); }
-#line 2980 "gecode/flatzinc/parser.tab.cpp"
+#line 3138 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 61: /* float_init: FZ_FLOAT_LIT  */
-#line 1386 "./gecode/flatzinc/parser.yxx"
+#line 1544 "./gecode/flatzinc/parser.yxx"
       { (yyval.varSpec) = new FloatVarSpec((yyvsp[0].dValue),false,false); }
-#line 2986 "gecode/flatzinc/parser.tab.cpp"
+#line 3144 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 62: /* float_init: var_par_id  */
-#line 1388 "./gecode/flatzinc/parser.yxx"
+#line 1546 "./gecode/flatzinc/parser.yxx"
       {
         SymbolEntry e;
         ParserState* pp = static_cast<ParserState*>(parm);
@@ -3001,11 +3159,11 @@ yyreduce:
         }
         free((yyvsp[0].sValue));
       }
-#line 3005 "gecode/flatzinc/parser.tab.cpp"
+#line 3163 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 63: /* float_init: var_par_id '[' FZ_INT_LIT ']'  */
-#line 1403 "./gecode/flatzinc/parser.yxx"
+#line 1561 "./gecode/flatzinc/parser.yxx"
       {
         SymbolEntry e;
         ParserState* pp = static_cast<ParserState*>(parm);
@@ -3025,47 +3183,47 @@ yyreduce:
         }
         free((yyvsp[-3].sValue));
       }
-#line 3029 "gecode/flatzinc/parser.tab.cpp"
+#line 3187 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 64: /* float_init_list: %empty  */
-#line 1425 "./gecode/flatzinc/parser.yxx"
+#line 1583 "./gecode/flatzinc/parser.yxx"
       { (yyval.varSpecVec) = new vector<VarSpec*>(0); }
-#line 3035 "gecode/flatzinc/parser.tab.cpp"
+#line 3193 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 65: /* float_init_list: float_init_list_head list_tail  */
-#line 1427 "./gecode/flatzinc/parser.yxx"
+#line 1585 "./gecode/flatzinc/parser.yxx"
       { (yyval.varSpecVec) = (yyvsp[-1].varSpecVec); }
-#line 3041 "gecode/flatzinc/parser.tab.cpp"
+#line 3199 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 66: /* float_init_list_head: float_init  */
-#line 1431 "./gecode/flatzinc/parser.yxx"
+#line 1589 "./gecode/flatzinc/parser.yxx"
       { (yyval.varSpecVec) = new vector<VarSpec*>(1); (*(yyval.varSpecVec))[0] = (yyvsp[0].varSpec); }
-#line 3047 "gecode/flatzinc/parser.tab.cpp"
+#line 3205 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 67: /* float_init_list_head: float_init_list_head ',' float_init  */
-#line 1433 "./gecode/flatzinc/parser.yxx"
+#line 1591 "./gecode/flatzinc/parser.yxx"
       { (yyval.varSpecVec) = (yyvsp[-2].varSpecVec); (yyval.varSpecVec)->push_back((yyvsp[0].varSpec)); }
-#line 3053 "gecode/flatzinc/parser.tab.cpp"
+#line 3211 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 68: /* float_var_array_literal: '[' float_init_list ']'  */
-#line 1437 "./gecode/flatzinc/parser.yxx"
+#line 1595 "./gecode/flatzinc/parser.yxx"
       { (yyval.varSpecVec) = (yyvsp[-1].varSpecVec); }
-#line 3059 "gecode/flatzinc/parser.tab.cpp"
+#line 3217 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 69: /* bool_init: FZ_BOOL_LIT  */
-#line 1441 "./gecode/flatzinc/parser.yxx"
+#line 1599 "./gecode/flatzinc/parser.yxx"
       { (yyval.varSpec) = new BoolVarSpec((yyvsp[0].iValue),false,false); }
-#line 3065 "gecode/flatzinc/parser.tab.cpp"
+#line 3223 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 70: /* bool_init: var_par_id  */
-#line 1443 "./gecode/flatzinc/parser.yxx"
+#line 1601 "./gecode/flatzinc/parser.yxx"
       {
         SymbolEntry e;
         ParserState* pp = static_cast<ParserState*>(parm);
@@ -3080,11 +3238,11 @@ yyreduce:
         }
         free((yyvsp[0].sValue));
       }
-#line 3084 "gecode/flatzinc/parser.tab.cpp"
+#line 3242 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 71: /* bool_init: var_par_id '[' FZ_INT_LIT ']'  */
-#line 1458 "./gecode/flatzinc/parser.yxx"
+#line 1616 "./gecode/flatzinc/parser.yxx"
       {
         SymbolEntry e;
         ParserState* pp = static_cast<ParserState*>(parm);
@@ -3104,47 +3262,47 @@ yyreduce:
         }
         free((yyvsp[-3].sValue));
       }
-#line 3108 "gecode/flatzinc/parser.tab.cpp"
+#line 3266 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 72: /* bool_init_list: %empty  */
-#line 1480 "./gecode/flatzinc/parser.yxx"
+#line 1638 "./gecode/flatzinc/parser.yxx"
       { (yyval.varSpecVec) = new vector<VarSpec*>(0); }
-#line 3114 "gecode/flatzinc/parser.tab.cpp"
+#line 3272 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 73: /* bool_init_list: bool_init_list_head list_tail  */
-#line 1482 "./gecode/flatzinc/parser.yxx"
+#line 1640 "./gecode/flatzinc/parser.yxx"
       { (yyval.varSpecVec) = (yyvsp[-1].varSpecVec); }
-#line 3120 "gecode/flatzinc/parser.tab.cpp"
+#line 3278 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 74: /* bool_init_list_head: bool_init  */
-#line 1486 "./gecode/flatzinc/parser.yxx"
+#line 1644 "./gecode/flatzinc/parser.yxx"
       { (yyval.varSpecVec) = new vector<VarSpec*>(1); (*(yyval.varSpecVec))[0] = (yyvsp[0].varSpec); }
-#line 3126 "gecode/flatzinc/parser.tab.cpp"
+#line 3284 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 75: /* bool_init_list_head: bool_init_list_head ',' bool_init  */
-#line 1488 "./gecode/flatzinc/parser.yxx"
+#line 1646 "./gecode/flatzinc/parser.yxx"
       { (yyval.varSpecVec) = (yyvsp[-2].varSpecVec); (yyval.varSpecVec)->push_back((yyvsp[0].varSpec)); }
-#line 3132 "gecode/flatzinc/parser.tab.cpp"
+#line 3290 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 76: /* bool_var_array_literal: '[' bool_init_list ']'  */
-#line 1490 "./gecode/flatzinc/parser.yxx"
+#line 1648 "./gecode/flatzinc/parser.yxx"
                                                 { (yyval.varSpecVec) = (yyvsp[-1].varSpecVec); }
-#line 3138 "gecode/flatzinc/parser.tab.cpp"
+#line 3296 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 77: /* set_init: set_literal  */
-#line 1494 "./gecode/flatzinc/parser.yxx"
+#line 1652 "./gecode/flatzinc/parser.yxx"
       { (yyval.varSpec) = new SetVarSpec((yyvsp[0].setLit),false,false); }
-#line 3144 "gecode/flatzinc/parser.tab.cpp"
+#line 3302 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 78: /* set_init: var_par_id  */
-#line 1496 "./gecode/flatzinc/parser.yxx"
+#line 1654 "./gecode/flatzinc/parser.yxx"
       {
         ParserState* pp = static_cast<ParserState*>(parm);
         SymbolEntry e;
@@ -3159,11 +3317,11 @@ yyreduce:
         }
         free((yyvsp[0].sValue));
       }
-#line 3163 "gecode/flatzinc/parser.tab.cpp"
+#line 3321 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 79: /* set_init: var_par_id '[' FZ_INT_LIT ']'  */
-#line 1511 "./gecode/flatzinc/parser.yxx"
+#line 1669 "./gecode/flatzinc/parser.yxx"
       {
         SymbolEntry e;
         ParserState* pp = static_cast<ParserState*>(parm);
@@ -3183,89 +3341,89 @@ yyreduce:
         }
         free((yyvsp[-3].sValue));
       }
-#line 3187 "gecode/flatzinc/parser.tab.cpp"
+#line 3345 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 80: /* set_init_list: %empty  */
-#line 1533 "./gecode/flatzinc/parser.yxx"
+#line 1691 "./gecode/flatzinc/parser.yxx"
       { (yyval.varSpecVec) = new vector<VarSpec*>(0); }
-#line 3193 "gecode/flatzinc/parser.tab.cpp"
+#line 3351 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 81: /* set_init_list: set_init_list_head list_tail  */
-#line 1535 "./gecode/flatzinc/parser.yxx"
+#line 1693 "./gecode/flatzinc/parser.yxx"
       { (yyval.varSpecVec) = (yyvsp[-1].varSpecVec); }
-#line 3199 "gecode/flatzinc/parser.tab.cpp"
+#line 3357 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 82: /* set_init_list_head: set_init  */
-#line 1539 "./gecode/flatzinc/parser.yxx"
+#line 1697 "./gecode/flatzinc/parser.yxx"
       { (yyval.varSpecVec) = new vector<VarSpec*>(1); (*(yyval.varSpecVec))[0] = (yyvsp[0].varSpec); }
-#line 3205 "gecode/flatzinc/parser.tab.cpp"
+#line 3363 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 83: /* set_init_list_head: set_init_list_head ',' set_init  */
-#line 1541 "./gecode/flatzinc/parser.yxx"
+#line 1699 "./gecode/flatzinc/parser.yxx"
       { (yyval.varSpecVec) = (yyvsp[-2].varSpecVec); (yyval.varSpecVec)->push_back((yyvsp[0].varSpec)); }
-#line 3211 "gecode/flatzinc/parser.tab.cpp"
+#line 3369 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 84: /* set_var_array_literal: '[' set_init_list ']'  */
-#line 1544 "./gecode/flatzinc/parser.yxx"
+#line 1702 "./gecode/flatzinc/parser.yxx"
       { (yyval.varSpecVec) = (yyvsp[-1].varSpecVec); }
-#line 3217 "gecode/flatzinc/parser.tab.cpp"
+#line 3375 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 85: /* vardecl_int_var_array_init: %empty  */
-#line 1548 "./gecode/flatzinc/parser.yxx"
+#line 1706 "./gecode/flatzinc/parser.yxx"
       { (yyval.oVarSpecVec) = Option<vector<VarSpec*>* >::none(); }
-#line 3223 "gecode/flatzinc/parser.tab.cpp"
+#line 3381 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 86: /* vardecl_int_var_array_init: '=' int_var_array_literal  */
-#line 1550 "./gecode/flatzinc/parser.yxx"
+#line 1708 "./gecode/flatzinc/parser.yxx"
       { (yyval.oVarSpecVec) = Option<vector<VarSpec*>* >::some((yyvsp[0].varSpecVec)); }
-#line 3229 "gecode/flatzinc/parser.tab.cpp"
+#line 3387 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 87: /* vardecl_bool_var_array_init: %empty  */
-#line 1554 "./gecode/flatzinc/parser.yxx"
+#line 1712 "./gecode/flatzinc/parser.yxx"
       { (yyval.oVarSpecVec) = Option<vector<VarSpec*>* >::none(); }
-#line 3235 "gecode/flatzinc/parser.tab.cpp"
+#line 3393 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 88: /* vardecl_bool_var_array_init: '=' bool_var_array_literal  */
-#line 1556 "./gecode/flatzinc/parser.yxx"
+#line 1714 "./gecode/flatzinc/parser.yxx"
       { (yyval.oVarSpecVec) = Option<vector<VarSpec*>* >::some((yyvsp[0].varSpecVec)); }
-#line 3241 "gecode/flatzinc/parser.tab.cpp"
+#line 3399 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 89: /* vardecl_float_var_array_init: %empty  */
-#line 1560 "./gecode/flatzinc/parser.yxx"
+#line 1718 "./gecode/flatzinc/parser.yxx"
       { (yyval.oVarSpecVec) = Option<vector<VarSpec*>* >::none(); }
-#line 3247 "gecode/flatzinc/parser.tab.cpp"
+#line 3405 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 90: /* vardecl_float_var_array_init: '=' float_var_array_literal  */
-#line 1562 "./gecode/flatzinc/parser.yxx"
+#line 1720 "./gecode/flatzinc/parser.yxx"
       { (yyval.oVarSpecVec) = Option<vector<VarSpec*>* >::some((yyvsp[0].varSpecVec)); }
-#line 3253 "gecode/flatzinc/parser.tab.cpp"
+#line 3411 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 91: /* vardecl_set_var_array_init: %empty  */
-#line 1566 "./gecode/flatzinc/parser.yxx"
+#line 1724 "./gecode/flatzinc/parser.yxx"
       { (yyval.oVarSpecVec) = Option<vector<VarSpec*>* >::none(); }
-#line 3259 "gecode/flatzinc/parser.tab.cpp"
+#line 3417 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 92: /* vardecl_set_var_array_init: '=' set_var_array_literal  */
-#line 1568 "./gecode/flatzinc/parser.yxx"
+#line 1726 "./gecode/flatzinc/parser.yxx"
       { (yyval.oVarSpecVec) = Option<vector<VarSpec*>* >::some((yyvsp[0].varSpecVec)); }
-#line 3265 "gecode/flatzinc/parser.tab.cpp"
+#line 3423 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 93: /* constraint_item: FZ_CONSTRAINT FZ_ID '(' flat_expr_list ')' annotations  */
-#line 1572 "./gecode/flatzinc/parser.yxx"
+#line 1730 "./gecode/flatzinc/parser.yxx"
       {
         ParserState *pp = static_cast<ParserState*>(parm);
         if (!pp->hadError) {
@@ -3325,7 +3483,7 @@ yyreduce:
             int base = getBaseFloatVar(pp,(yyvsp[-2].argVec)->a[2]->getFloatVar());
             pp->uniform_float.emplace_back( (yyvsp[-2].argVec)->a[0]->getFloat(), (yyvsp[-2].argVec)->a[1]->getFloat(), base );
 #endif
-          } else if (cid=="int_eq" && (yyvsp[-2].argVec)->a[0]->isIntVar() && (yyvsp[-2].argVec)->a[1]->isIntVar()) {
+          } else if (cid=="int_eq" && !pp->varsCreated && (yyvsp[-2].argVec)->a[0]->isIntVar() && (yyvsp[-2].argVec)->a[1]->isIntVar()) {
             int base0 = getBaseIntVar(pp,(yyvsp[-2].argVec)->a[0]->getIntVar());
             int base1 = getBaseIntVar(pp,(yyvsp[-2].argVec)->a[1]->getIntVar());
             if (base0 > base1) {
@@ -3350,7 +3508,7 @@ yyreduce:
               ivs1->alias = true;
               ivs1->i = base0;
             }
-          } else if (cid=="bool_eq" && (yyvsp[-2].argVec)->a[0]->isBoolVar() && (yyvsp[-2].argVec)->a[1]->isBoolVar()) {
+          } else if (cid=="bool_eq" && !pp->varsCreated && (yyvsp[-2].argVec)->a[0]->isBoolVar() && (yyvsp[-2].argVec)->a[1]->isBoolVar()) {
             int base0 = getBaseBoolVar(pp,(yyvsp[-2].argVec)->a[0]->getBoolVar());
             int base1 = getBaseBoolVar(pp,(yyvsp[-2].argVec)->a[1]->getBoolVar());
             if (base0 > base1) {
@@ -3375,7 +3533,7 @@ yyreduce:
               ivs1->alias = true;
               ivs1->i = base0;
             }
-          } else if (cid=="float_eq" && (yyvsp[-2].argVec)->a[0]->isFloatVar() && (yyvsp[-2].argVec)->a[1]->isFloatVar()) {
+          } else if (cid=="float_eq" && !pp->varsCreated && (yyvsp[-2].argVec)->a[0]->isFloatVar() && (yyvsp[-2].argVec)->a[1]->isFloatVar()) {
             int base0 = getBaseFloatVar(pp,(yyvsp[-2].argVec)->a[0]->getFloatVar());
             int base1 = getBaseFloatVar(pp,(yyvsp[-2].argVec)->a[1]->getFloatVar());
             if (base0 > base1) {
@@ -3393,7 +3551,7 @@ yyreduce:
                 ivs1->domain = Option<std::pair<double,double> >::none();
               }
             }
-          } else if (cid=="set_eq" && (yyvsp[-2].argVec)->a[0]->isSetVar() && (yyvsp[-2].argVec)->a[1]->isSetVar()) {
+          } else if (cid=="set_eq" && !pp->varsCreated && (yyvsp[-2].argVec)->a[0]->isSetVar() && (yyvsp[-2].argVec)->a[1]->isSetVar()) {
             int base0 = getBaseSetVar(pp,(yyvsp[-2].argVec)->a[0]->getSetVar());
             int base1 = getBaseSetVar(pp,(yyvsp[-2].argVec)->a[1]->getSetVar());
             if (base0 > base1) {
@@ -3421,87 +3579,72 @@ yyreduce:
           } else if ( (cid=="int_le" || cid=="int_lt" || cid=="int_ge" || cid=="int_gt"  ||
                        cid=="int_eq" || cid=="int_ne") &&
                       ((yyvsp[-2].argVec)->a[0]->isInt() || (yyvsp[-2].argVec)->a[1]->isInt()) ) {
-            pp->domainConstraints.push_back(new ConExpr((yyvsp[-4].sValue), (yyvsp[-2].argVec), (yyvsp[0].argVec)));
+            addConstraint(pp, new ConExpr((yyvsp[-4].sValue), (yyvsp[-2].argVec), (yyvsp[0].argVec)), true);
           } else if ( cid=="set_in" && ((yyvsp[-2].argVec)->a[0]->isSet() || (yyvsp[-2].argVec)->a[1]->isSet()) ) {
-            pp->domainConstraints.push_back(new ConExpr((yyvsp[-4].sValue), (yyvsp[-2].argVec), (yyvsp[0].argVec)));
+            addConstraint(pp, new ConExpr((yyvsp[-4].sValue), (yyvsp[-2].argVec), (yyvsp[0].argVec)), true);
           } else {
-            pp->constraints.push_back(new ConExpr((yyvsp[-4].sValue), (yyvsp[-2].argVec), (yyvsp[0].argVec)));
+            addConstraint(pp, new ConExpr((yyvsp[-4].sValue), (yyvsp[-2].argVec), (yyvsp[0].argVec)), false);
           }
         }
         free((yyvsp[-4].sValue));
       }
-#line 3434 "gecode/flatzinc/parser.tab.cpp"
+#line 3592 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 94: /* solve_item: FZ_SOLVE annotations FZ_SATISFY  */
-#line 1738 "./gecode/flatzinc/parser.yxx"
+#line 1896 "./gecode/flatzinc/parser.yxx"
       {
         ParserState *pp = static_cast<ParserState*>(parm);
-        initfg(pp);
-        if (!pp->hadError) {
-          try {
-            pp->fg->solve((yyvsp[-1].argVec));
-          } catch (Gecode::FlatZinc::Error& e) {
-            yyerror(pp, e.toString().c_str());
-          }
-        } else {
-          delete (yyvsp[-1].argVec);
-        }
+        SolveItem si;
+        si.kind = SolveItem::SI_SATISFY;
+        si.objective = 0;
+        si.ann = (yyvsp[-1].argVec);
+        solvefg(pp, si);
       }
-#line 3452 "gecode/flatzinc/parser.tab.cpp"
+#line 3605 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 95: /* solve_item: FZ_SOLVE annotations minmax solve_expr  */
-#line 1752 "./gecode/flatzinc/parser.yxx"
+#line 1905 "./gecode/flatzinc/parser.yxx"
       {
         ParserState *pp = static_cast<ParserState*>(parm);
-        initfg(pp);
-        if (!pp->hadError) {
-          try {
-            int v = (yyvsp[0].iValue) < 0 ? (-(yyvsp[0].iValue)-1) : (yyvsp[0].iValue);
-            bool vi = (yyvsp[0].iValue) >= 0;
-            if ((yyvsp[-1].bValue))
-              pp->fg->minimize(v,vi,(yyvsp[-2].argVec));
-            else
-              pp->fg->maximize(v,vi,(yyvsp[-2].argVec));
-          } catch (Gecode::FlatZinc::Error& e) {
-            yyerror(pp, e.toString().c_str());
-          }
-        } else {
-          delete (yyvsp[-2].argVec);
-        }
+        SolveItem si;
+        si.kind = (yyvsp[-1].bValue) ? SolveItem::SI_MINIMIZE : SolveItem::SI_MAXIMIZE;
+        si.objective = (yyvsp[0].iValue);
+        si.ann = (yyvsp[-2].argVec);
+        solvefg(pp, si);
       }
-#line 3475 "gecode/flatzinc/parser.tab.cpp"
+#line 3618 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 96: /* int_ti_expr_tail: FZ_INT  */
-#line 1777 "./gecode/flatzinc/parser.yxx"
+#line 1920 "./gecode/flatzinc/parser.yxx"
       { (yyval.oSet) = Option<AST::SetLit* >::none(); }
-#line 3481 "gecode/flatzinc/parser.tab.cpp"
+#line 3624 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 97: /* int_ti_expr_tail: '{' int_list '}'  */
-#line 1779 "./gecode/flatzinc/parser.yxx"
+#line 1922 "./gecode/flatzinc/parser.yxx"
       { (yyval.oSet) = Option<AST::SetLit* >::some(new AST::SetLit(*(yyvsp[-1].setValue))); }
-#line 3487 "gecode/flatzinc/parser.tab.cpp"
+#line 3630 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 98: /* int_ti_expr_tail: FZ_INT_LIT FZ_DOTDOT FZ_INT_LIT  */
-#line 1781 "./gecode/flatzinc/parser.yxx"
+#line 1924 "./gecode/flatzinc/parser.yxx"
       {
         (yyval.oSet) = Option<AST::SetLit* >::some(new AST::SetLit((yyvsp[-2].iValue), (yyvsp[0].iValue)));
       }
-#line 3495 "gecode/flatzinc/parser.tab.cpp"
+#line 3638 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 99: /* bool_ti_expr_tail: FZ_BOOL  */
-#line 1787 "./gecode/flatzinc/parser.yxx"
+#line 1930 "./gecode/flatzinc/parser.yxx"
       { (yyval.oSet) = Option<AST::SetLit* >::none(); }
-#line 3501 "gecode/flatzinc/parser.tab.cpp"
+#line 3644 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 100: /* bool_ti_expr_tail: '{' bool_list_head list_tail '}'  */
-#line 1789 "./gecode/flatzinc/parser.yxx"
+#line 1932 "./gecode/flatzinc/parser.yxx"
       { bool haveTrue = false;
         bool haveFalse = false;
         for (int i=(yyvsp[-2].setValue)->size(); i--;) {
@@ -3512,192 +3655,192 @@ yyreduce:
         (yyval.oSet) = Option<AST::SetLit* >::some(
           new AST::SetLit(!haveFalse,haveTrue));
       }
-#line 3516 "gecode/flatzinc/parser.tab.cpp"
+#line 3659 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 101: /* float_ti_expr_tail: FZ_FLOAT  */
-#line 1802 "./gecode/flatzinc/parser.yxx"
+#line 1945 "./gecode/flatzinc/parser.yxx"
       { (yyval.oPFloat) = Option<std::pair<double,double>* >::none(); }
-#line 3522 "gecode/flatzinc/parser.tab.cpp"
+#line 3665 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 102: /* float_ti_expr_tail: FZ_FLOAT_LIT FZ_DOTDOT FZ_FLOAT_LIT  */
-#line 1804 "./gecode/flatzinc/parser.yxx"
+#line 1947 "./gecode/flatzinc/parser.yxx"
       { std::pair<double,double>* dom = new std::pair<double,double>((yyvsp[-2].dValue),(yyvsp[0].dValue));
         (yyval.oPFloat) = Option<std::pair<double,double>* >::some(dom); }
-#line 3529 "gecode/flatzinc/parser.tab.cpp"
+#line 3672 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 103: /* set_literal: '{' int_list '}'  */
-#line 1813 "./gecode/flatzinc/parser.yxx"
+#line 1956 "./gecode/flatzinc/parser.yxx"
       { (yyval.setLit) = new AST::SetLit(*(yyvsp[-1].setValue)); }
-#line 3535 "gecode/flatzinc/parser.tab.cpp"
+#line 3678 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 104: /* set_literal: FZ_INT_LIT FZ_DOTDOT FZ_INT_LIT  */
-#line 1815 "./gecode/flatzinc/parser.yxx"
+#line 1958 "./gecode/flatzinc/parser.yxx"
       { (yyval.setLit) = new AST::SetLit((yyvsp[-2].iValue), (yyvsp[0].iValue)); }
-#line 3541 "gecode/flatzinc/parser.tab.cpp"
+#line 3684 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 105: /* int_list: %empty  */
-#line 1821 "./gecode/flatzinc/parser.yxx"
+#line 1964 "./gecode/flatzinc/parser.yxx"
       { (yyval.setValue) = new vector<int>(0); }
-#line 3547 "gecode/flatzinc/parser.tab.cpp"
+#line 3690 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 106: /* int_list: int_list_head list_tail  */
-#line 1823 "./gecode/flatzinc/parser.yxx"
+#line 1966 "./gecode/flatzinc/parser.yxx"
       { (yyval.setValue) = (yyvsp[-1].setValue); }
-#line 3553 "gecode/flatzinc/parser.tab.cpp"
+#line 3696 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 107: /* int_list_head: FZ_INT_LIT  */
-#line 1827 "./gecode/flatzinc/parser.yxx"
+#line 1970 "./gecode/flatzinc/parser.yxx"
       { (yyval.setValue) = new vector<int>(1); (*(yyval.setValue))[0] = (yyvsp[0].iValue); }
-#line 3559 "gecode/flatzinc/parser.tab.cpp"
+#line 3702 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 108: /* int_list_head: int_list_head ',' FZ_INT_LIT  */
-#line 1829 "./gecode/flatzinc/parser.yxx"
+#line 1972 "./gecode/flatzinc/parser.yxx"
       { (yyval.setValue) = (yyvsp[-2].setValue); (yyval.setValue)->push_back((yyvsp[0].iValue)); }
-#line 3565 "gecode/flatzinc/parser.tab.cpp"
+#line 3708 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 109: /* bool_list: %empty  */
-#line 1833 "./gecode/flatzinc/parser.yxx"
+#line 1976 "./gecode/flatzinc/parser.yxx"
       { (yyval.setValue) = new vector<int>(0); }
-#line 3571 "gecode/flatzinc/parser.tab.cpp"
+#line 3714 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 110: /* bool_list: bool_list_head list_tail  */
-#line 1835 "./gecode/flatzinc/parser.yxx"
+#line 1978 "./gecode/flatzinc/parser.yxx"
       { (yyval.setValue) = (yyvsp[-1].setValue); }
-#line 3577 "gecode/flatzinc/parser.tab.cpp"
+#line 3720 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 111: /* bool_list_head: FZ_BOOL_LIT  */
-#line 1839 "./gecode/flatzinc/parser.yxx"
+#line 1982 "./gecode/flatzinc/parser.yxx"
       { (yyval.setValue) = new vector<int>(1); (*(yyval.setValue))[0] = (yyvsp[0].iValue); }
-#line 3583 "gecode/flatzinc/parser.tab.cpp"
+#line 3726 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 112: /* bool_list_head: bool_list_head ',' FZ_BOOL_LIT  */
-#line 1841 "./gecode/flatzinc/parser.yxx"
+#line 1984 "./gecode/flatzinc/parser.yxx"
       { (yyval.setValue) = (yyvsp[-2].setValue); (yyval.setValue)->push_back((yyvsp[0].iValue)); }
-#line 3589 "gecode/flatzinc/parser.tab.cpp"
+#line 3732 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 113: /* float_list: %empty  */
-#line 1845 "./gecode/flatzinc/parser.yxx"
+#line 1988 "./gecode/flatzinc/parser.yxx"
       { (yyval.floatSetValue) = new vector<double>(0); }
-#line 3595 "gecode/flatzinc/parser.tab.cpp"
+#line 3738 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 114: /* float_list: float_list_head list_tail  */
-#line 1847 "./gecode/flatzinc/parser.yxx"
+#line 1990 "./gecode/flatzinc/parser.yxx"
       { (yyval.floatSetValue) = (yyvsp[-1].floatSetValue); }
-#line 3601 "gecode/flatzinc/parser.tab.cpp"
+#line 3744 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 115: /* float_list_head: FZ_FLOAT_LIT  */
-#line 1851 "./gecode/flatzinc/parser.yxx"
+#line 1994 "./gecode/flatzinc/parser.yxx"
       { (yyval.floatSetValue) = new vector<double>(1); (*(yyval.floatSetValue))[0] = (yyvsp[0].dValue); }
-#line 3607 "gecode/flatzinc/parser.tab.cpp"
+#line 3750 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 116: /* float_list_head: float_list_head ',' FZ_FLOAT_LIT  */
-#line 1853 "./gecode/flatzinc/parser.yxx"
+#line 1996 "./gecode/flatzinc/parser.yxx"
       { (yyval.floatSetValue) = (yyvsp[-2].floatSetValue); (yyval.floatSetValue)->push_back((yyvsp[0].dValue)); }
-#line 3613 "gecode/flatzinc/parser.tab.cpp"
+#line 3756 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 117: /* set_literal_list: %empty  */
-#line 1857 "./gecode/flatzinc/parser.yxx"
+#line 2000 "./gecode/flatzinc/parser.yxx"
       { (yyval.setValueList) = new vector<AST::SetLit>(0); }
-#line 3619 "gecode/flatzinc/parser.tab.cpp"
+#line 3762 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 118: /* set_literal_list: set_literal_list_head list_tail  */
-#line 1859 "./gecode/flatzinc/parser.yxx"
+#line 2002 "./gecode/flatzinc/parser.yxx"
       { (yyval.setValueList) = (yyvsp[-1].setValueList); }
-#line 3625 "gecode/flatzinc/parser.tab.cpp"
+#line 3768 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 119: /* set_literal_list_head: set_literal  */
-#line 1863 "./gecode/flatzinc/parser.yxx"
+#line 2006 "./gecode/flatzinc/parser.yxx"
       { (yyval.setValueList) = new vector<AST::SetLit>(1); (*(yyval.setValueList))[0] = *(yyvsp[0].setLit); delete (yyvsp[0].setLit); }
-#line 3631 "gecode/flatzinc/parser.tab.cpp"
+#line 3774 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 120: /* set_literal_list_head: set_literal_list_head ',' set_literal  */
-#line 1865 "./gecode/flatzinc/parser.yxx"
+#line 2008 "./gecode/flatzinc/parser.yxx"
       { (yyval.setValueList) = (yyvsp[-2].setValueList); (yyval.setValueList)->push_back(*(yyvsp[0].setLit)); delete (yyvsp[0].setLit); }
-#line 3637 "gecode/flatzinc/parser.tab.cpp"
+#line 3780 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 121: /* flat_expr_list: flat_expr  */
-#line 1873 "./gecode/flatzinc/parser.yxx"
+#line 2016 "./gecode/flatzinc/parser.yxx"
       { (yyval.argVec) = new AST::Array((yyvsp[0].arg)); }
-#line 3643 "gecode/flatzinc/parser.tab.cpp"
+#line 3786 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 122: /* flat_expr_list: flat_expr_list ',' flat_expr  */
-#line 1875 "./gecode/flatzinc/parser.yxx"
+#line 2018 "./gecode/flatzinc/parser.yxx"
       { (yyval.argVec) = (yyvsp[-2].argVec); (yyval.argVec)->append((yyvsp[0].arg)); }
-#line 3649 "gecode/flatzinc/parser.tab.cpp"
+#line 3792 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 123: /* flat_expr: non_array_expr  */
-#line 1879 "./gecode/flatzinc/parser.yxx"
+#line 2022 "./gecode/flatzinc/parser.yxx"
       { (yyval.arg) = (yyvsp[0].arg); }
-#line 3655 "gecode/flatzinc/parser.tab.cpp"
+#line 3798 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 124: /* flat_expr: '[' non_array_expr_list ']'  */
-#line 1881 "./gecode/flatzinc/parser.yxx"
+#line 2024 "./gecode/flatzinc/parser.yxx"
       { (yyval.arg) = (yyvsp[-1].argVec); }
-#line 3661 "gecode/flatzinc/parser.tab.cpp"
+#line 3804 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 125: /* non_array_expr_opt: %empty  */
-#line 1885 "./gecode/flatzinc/parser.yxx"
+#line 2028 "./gecode/flatzinc/parser.yxx"
       { (yyval.oArg) = Option<AST::Node*>::none(); }
-#line 3667 "gecode/flatzinc/parser.tab.cpp"
+#line 3810 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 126: /* non_array_expr_opt: '=' non_array_expr  */
-#line 1887 "./gecode/flatzinc/parser.yxx"
+#line 2030 "./gecode/flatzinc/parser.yxx"
       { (yyval.oArg) = Option<AST::Node*>::some((yyvsp[0].arg)); }
-#line 3673 "gecode/flatzinc/parser.tab.cpp"
+#line 3816 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 127: /* non_array_expr: FZ_BOOL_LIT  */
-#line 1891 "./gecode/flatzinc/parser.yxx"
+#line 2034 "./gecode/flatzinc/parser.yxx"
       { (yyval.arg) = new AST::BoolLit((yyvsp[0].iValue)); }
-#line 3679 "gecode/flatzinc/parser.tab.cpp"
+#line 3822 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 128: /* non_array_expr: FZ_INT_LIT  */
-#line 1893 "./gecode/flatzinc/parser.yxx"
+#line 2036 "./gecode/flatzinc/parser.yxx"
       { (yyval.arg) = new AST::IntLit((yyvsp[0].iValue)); }
-#line 3685 "gecode/flatzinc/parser.tab.cpp"
+#line 3828 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 129: /* non_array_expr: FZ_FLOAT_LIT  */
-#line 1895 "./gecode/flatzinc/parser.yxx"
+#line 2038 "./gecode/flatzinc/parser.yxx"
       { (yyval.arg) = new AST::FloatLit((yyvsp[0].dValue)); }
-#line 3691 "gecode/flatzinc/parser.tab.cpp"
+#line 3834 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 130: /* non_array_expr: set_literal  */
-#line 1897 "./gecode/flatzinc/parser.yxx"
+#line 2040 "./gecode/flatzinc/parser.yxx"
       { (yyval.arg) = (yyvsp[0].setLit); }
-#line 3697 "gecode/flatzinc/parser.tab.cpp"
+#line 3840 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 131: /* non_array_expr: var_par_id  */
-#line 1899 "./gecode/flatzinc/parser.yxx"
+#line 2042 "./gecode/flatzinc/parser.yxx"
       {
         ParserState* pp = static_cast<ParserState*>(parm);
         SymbolEntry e;
@@ -3793,11 +3936,11 @@ yyreduce:
         }
         free((yyvsp[0].sValue));
       }
-#line 3797 "gecode/flatzinc/parser.tab.cpp"
+#line 3940 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 132: /* non_array_expr: var_par_id '[' non_array_expr ']'  */
-#line 1995 "./gecode/flatzinc/parser.yxx"
+#line 2138 "./gecode/flatzinc/parser.yxx"
       {
         ParserState* pp = static_cast<ParserState*>(parm);
         int i = -1;
@@ -3809,35 +3952,35 @@ yyreduce:
         delete (yyvsp[-1].arg);
         free((yyvsp[-3].sValue));
       }
-#line 3813 "gecode/flatzinc/parser.tab.cpp"
+#line 3956 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 133: /* non_array_expr_list: %empty  */
-#line 2009 "./gecode/flatzinc/parser.yxx"
+#line 2152 "./gecode/flatzinc/parser.yxx"
       { (yyval.argVec) = new AST::Array(0); }
-#line 3819 "gecode/flatzinc/parser.tab.cpp"
+#line 3962 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 134: /* non_array_expr_list: non_array_expr_list_head list_tail  */
-#line 2011 "./gecode/flatzinc/parser.yxx"
+#line 2154 "./gecode/flatzinc/parser.yxx"
       { (yyval.argVec) = (yyvsp[-1].argVec); }
-#line 3825 "gecode/flatzinc/parser.tab.cpp"
+#line 3968 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 135: /* non_array_expr_list_head: non_array_expr  */
-#line 2015 "./gecode/flatzinc/parser.yxx"
+#line 2158 "./gecode/flatzinc/parser.yxx"
       { (yyval.argVec) = new AST::Array((yyvsp[0].arg)); }
-#line 3831 "gecode/flatzinc/parser.tab.cpp"
+#line 3974 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 136: /* non_array_expr_list_head: non_array_expr_list_head ',' non_array_expr  */
-#line 2017 "./gecode/flatzinc/parser.yxx"
+#line 2160 "./gecode/flatzinc/parser.yxx"
       { (yyval.argVec) = (yyvsp[-2].argVec); (yyval.argVec)->append((yyvsp[0].arg)); }
-#line 3837 "gecode/flatzinc/parser.tab.cpp"
+#line 3980 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 137: /* solve_expr: var_par_id  */
-#line 2025 "./gecode/flatzinc/parser.yxx"
+#line 2168 "./gecode/flatzinc/parser.yxx"
       {
         ParserState *pp = static_cast<ParserState*>(parm);
         SymbolEntry e;
@@ -3871,33 +4014,33 @@ yyreduce:
         }
         free((yyvsp[0].sValue));
       }
-#line 3875 "gecode/flatzinc/parser.tab.cpp"
+#line 4018 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 138: /* solve_expr: FZ_INT_LIT  */
-#line 2059 "./gecode/flatzinc/parser.yxx"
+#line 2202 "./gecode/flatzinc/parser.yxx"
       {
         ParserState *pp = static_cast<ParserState*>(parm);
         pp->intvars.push_back(varspec("OBJ_CONST_INTRODUCED",
           new IntVarSpec(0,true,false)));
         (yyval.iValue) = pp->intvars.size()-1;
       }
-#line 3886 "gecode/flatzinc/parser.tab.cpp"
+#line 4029 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 139: /* solve_expr: FZ_FLOAT_LIT  */
-#line 2066 "./gecode/flatzinc/parser.yxx"
+#line 2209 "./gecode/flatzinc/parser.yxx"
       {
         ParserState *pp = static_cast<ParserState*>(parm);
         pp->intvars.push_back(varspec("OBJ_CONST_INTRODUCED",
           new IntVarSpec(0,true,false)));
         (yyval.iValue) = pp->intvars.size()-1;
       }
-#line 3897 "gecode/flatzinc/parser.tab.cpp"
+#line 4040 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 140: /* solve_expr: var_par_id '[' FZ_INT_LIT ']'  */
-#line 2073 "./gecode/flatzinc/parser.yxx"
+#line 2216 "./gecode/flatzinc/parser.yxx"
       {
         SymbolEntry e;
         ParserState *pp = static_cast<ParserState*>(parm);
@@ -3921,103 +4064,103 @@ yyreduce:
         }
         free((yyvsp[-3].sValue));
       }
-#line 3925 "gecode/flatzinc/parser.tab.cpp"
+#line 4068 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 143: /* annotations: %empty  */
-#line 2107 "./gecode/flatzinc/parser.yxx"
+#line 2250 "./gecode/flatzinc/parser.yxx"
       { (yyval.argVec) = NULL; }
-#line 3931 "gecode/flatzinc/parser.tab.cpp"
+#line 4074 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 144: /* annotations: annotations_head  */
-#line 2109 "./gecode/flatzinc/parser.yxx"
+#line 2252 "./gecode/flatzinc/parser.yxx"
       { (yyval.argVec) = (yyvsp[0].argVec); }
-#line 3937 "gecode/flatzinc/parser.tab.cpp"
+#line 4080 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 145: /* annotations_head: FZ_COLONCOLON annotation  */
-#line 2113 "./gecode/flatzinc/parser.yxx"
+#line 2256 "./gecode/flatzinc/parser.yxx"
       { (yyval.argVec) = new AST::Array((yyvsp[0].arg)); }
-#line 3943 "gecode/flatzinc/parser.tab.cpp"
+#line 4086 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 146: /* annotations_head: annotations_head FZ_COLONCOLON annotation  */
-#line 2115 "./gecode/flatzinc/parser.yxx"
+#line 2258 "./gecode/flatzinc/parser.yxx"
       { (yyval.argVec) = (yyvsp[-2].argVec); (yyval.argVec)->append((yyvsp[0].arg)); }
-#line 3949 "gecode/flatzinc/parser.tab.cpp"
+#line 4092 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 147: /* annotation: FZ_ID '(' annotation_list ')'  */
-#line 2119 "./gecode/flatzinc/parser.yxx"
+#line 2262 "./gecode/flatzinc/parser.yxx"
       {
         (yyval.arg) = new AST::Call((yyvsp[-3].sValue), AST::extractSingleton((yyvsp[-1].arg))); free((yyvsp[-3].sValue));
       }
-#line 3957 "gecode/flatzinc/parser.tab.cpp"
+#line 4100 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 148: /* annotation: annotation_expr  */
-#line 2123 "./gecode/flatzinc/parser.yxx"
+#line 2266 "./gecode/flatzinc/parser.yxx"
       { (yyval.arg) = (yyvsp[0].arg); }
-#line 3963 "gecode/flatzinc/parser.tab.cpp"
+#line 4106 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 149: /* annotation_list: annotation  */
-#line 2127 "./gecode/flatzinc/parser.yxx"
+#line 2270 "./gecode/flatzinc/parser.yxx"
       { (yyval.arg) = new AST::Array((yyvsp[0].arg)); }
-#line 3969 "gecode/flatzinc/parser.tab.cpp"
+#line 4112 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 150: /* annotation_list: annotation_list ',' annotation  */
-#line 2129 "./gecode/flatzinc/parser.yxx"
+#line 2272 "./gecode/flatzinc/parser.yxx"
       { (yyval.arg) = (yyvsp[-2].arg); (yyval.arg)->append((yyvsp[0].arg)); }
-#line 3975 "gecode/flatzinc/parser.tab.cpp"
+#line 4118 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 151: /* annotation_expr: ann_non_array_expr  */
-#line 2133 "./gecode/flatzinc/parser.yxx"
+#line 2276 "./gecode/flatzinc/parser.yxx"
       { (yyval.arg) = (yyvsp[0].arg); }
-#line 3981 "gecode/flatzinc/parser.tab.cpp"
+#line 4124 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 152: /* annotation_expr: '[' ']'  */
-#line 2135 "./gecode/flatzinc/parser.yxx"
+#line 2278 "./gecode/flatzinc/parser.yxx"
       { (yyval.arg) = new AST::Array(); }
-#line 3987 "gecode/flatzinc/parser.tab.cpp"
+#line 4130 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 153: /* annotation_expr: '[' annotation_list annotation_list_tail ']'  */
-#line 2137 "./gecode/flatzinc/parser.yxx"
+#line 2280 "./gecode/flatzinc/parser.yxx"
       { (yyval.arg) = (yyvsp[-2].arg); }
-#line 3993 "gecode/flatzinc/parser.tab.cpp"
+#line 4136 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 156: /* ann_non_array_expr: FZ_BOOL_LIT  */
-#line 2143 "./gecode/flatzinc/parser.yxx"
+#line 2286 "./gecode/flatzinc/parser.yxx"
       { (yyval.arg) = new AST::BoolLit((yyvsp[0].iValue)); }
-#line 3999 "gecode/flatzinc/parser.tab.cpp"
+#line 4142 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 157: /* ann_non_array_expr: FZ_INT_LIT  */
-#line 2145 "./gecode/flatzinc/parser.yxx"
+#line 2288 "./gecode/flatzinc/parser.yxx"
       { (yyval.arg) = new AST::IntLit((yyvsp[0].iValue)); }
-#line 4005 "gecode/flatzinc/parser.tab.cpp"
+#line 4148 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 158: /* ann_non_array_expr: FZ_FLOAT_LIT  */
-#line 2147 "./gecode/flatzinc/parser.yxx"
+#line 2290 "./gecode/flatzinc/parser.yxx"
       { (yyval.arg) = new AST::FloatLit((yyvsp[0].dValue)); }
-#line 4011 "gecode/flatzinc/parser.tab.cpp"
+#line 4154 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 159: /* ann_non_array_expr: set_literal  */
-#line 2149 "./gecode/flatzinc/parser.yxx"
+#line 2292 "./gecode/flatzinc/parser.yxx"
       { (yyval.arg) = (yyvsp[0].setLit); }
-#line 4017 "gecode/flatzinc/parser.tab.cpp"
+#line 4160 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 160: /* ann_non_array_expr: var_par_id  */
-#line 2151 "./gecode/flatzinc/parser.yxx"
+#line 2294 "./gecode/flatzinc/parser.yxx"
       {
         ParserState* pp = static_cast<ParserState*>(parm);
         SymbolEntry e;
@@ -4123,11 +4266,11 @@ yyreduce:
           (yyval.arg) = getVarRefArg(pp,(yyvsp[0].sValue),true);
         free((yyvsp[0].sValue));
       }
-#line 4127 "gecode/flatzinc/parser.tab.cpp"
+#line 4270 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 161: /* ann_non_array_expr: var_par_id '[' ann_non_array_expr ']'  */
-#line 2257 "./gecode/flatzinc/parser.yxx"
+#line 2400 "./gecode/flatzinc/parser.yxx"
       {
         ParserState* pp = static_cast<ParserState*>(parm);
         int i = -1;
@@ -4138,20 +4281,20 @@ yyreduce:
           (yyval.arg) = new AST::IntLit(0); // keep things consistent
         free((yyvsp[-3].sValue));
       }
-#line 4142 "gecode/flatzinc/parser.tab.cpp"
+#line 4285 "gecode/flatzinc/parser.tab.cpp"
     break;
 
   case 162: /* ann_non_array_expr: FZ_STRING_LIT  */
-#line 2268 "./gecode/flatzinc/parser.yxx"
+#line 2411 "./gecode/flatzinc/parser.yxx"
       {
         (yyval.arg) = new AST::String((yyvsp[0].sValue));
         free((yyvsp[0].sValue));
       }
-#line 4151 "gecode/flatzinc/parser.tab.cpp"
+#line 4294 "gecode/flatzinc/parser.tab.cpp"
     break;
 
 
-#line 4155 "gecode/flatzinc/parser.tab.cpp"
+#line 4298 "gecode/flatzinc/parser.tab.cpp"
 
       default: break;
     }
@@ -4374,3 +4517,4 @@ yyreturnlab:
     YYSTACK_FREE (yymsg);
   return yyresult;
 }
+
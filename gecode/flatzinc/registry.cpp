@@ -197,6 +197,10 @@ namespace Gecode { namespace FlatZinc {
     /* linear (in-)equations */
     void p_int_lin_CMP(FlatZincSpace& s, IntRelType irt, const ConExpr& ce,
                        AST::Node* ann) {
+      IntPropLevel ipl = s.ann2ipl(ann);
+      // Use the incremental propagators if requested
+      if (ann && ann->hasAtom("incremental"))
+        ipl = static_cast<IntPropLevel>(ipl | IPL_ADVANCED);
       IntArgs ia = s.arg2intargs(ce[0]);
       int singleIntVar;
       if (s.isBoolArray(ce[1],singleIntVar)) {
@@ -211,18 +215,18 @@ namespace Gecode { namespace FlatZinc {
                 ia_tmp[count++] = ia[singleIntVar] == -1 ? ia[i] : -ia[i];
             }
             IntRelType t = (ia[singleIntVar] == -1 ? irt : swap(irt));
-            linear(s, ia_tmp, iv, t, siv, s.ann2ipl(ann));
+            linear(s, ia_tmp, iv, t, siv, ipl);
           } else {
             IntVarArgs iv = s.arg2intvarargs(ce[1]);
-            linear(s, ia, iv, irt, ce[2]->getInt(), s.ann2ipl(ann));
+            linear(s, ia, iv, irt, ce[2]->getInt(), ipl);
           }
         } else {
           BoolVarArgs iv = s.arg2boolvarargs(ce[1]);
-          linear(s, ia, iv, irt, ce[2]->getInt(), s.ann2ipl(ann));
+          linear(s, ia, iv, irt, ce[2]->getInt(), ipl);
         }
       } else {
         IntVarArgs iv = s.arg2intvarargs(ce[1]);
-        linear(s, ia, iv, irt, ce[2]->getInt(), s.ann2ipl(ann));
+        linear(s, ia, iv, irt, ce[2]->getInt(), ipl);
       }
     }
     void p_int_lin_CMP_reif(FlatZincSpace& s, IntRelType irt, ReifyMode rm,
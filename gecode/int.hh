@@ -59,6 +59,7 @@
 #include <functional>
 #include <utility>
 #include <initializer_list>
+#include <string>
 
 #include <gecode/kernel.hh>
 #include <gecode/search.hh>
@@ -1429,6 +1430,27 @@ namespace Gecode {
   GECODE_INT_EXPORT void
   clause(Home home, BoolOpType o, const BoolVarArgs& x, const BoolVarArgs& y,
          int n, IntPropLevel ipl=IPL_DEF);
+  /** \brief Post domain consistent propagator for a conjunction of clauses over \a x
+   *
+   * The clauses are given by \a c in DIMACS format: the value
+   * \f$i+1\f$ refers to \f$x_i\f$, the value \f$-(i+1)\f$ refers
+   * to \f$\neg x_i\f$, and each clause is terminated by zero (the
+   * terminator of the last clause can be omitted). For example,
+   * \f$\langle 1,-2,0,2,3,0\rangle\f$ posts
+   * \f$(x_0\vee\neg x_1)\wedge(x_1\vee x_2)\f$.
+   *
+   * All clauses are propagated by a single propagator using two
+   * watched literals per clause. The clauses are shared among all
+   * clones of a space, which makes this preferable to posting
+   * a large number of individual clauses.
+   *
+   * Throws an exception of type Int::OutOfLimits, if \a c refers
+   * to a variable not in \a x.
+   * \ingroup TaskModelIntRelBool
+   */
+  GECODE_INT_EXPORT void
+  clause(Home home, const BoolVarArgs& x, const IntArgs& c,
+         IntPropLevel ipl=IPL_DEF);
   /** \brief Post propagator for if-then-else constraint
    *
    * Posts propagator for \f$ z = b ? x : y \f$
@@ -2191,6 +2213,13 @@ namespace Gecode {
    * see the module MiniModel.
    */
 
+  namespace Int { namespace Extensional {
+
+    /// Release read-only file image \a p of \a n bytes
+    GECODE_INT_EXPORT void unmap(void* p, std::size_t n);
+
+  }}
+
   /**
    * \brief Deterministic finite automaton (%DFA)
    *
@@ -2326,6 +2355,22 @@ namespace Gecode {
     int symbol_max(void) const;
     /// Return hash key
     std::size_t hash(void) const;
+    /// \name Binary file serialization
+    //@{
+    /// Write DFA in binary format to file \a fn
+    GECODE_INT_EXPORT
+    void save(const std::string& fn) const;
+    /**
+     * \brief Return DFA stored in binary file \a fn
+     *
+     * The transitions are mapped read-only from the file (where
+     * supported by the operating system) and hence shared between all
+     * processes loading the same file. Throws Int::InvalidFile if the
+     * file cannot be read or has not been written by save().
+     */
+    GECODE_INT_EXPORT
+    static DFA load(const std::string& fn);
+    //@}
   };
 
 }
@@ -2485,6 +2530,10 @@ namespace Gecode {
       CSupportWord* compressed_words;
       /// Number of compressed support entries
       unsigned int compressed_n_entries;
+      /// Read-only file image holding the finalized data (or nullptr)
+      void* image;
+      /// Size of the file image in bytes
+      std::size_t n_image;
 
       /// Return newly added tuple
       Tuple add(void);
@@ -2618,6 +2667,31 @@ namespace Gecode {
     std::size_t hash(void) const;
     /// Return materialized tuple-set representation
     ExtensionalPropKind representation(void) const;
+    //@}
+
+    /// \name Binary file serialization
+    //@{
+    /**
+     * \brief Write finalized tuple set in binary format to file \a fn
+     *
+     * Throws Int::NotYetFinalized if the tuple set is not finalized and
+     * Int::InvalidFile if the file cannot be written.
+     */
+    GECODE_INT_EXPORT
+    void save(const std::string& fn) const;
+    /**
+     * \brief Return finalized tuple set stored in binary file \a fn
+     *
+     * The tuples and support data are mapped read-only from the file
+     * (where supported by the operating system): loading neither sorts
+     * tuples nor rebuilds supports, and all processes loading the same
+     * file share its pages. Only the per-value range information is
+     * reconstructed. Throws Int::InvalidFile if the file cannot be read
+     * or has not been written by save() on a compatible platform.
+     */
+    GECODE_INT_EXPORT
+    static TupleSet load(const std::string& fn);
+    //@}
   private:
     /// Return number of sparse support values
     unsigned int sparse_values(void) const;
@@ -2637,7 +2711,6 @@ namespace Gecode {
                                   const CSupportWord*& b,
                                   const CSupportWord*& e) const;
   public:
-    //@}
 
     /// \name Range access and iteration
     //@{
@@ -2711,6 +2784,106 @@ namespace Gecode {
 
 #include <gecode/int/extensional/tuple-set.hpp>
 
+namespace Gecode {
+
+  /**
+   * \brief Multi-valued decision diagram (%MDD)
+   *
+   * An %MDD of arity \f$n\f$ is a layered graph with \f$n+1\f$ layers
+   * of nodes. The first layer only contains the root and the last
+   * layer only contains the terminal node. Each edge leads from a node
+   * of layer \f$i\f$ to a node of layer \f$i+1\f$ and is labeled with a
+   * value for the \f$i\f$-th variable. The %MDD accepts all tuples that
+   * label a path from the root to the terminal.
+   *
+   * An %MDD is always reduced: all nodes lie on a path from the root to
+   * the terminal and no two nodes of a layer have the same outgoing
+   * edges. Nodes are hash-consed during construction, so equivalent
+   * nodes are shared. The nodes and edges are immutable and shared
+   * between all copies of an %MDD and between all propagators (and
+   * their clones) posted for it.
+   *
+   * \ingroup TaskModelIntExt
+   */
+  class MDD : public SharedHandle {
+  public:
+    class MDDI;
+    /// %Edge of an %MDD
+    class Edge {
+    public:
+      int src; ///< Source node
+      int dst; ///< Destination node
+      int sup; ///< %Support (and hence value) of the edge
+    };
+    /// Edges of an %MDD for a value of a layer
+    class Support {
+    public:
+      int val; ///< The value
+      int fst; ///< First edge with this value
+      int lst; ///< One past last edge with this value
+    };
+  protected:
+    /// Initialize with implementation \a m
+    MDD(MDDI* m);
+  public:
+    /// \name Initialization
+    //@{
+    /// Initialize as %MDD of arity zero accepting the empty tuple
+    MDD(void);
+    /// Initialize by %MDD \a m (%MDD is shared)
+    MDD(const MDD& m);
+    /// Assignment operator
+    MDD& operator =(const MDD& m);
+    /// Initialize as %MDD for all words of length \a n accepted by \a d
+    GECODE_INT_EXPORT
+    MDD(int n, const DFA& d);
+    /**
+     * \brief Initialize as %MDD for all tuples of \a t
+     *
+     * Throws an exception of type Int::NotYetFinalized, if \a t has
+     * not been finalized.
+     */
+    GECODE_INT_EXPORT
+    MDD(const TupleSet& t);
+    /**
+     * \brief Intersect with %MDD \a m
+     *
+     * Throws an exception of type Int::ArgumentSizeMismatch, if \a m
+     * has a different arity.
+     */
+    GECODE_INT_EXPORT
+    MDD& operator &=(const MDD& m);
+    //@}
+
+    /// \name Information
+    //@{
+    /// Return arity
+    int arity(void) const;
+    /// Return number of nodes
+    int nodes(void) const;
+    /// Return number of edges
+    int edges(void) const;
+    /// Test whether the %MDD does not accept any tuple
+    bool empty(void) const;
+    /// Return implementation (for propagators)
+    const MDDI* mddi(void) const;
+    //@}
+  };
+
+  /**
+   * \brief Return intersection of %MDDs \a m and \a n
+   *
+   * Throws an exception of type Int::ArgumentSizeMismatch, if \a m
+   * and \a n have different arity.
+   *
+   * \relates MDD
+   */
+  MDD operator &(const MDD& m, const MDD& n);
+
+}
+
+#include <gecode/int/extensional/mdd.hpp>
+
 namespace Gecode {
 
   /**
@@ -2745,6 +2918,44 @@ namespace Gecode {
   extensional(Home home, const BoolVarArgs& x, DFA d,
               IntPropLevel ipl=IPL_DEF);
 
+  /**
+   * \brief Post domain consistent propagator for extensional constraint described by an %MDD
+   *
+   * The elements of \a x must label a path from the root to the
+   * terminal of the %MDD \a m. Any number of propagators can be
+   * posted for the same %MDD: they share its nodes and edges.
+   *
+   * Throws an exception of type Int::ArgumentSizeMismatch, if \a x
+   * and \a m have different arity, and an exception of type
+   * Int::ArgumentSame, if \a x contains the same unassigned variable
+   * multiply. If shared occurrences of variables are required,
+   * unshare should be used.
+   *
+   * \ingroup TaskModelIntExt
+   */
+  GECODE_INT_EXPORT void
+  extensional(Home home, const IntVarArgs& x, const MDD& m,
+              IntPropLevel ipl=IPL_DEF);
+
+  /**
+   * \brief Post domain consistent propagator for extensional constraint described by an %MDD
+   *
+   * The elements of \a x must label a path from the root to the
+   * terminal of the %MDD \a m. Any number of propagators can be
+   * posted for the same %MDD: they share its nodes and edges.
+   *
+   * Throws an exception of type Int::ArgumentSizeMismatch, if \a x
+   * and \a m have different arity, and an exception of type
+   * Int::ArgumentSame, if \a x contains the same unassigned variable
+   * multiply. If shared occurrences of variables are required,
+   * unshare should be used.
+   *
+   * \ingroup TaskModelIntExt
+   */
+  GECODE_INT_EXPORT void
+  extensional(Home home, const BoolVarArgs& x, const MDD& m,
+              IntPropLevel ipl=IPL_DEF);
+
   /** \brief Post propagator for \f$x\in t\f$.
    *
    * \li Supports domain consistency (\a ipl = IPL_DOM, default) only.
@@ -3116,6 +3327,13 @@ namespace Gecode {
    *    (hence, default propagation) and the linear constraint is sufficiently
    *    simple (two variables with unit coefficients), the domain
    *    consistent propagation is used.
+   *  - If \a IPL_ADVANCED is set for a bounds consistent equation or
+   *    an inequality that is not handled by a binary or ternary
+   *    propagator, incremental propagators are used: advisors maintain
+   *    the bounds of the sum
+   *    in constant time per bound change and the propagator only runs
+   *    when the slack drops below the largest domain width. This pays
+   *    off for long sums where most bound changes cannot cause pruning.
    *  - Variables occurring multiply in the argument arrays are replaced
    *    by a single occurrence: for example, \f$ax+bx\f$ becomes
    *    \f$(a+b)x\f$.
@@ -3847,6 +4065,13 @@ namespace Gecode {
    *    and edge finding.
    *  - If both flags are combined, all the above listed propagation is
    *    performed.
+   *  - If \a IPL_ADVANCED is combined with \a IPL_BND, the propagator
+   *    in addition performs time-table edge-finding.
+   *  - If \a IPL_ADVANCED is combined with \a IPL_DOM, the propagator
+   *    in addition performs time-table edge-finding and checks the
+   *    resource by energetic reasoning.
+   *  - \a IPL_BND and \a IPL_DOM without \a IPL_ADVANCED only perform
+   *    basic propagation.
    *
    * The propagator uses algorithms taken from:
    *
@@ -3860,6 +4085,17 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS,
    * pages 802-816. Springer, 2009.
    *
+   * Time-table edge-finding follows:
+   *
+   * Petr Vilím, Timetable edge finding filtering algorithm for discrete
+   * cumulative resources. In T. Achterberg and J. C. Beck, editors, CPAIOR,
+   * volume 6697 of LNCS, pages 230-245. Springer, 2011.
+   *
+   * The energetic reasoning check follows:
+   *
+   * Philippe Baptiste, Claude Le Pape, and Wim Nuijten, Constraint-Based
+   * Scheduling. Kluwer Academic Publishers, 2001.
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a t, \a s
    *    \a p, or \a u are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a p, \a u, or \a c
@@ -3951,6 +4187,13 @@ namespace Gecode {
    *    and edge finding.
    *  - If both flags are combined, all the above listed propagation is
    *    performed.
+   *  - If \a IPL_ADVANCED is combined with \a IPL_BND, the propagator
+   *    in addition performs time-table edge-finding.
+   *  - If \a IPL_ADVANCED is combined with \a IPL_DOM, the propagator
+   *    in addition performs time-table edge-finding and checks the
+   *    resource by energetic reasoning.
+   *  - \a IPL_BND and \a IPL_DOM without \a IPL_ADVANCED only perform
+   *    basic propagation.
    *
    * The propagator uses algorithms taken from:
    *
@@ -3964,6 +4207,17 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS,
    * pages 802-816. Springer, 2009.
    *
+   * Time-table edge-finding follows:
+   *
+   * Petr Vilím, Timetable edge finding filtering algorithm for discrete
+   * cumulative resources. In T. Achterberg and J. C. Beck, editors, CPAIOR,
+   * volume 6697 of LNCS, pages 230-245. Springer, 2011.
+   *
+   * The energetic reasoning check follows:
+   *
+   * Philippe Baptiste, Claude Le Pape, and Wim Nuijten, Constraint-Based
+   * Scheduling. Kluwer Academic Publishers, 2001.
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a s
    *    \a p, or \a u are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a p, \a u, or \a c
@@ -4043,6 +4297,13 @@ namespace Gecode {
    *    and edge finding.
    *  - If both flags are combined, all the above listed propagation is
    *    performed.
+   *  - If \a IPL_ADVANCED is combined with \a IPL_BND, the propagator
+   *    in addition performs time-table edge-finding.
+   *  - If \a IPL_ADVANCED is combined with \a IPL_DOM, the propagator
+   *    in addition performs time-table edge-finding and checks the
+   *    resource by energetic reasoning.
+   *  - \a IPL_BND and \a IPL_DOM without \a IPL_ADVANCED only perform
+   *    basic propagation.
    *
    * The propagator uses algorithms taken from:
    *
@@ -4056,6 +4317,17 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS,
    * pages 802-816. Springer, 2009.
    *
+   * Time-table edge-finding follows:
+   *
+   * Petr Vilím, Timetable edge finding filtering algorithm for discrete
+   * cumulative resources. In T. Achterberg and J. C. Beck, editors, CPAIOR,
+   * volume 6697 of LNCS, pages 230-245. Springer, 2011.
+   *
+   * The energetic reasoning check follows:
+   *
+   * Philippe Baptiste, Claude Le Pape, and Wim Nuijten, Constraint-Based
+   * Scheduling. Kluwer Academic Publishers, 2001.
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a s
    *    \a p, or \a u are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a u or \a c
@@ -987,6 +987,16 @@ namespace Gecode {
     }
   }
 
+  void
+  clause(Home home, const BoolVarArgs& x, const IntArgs& c,
+         IntPropLevel ipl) {
+    using namespace Int;
+    GECODE_POST;
+    ViewArray<BoolView> xv(home,x);
+    GECODE_ES_FAIL(Bool::ClauseDB::post(home,xv,c,
+                                        (ba(ipl) & IPL_ADVANCED) != 0));
+  }
+
   void
   ite(Home home, BoolVar b, IntVar x, IntVar y, IntVar z,
       IntPropLevel ipl) {
@@ -570,6 +570,166 @@ namespace Gecode { namespace Int { namespace Bool {
   };
 
 
+  /**
+   * \brief Boolean clause database propagator
+   *
+   * Propagates a conjunction of clauses with two watched literals
+   * per clause. A literal \f$2i\f$ refers to \f$x_i\f$ and a literal
+   * \f$2i+1\f$ to \f$\neg x_i\f$. The literals of all clauses are
+   * stored in an array that is shared among all clones, only the
+   * watched literals and the watch lists are copied.
+   *
+   * If learning is enabled, the propagator records for each view
+   * the clause that has assigned it. On failure, a clause is derived
+   * by resolution from the failed clause and the recorded clauses
+   * (using the first unique implication point since the last fixpoint
+   * of the propagator). As the clause is implied by the clauses alone,
+   * it is added to a store shared by all clones and all clones watch
+   * it from their next propagation on. Views that have been assigned
+   * by other propagators or by branching are not explained further.
+   *
+   * Requires \code #include <gecode/int/bool.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  class ClauseDB : public Propagator {
+  protected:
+    /// %Advisor for the view at position \a i
+    class Idx : public Advisor {
+    public:
+      /// Position of the view
+      int i;
+      /// Create advisor for view at position \a i
+      Idx(Space& home, Propagator& p, Council<Idx>& c, int i);
+      /// Clone advisor \a a
+      Idx(Space& home, Idx& a);
+    };
+    /// Learned clauses shared by all clones
+    class Learned : public SharedHandle {
+    protected:
+      /// The actual clauses
+      class Data : public SharedHandle::Object {
+      public:
+        /// Mutex protecting the clauses
+        Support::Mutex m;
+        /// Clauses (each starting with the number of literals)
+        int** c;
+        /// Number of clauses
+        int n;
+        /// Capacity of \a c
+        int cap;
+        /// Total number of literals
+        long long int n_lits;
+        /// Initialize empty
+        Data(void);
+        /// Delete clauses
+        virtual ~Data(void);
+      };
+    public:
+      /// Initialize as empty handle (no learning)
+      Learned(void);
+      /// Initialize handle for storing clauses
+      void init(void);
+      /// Return number of clauses
+      int size(void) const;
+      /// Return clause \a i
+      const int* operator [](int i) const;
+      /// Add clause with \a n literals \a l, return whether it has been added
+      bool add(const int* l, int n);
+    };
+    /// Maximal number of literals in all learned clauses
+    static const long long int learn_limit = 1LL << 24;
+    /// The advisor council
+    Council<Idx> c;
+    /// The views
+    ViewArray<BoolView> x;
+    /// The literals of all clauses (shared)
+    IntSharedArray l;
+    /// Start of clause \a i in \a l is \a s[i], \a s[n_clauses] is the end
+    IntSharedArray s;
+    /// Learned clauses (empty handle if learning is disabled)
+    Learned ld;
+    /// Learned clauses watched by this propagator
+    const int** lc;
+    /// Number of learned clauses watched by this propagator
+    int n_lc;
+    /// Capacity (in number of clauses) of \a w, \a nw, and \a lc
+    int n_w;
+    /// Position of the watched literals in their clauses (two per clause)
+    int* w;
+    /// Next watch in the same watch list (negative if none)
+    int* nw;
+    /// First watch in the watch list for a literal (negative if none)
+    int* hd;
+    /// Positions of the views in the order of their assignment
+    int* tr;
+    /// Number of entries in \a tr
+    int n_tr;
+    /// Views in \a tr from position \a qh on have not yet been processed
+    int qh;
+    /// Position in \a tr of a view (if assigned)
+    int* pos;
+    /// Clause that has assigned a view (negative if none)
+    int* rs;
+    /// Number of entries in \a tr at the last fixpoint
+    int lv;
+    /// Whether literal \a i is true
+    bool one(int i) const;
+    /// Whether literal \a i is false
+    bool zero(int i) const;
+    /// Number of original clauses
+    int original(void) const;
+    /// Number of clauses
+    int clauses(void) const;
+    /// Return the literals of clause \a i
+    const int* literals(int i) const;
+    /// Return the number of literals of clause \a i
+    int size(int i) const;
+    /// Add watch \a e to the watch list of literal \a t
+    void watch(int e, int t);
+    /// Make literal \a t true with clause \a i as reason
+    ExecStatus assign(Space& home, int t, int i);
+    /// Watch learned clauses not yet watched by this propagator
+    ExecStatus integrate(Space& home);
+    /// Learn a clause from the failed clause \a i
+    void learn(int i);
+    /// Constructor for posting
+    ClauseDB(Home home, ViewArray<BoolView>& x,
+             IntSharedArray& l, IntSharedArray& s, bool learn);
+    /// Constructor for cloning \a p
+    ClauseDB(Space& home, ClauseDB& p);
+  public:
+    /// Copy propagator during cloning
+    GECODE_INT_EXPORT
+    virtual Actor* copy(Space& home);
+    /// Give advice to propagator
+    GECODE_INT_EXPORT
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Cost function (defined as low linear)
+    GECODE_INT_EXPORT
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    GECODE_INT_EXPORT
+    virtual void reschedule(Space& home);
+    /// Perform propagation
+    GECODE_INT_EXPORT
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /**
+     * \brief Post propagator for the clauses \a c over \a x
+     *
+     * The clauses are given in DIMACS format: the value \f$i+1\f$
+     * refers to \f$x_i\f$, \f$-(i+1)\f$ to \f$\neg x_i\f$, and each
+     * clause is terminated by zero (the last terminator can be omitted).
+     * If \a learn is true, clauses are learned from failures.
+     */
+    GECODE_INT_EXPORT
+    static ExecStatus post(Home home, ViewArray<BoolView>& x,
+                           const IntArgs& c, bool learn=false);
+    /// Delete propagator and return its size
+    GECODE_INT_EXPORT
+    virtual size_t dispose(Space& home);
+  };
+
+
   /**
    * \brief If-then-else propagator base-class
    *
@@ -0,0 +1,469 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.dev
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/int/bool.hh>
+
+#include <algorithm>
+
+namespace Gecode { namespace Int { namespace Bool {
+
+  /*
+   * Advisors
+   *
+   */
+  forceinline
+  ClauseDB::Idx::Idx(Space& home, Propagator& p, Council<Idx>& c, int i0)
+    : Advisor(home,p,c), i(i0) {}
+
+  forceinline
+  ClauseDB::Idx::Idx(Space& home, Idx& a)
+    : Advisor(home,a), i(a.i) {}
+
+
+  /*
+   * Learned clauses
+   *
+   */
+  ClauseDB::Learned::Data::Data(void)
+    : c(nullptr), n(0), cap(0), n_lits(0) {}
+
+  ClauseDB::Learned::Data::~Data(void) {
+    for (int i=0; i<n; i++)
+      heap.free<int>(c[i],c[i][0]+1);
+    heap.free<int*>(c,cap);
+  }
+
+  forceinline
+  ClauseDB::Learned::Learned(void) {}
+
+  forceinline void
+  ClauseDB::Learned::init(void) {
+    object(new Data);
+  }
+
+  forceinline int
+  ClauseDB::Learned::size(void) const {
+    Data& d = *static_cast<Data*>(object());
+    Support::Lock g(d.m);
+    return d.n;
+  }
+
+  forceinline const int*
+  ClauseDB::Learned::operator [](int i) const {
+    Data& d = *static_cast<Data*>(object());
+    Support::Lock g(d.m);
+    return d.c[i];
+  }
+
+  forceinline bool
+  ClauseDB::Learned::add(const int* l, int n) {
+    Data& d = *static_cast<Data*>(object());
+    Support::Lock g(d.m);
+    if (d.n_lits + n > learn_limit)
+      return false;
+    if (d.n == d.cap) {
+      int m = std::max(2*d.cap,64);
+      d.c = heap.realloc<int*>(d.c,d.cap,m);
+      d.cap = m;
+    }
+    int* c = heap.alloc<int>(n+1);
+    c[0] = n;
+    Heap::copy(c+1,l,n);
+    d.c[d.n++] = c;
+    d.n_lits += n;
+    return true;
+  }
+
+
+  /*
+   * Clause database propagator
+   *
+   */
+  forceinline bool
+  ClauseDB::one(int i) const {
+    return (i & 1) ? x[i >> 1].zero() : x[i >> 1].one();
+  }
+
+  forceinline bool
+  ClauseDB::zero(int i) const {
+    return (i & 1) ? x[i >> 1].one() : x[i >> 1].zero();
+  }
+
+  forceinline int
+  ClauseDB::original(void) const {
+    return s.size() - 1;
+  }
+
+  forceinline int
+  ClauseDB::clauses(void) const {
+    return original() + n_lc;
+  }
+
+  forceinline const int*
+  ClauseDB::literals(int i) const {
+    return (i < original()) ? &l[s[i]] : lc[i-original()]+1;
+  }
+
+  forceinline int
+  ClauseDB::size(int i) const {
+    return (i < original()) ? s[i+1]-s[i] : lc[i-original()][0];
+  }
+
+  forceinline void
+  ClauseDB::watch(int e, int t) {
+    nw[e] = hd[t]; hd[t] = e;
+  }
+
+  forceinline ExecStatus
+  ClauseDB::assign(Space& home, int t, int i) {
+    int v = t >> 1;
+    if (t & 1) {
+      GECODE_ME_CHECK(x[v].zero_none(home));
+    } else {
+      GECODE_ME_CHECK(x[v].one_none(home));
+    }
+    // The advisor has already added the view to the trail
+    rs[v] = i;
+    return ES_OK;
+  }
+
+  forceinline
+  ClauseDB::ClauseDB(Home home, ViewArray<BoolView>& x0,
+                     IntSharedArray& l0, IntSharedArray& s0, bool learn)
+    : Propagator(home), c(home), x(x0), l(l0), s(s0),
+      lc(nullptr), n_lc(0), n_w(s0.size()-1), n_tr(0), qh(0), lv(0) {
+    home.notice(*this,AP_DISPOSE);
+    if (learn)
+      ld.init();
+    Space& h = home;
+    w   = h.alloc<int>(2*n_w);
+    nw  = h.alloc<int>(2*n_w);
+    hd  = h.alloc<int>(2*x.size());
+    tr  = h.alloc<int>(x.size());
+    pos = h.alloc<int>(x.size());
+    rs  = h.alloc<int>(x.size());
+    for (int i=2*x.size(); i--; )
+      hd[i] = -1;
+    // Watch the first two literals of each clause
+    for (int i=0; i<n_w; i++)
+      for (int k=0; k<2; k++) {
+        w[2*i+k] = k; watch(2*i+k,l[s[i]+k]);
+      }
+    for (int i=0; i<x.size(); i++)
+      x[i].subscribe(home,*new (home) Idx(home,*this,c,i));
+  }
+
+  forceinline
+  ClauseDB::ClauseDB(Space& home, ClauseDB& p)
+    : Propagator(home,p), l(p.l), s(p.s), ld(p.ld), n_lc(p.n_lc),
+      n_w(p.clauses()), n_tr(p.n_tr), qh(p.qh), lv(p.lv) {
+    c.update(home,p.c);
+    x.update(home,p.x);
+    lc  = (n_lc > 0) ?
+      Heap::copy(home.alloc<const int*>(n_lc),p.lc,n_lc) : nullptr;
+    w   = Heap::copy(home.alloc<int>(2*n_w),p.w,2*n_w);
+    nw  = Heap::copy(home.alloc<int>(2*n_w),p.nw,2*n_w);
+    hd  = Heap::copy(home.alloc<int>(2*x.size()),p.hd,2*x.size());
+    tr  = Heap::copy(home.alloc<int>(x.size()),p.tr,n_tr);
+    pos = Heap::copy(home.alloc<int>(x.size()),p.pos,x.size());
+    rs  = Heap::copy(home.alloc<int>(x.size()),p.rs,x.size());
+  }
+
+  Actor*
+  ClauseDB::copy(Space& home) {
+    return new (home) ClauseDB(home,*this);
+  }
+
+  PropCost
+  ClauseDB::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::linear(PropCost::LO, n_tr-qh);
+  }
+
+  void
+  ClauseDB::reschedule(Space& home) {
+    if (qh < n_tr)
+      BoolView::schedule(home,*this,ME_BOOL_VAL);
+  }
+
+  ExecStatus
+  ClauseDB::advise(Space& home, Advisor& a0, const Delta&) {
+    Idx& a = static_cast<Idx&>(a0);
+    pos[a.i] = n_tr; rs[a.i] = -1; tr[n_tr++] = a.i;
+    a.dispose(home,c);
+    return ES_NOFIX;
+  }
+
+  ExecStatus
+  ClauseDB::integrate(Space& home) {
+    int n = ld.size();
+    if (n == n_lc)
+      return ES_OK;
+    if (original() + n > n_w) {
+      int m = original() + 2*n;
+      w  = home.realloc<int>(w,2*n_w,2*m);
+      nw = home.realloc<int>(nw,2*n_w,2*m);
+      lc = (lc != nullptr) ?
+        home.realloc<const int*>(lc,n_w-original(),m-original()) :
+        home.alloc<const int*>(m-original());
+      n_w = m;
+    }
+    while (n_lc < n) {
+      int i = clauses();
+      lc[n_lc] = ld[n_lc]; n_lc++;
+      const int* t = literals(i);
+      int m = size(i);
+      if (m == 1) {
+        // Unit clauses are not watched
+        w[2*i] = w[2*i+1] = 0;
+        if (zero(t[0]))
+          return ES_FAILED;
+        if (!one(t[0]))
+          GECODE_ES_CHECK(assign(home,t[0],i));
+        continue;
+      }
+      // Watch the two best literals: literals that are not false
+      // come first, followed by the most recently falsified ones
+      int a = -1, ra = -1, b = -1, rb = -1;
+      for (int k=0; k<m; k++) {
+        int r = zero(t[k]) ? pos[t[k] >> 1] : x.size();
+        if (r > ra) {
+          b = a; rb = ra; a = k; ra = r;
+        } else if (r > rb) {
+          b = k; rb = r;
+        }
+      }
+      w[2*i] = a; watch(2*i,t[a]);
+      w[2*i+1] = b; watch(2*i+1,t[b]);
+      if (zero(t[a]))
+        return ES_FAILED;
+      if (zero(t[b]) && !one(t[a]))
+        GECODE_ES_CHECK(assign(home,t[a],i));
+    }
+    return ES_OK;
+  }
+
+  void
+  ClauseDB::learn(int i) {
+    Region r;
+    // Whether a view has already been considered
+    bool* mk = r.alloc<bool>(x.size());
+    for (int k=x.size(); k--; )
+      mk[k] = false;
+    // The learned clause
+    int* cl = r.alloc<int>(x.size());
+    int n_cl = 0;
+    // Number of views considered but not yet resolved since last fixpoint
+    int open = 0;
+    // View resolved on and position in trail
+    int v = -1, j = n_tr;
+    do {
+      const int* t = literals(i);
+      for (int k=size(i); k--; ) {
+        int y = t[k] >> 1;
+        if ((y != v) && !mk[y]) {
+          mk[y] = true;
+          if (pos[y] >= lv)
+            open++;
+          else
+            cl[n_cl++] = t[k];
+        }
+      }
+      // Find the next view to resolve on in reverse trail order
+      i = -1;
+      while ((i < 0) && (open > 0)) {
+        do {
+          j--;
+        } while (!mk[tr[j]]);
+        v = tr[j]; open--;
+        if ((open == 0) || (rs[v] < 0))
+          cl[n_cl++] = 2*v + (x[v].one() ? 1 : 0);
+        else
+          i = rs[v];
+      }
+    } while (i >= 0);
+    if (n_cl > 0)
+      (void) ld.add(cl,n_cl);
+  }
+
+  ExecStatus
+  ClauseDB::propagate(Space& home, const ModEventDelta&) {
+    if (ld)
+      GECODE_ES_CHECK(integrate(home));
+    // Assigning a view during propagation adds it to the trail
+    while (qh < n_tr) {
+      int i = tr[qh++];
+      // The literal that has become false
+      int f = 2*i + (x[i].one() ? 1 : 0);
+      int* p = &hd[f];
+      while (*p >= 0) {
+        int e = *p;
+        const int* t = literals(e >> 1);
+        int m = size(e >> 1);
+        // The other watched literal
+        int o = w[e ^ 1];
+        if (one(t[o])) {
+          p = &nw[e]; continue;
+        }
+        // Try to find a new literal to watch
+        int k = 0;
+        while ((k < m) && ((k == o) || zero(t[k])))
+          k++;
+        if (k < m) {
+          // Move watch to the watch list of the new literal
+          w[e] = k; *p = nw[e]; watch(e,t[k]);
+          continue;
+        }
+        // The other watched literal must become true
+        if (zero(t[o])) {
+          if (ld)
+            learn(e >> 1);
+          return ES_FAILED;
+        }
+        GECODE_ES_CHECK(assign(home,t[o],e >> 1));
+        p = &nw[e];
+      }
+    }
+    lv = n_tr;
+    // All views are assigned, hence all clauses are satisfied
+    if (c.empty())
+      return home.ES_SUBSUMED(*this);
+    return ES_FIX;
+  }
+
+  size_t
+  ClauseDB::dispose(Space& home) {
+    home.ignore(*this,AP_DISPOSE);
+    for (Advisors<Idx> as(c); as(); ++as)
+      x[as.advisor().i].cancel(home,as.advisor());
+    c.dispose(home);
+    if (lc != nullptr)
+      home.free<const int*>(lc,n_w-original());
+    home.free<int>(w,2*n_w);
+    home.free<int>(nw,2*n_w);
+    home.free<int>(hd,2*x.size());
+    home.free<int>(tr,x.size());
+    home.free<int>(pos,x.size());
+    home.free<int>(rs,x.size());
+    ld.~Learned();
+    l.~IntSharedArray();
+    s.~IntSharedArray();
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+  ExecStatus
+  ClauseDB::post(Home home, ViewArray<BoolView>& x, const IntArgs& c,
+                 bool learn) {
+    Region r;
+    // Clause in which a literal has been seen last (per literal)
+    int* m = r.alloc<int>(2*x.size());
+    for (int i=2*x.size(); i--; )
+      m[i] = -1;
+    // New position of views that occur in clauses
+    int* v = r.alloc<int>(x.size());
+    for (int i=x.size(); i--; )
+      v[i] = -1;
+    int n_v = 0;
+    // Literals that must be true
+    int* u = r.alloc<int>(c.size());
+    int n_u = 0;
+    // Literals and start of clauses
+    int* cl = r.alloc<int>(c.size());
+    int n_cl = 0;
+    int* cs = r.alloc<int>(c.size()+2);
+    int n_cs = 0;
+    // Number of clauses read so far
+    int n_c = 0;
+    int j = 0;
+    while (j < c.size()) {
+      int b = n_cl;
+      bool sat = false;
+      for (; (j < c.size()) && (c[j] != 0); j++) {
+        int i = std::abs(c[j]) - 1;
+        if (i >= x.size())
+          throw OutOfLimits("Int::clause");
+        int t = 2*i + ((c[j] < 0) ? 1 : 0);
+        if (sat || (m[t] == n_c))
+          continue;
+        if ((m[t ^ 1] == n_c) ||
+            (x[i].one() && !(t & 1)) || (x[i].zero() && (t & 1))) {
+          sat = true; continue;
+        }
+        m[t] = n_c;
+        if (!x[i].assigned())
+          cl[n_cl++] = t;
+      }
+      j++; n_c++;
+      if (sat) {
+        n_cl = b;
+      } else if (n_cl == b) {
+        return ES_FAILED;
+      } else if (n_cl == b+1) {
+        u[n_u++] = cl[--n_cl];
+      } else {
+        cs[n_cs++] = b;
+      }
+    }
+    cs[n_cs] = n_cl;
+    if (n_cs > 0) {
+      // Only keep the views that occur in clauses
+      IntSharedArray ls(n_cl);
+      for (int k=0; k<n_cl; k++) {
+        int i = cl[k] >> 1;
+        if (v[i] < 0)
+          v[i] = n_v++;
+        ls[k] = 2*v[i] + (cl[k] & 1);
+      }
+      IntSharedArray ss(n_cs+1);
+      for (int k=0; k<=n_cs; k++)
+        ss[k] = cs[k];
+      ViewArray<BoolView> y(home,n_v);
+      for (int i=0; i<x.size(); i++)
+        if (v[i] >= 0)
+          y[v[i]] = x[i];
+      (void) new (home) ClauseDB(home,y,ls,ss,learn);
+    }
+    // Assign unit clauses after the propagator has been created
+    for (int k=0; k<n_u; k++)
+      if (u[k] & 1) {
+        GECODE_ME_CHECK(x[u[k] >> 1].zero(home));
+      } else {
+        GECODE_ME_CHECK(x[u[k] >> 1].one(home));
+      }
+    return ES_OK;
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -71,6 +71,10 @@ namespace Gecode { namespace Int { namespace Cumulative {
   protected:
     /// Required capacity
     int _c;
+    /// Start of compulsory part recorded in profile
+    int _ps;
+    /// End of compulsory part recorded in profile
+    int _pe;
   public:
     /// \name Constructors and initialization
     //@{
@@ -92,6 +96,16 @@ namespace Gecode { namespace Int { namespace Cumulative {
     long long int e(void) const;
     //@}
 
+    /// \name Profile
+    //@{
+    /// Return start of compulsory part recorded in profile
+    int ps(void) const;
+    /// Return end of compulsory part recorded in profile
+    int pe(void) const;
+    /// Record compulsory part [\a s,\a e) in profile
+    void profile(int s, int e);
+    //@}
+
     /// \name Cloning
     //@{
     /// Update this task to be a clone of task \a t
@@ -113,6 +127,10 @@ namespace Gecode { namespace Int { namespace Cumulative {
   protected:
     /// Required capacity
     int _c;
+    /// Start of compulsory part recorded in profile
+    int _ps;
+    /// End of compulsory part recorded in profile
+    int _pe;
   public:
     /// \name Constructors and initialization
     //@{
@@ -146,6 +164,16 @@ namespace Gecode { namespace Int { namespace Cumulative {
     long long int e(void) const;
     //@}
 
+    /// \name Profile
+    //@{
+    /// Return start of compulsory part recorded in profile
+    int ps(void) const;
+    /// Return end of compulsory part recorded in profile
+    int pe(void) const;
+    /// Record compulsory part [\a s,\a e) in profile
+    void profile(int s, int e);
+    //@}
+
     /// \name Cloning
     //@{
     /// Update this task to be a clone of task \a t
@@ -167,6 +195,10 @@ namespace Gecode { namespace Int { namespace Cumulative {
   protected:
     /// Required capacity
     int _c;
+    /// Start of compulsory part recorded in profile
+    int _ps;
+    /// End of compulsory part recorded in profile
+    int _pe;
   public:
     /// \name Constructors and initialization
     //@{
@@ -188,6 +220,16 @@ namespace Gecode { namespace Int { namespace Cumulative {
     long long int e(void) const;
     //@}
 
+    /// \name Profile
+    //@{
+    /// Return start of compulsory part recorded in profile
+    int ps(void) const;
+    /// Return end of compulsory part recorded in profile
+    int pe(void) const;
+    /// Record compulsory part [\a s,\a e) in profile
+    void profile(int s, int e);
+    //@}
+
     /// \name Cloning
     //@{
     /// Update this task to be a clone of task \a t
@@ -686,12 +728,20 @@ namespace Gecode { namespace Int { namespace Cumulative {
   /// Perform time-tabling propagation
   template<class Task, class Cap>
   ExecStatus timetabling(Space& home, Propagator& p, Cap c,
-                         TaskArray<Task>& t);
+                         TaskArray<Task>& t, Profile& pr);
 
   /// Propagate by edge-finding
   template<class Task>
   ExecStatus edgefinding(Space& home, int c, TaskArray<Task>& t);
 
+  /// Propagate by time-table edge-finding
+  template<class Task>
+  ExecStatus ttef(Space& home, int c, TaskArray<Task>& t);
+
+  /// Check by energetic reasoning
+  template<class Task>
+  ExecStatus energetic(Space& home, int c, TaskArray<Task>& t);
+
   /**
    * \brief Scheduling propagator for cumulative resource with mandatory tasks
    *
@@ -704,6 +754,8 @@ namespace Gecode { namespace Int { namespace Cumulative {
     using TaskProp<ManTask,PL>::t;
     /// Resource capacity
     Cap c;
+    /// Profile of compulsory parts for time-tabling
+    Profile pr;
     /// Constructor for creation
     ManProp(Home home, Cap c, TaskArray<ManTask>& t);
     /// Constructor for cloning \a p
@@ -731,6 +783,8 @@ namespace Gecode { namespace Int { namespace Cumulative {
     using TaskProp<OptTask,PL>::t;
     /// Resource capacity
     Cap c;
+    /// Profile of compulsory parts for time-tabling
+    Profile pr;
     /// Constructor for creation
     OptProp(Home home, Cap c, TaskArray<OptTask>& t);
     /// Constructor for cloning \a p
@@ -762,6 +816,8 @@ namespace Gecode { namespace Int { namespace Cumulative {
 #include <gecode/int/cumulative/subsumption.hpp>
 #include <gecode/int/cumulative/overload.hpp>
 #include <gecode/int/cumulative/edge-finding.hpp>
+#include <gecode/int/cumulative/ttef.hpp>
+#include <gecode/int/cumulative/energetic.hpp>
 #include <gecode/int/cumulative/man-prop.hpp>
 #include <gecode/int/cumulative/opt-prop.hpp>
 #include <gecode/int/cumulative/post.hpp>
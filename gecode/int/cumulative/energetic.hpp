@@ -0,0 +1,114 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.dev
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Int { namespace Cumulative {
+
+  /// Event for the energetic reasoning checker
+  class EnergeticEvent {
+  public:
+    /// Time of the event
+    int t;
+    /// Change in slope of the minimal energy
+    int c;
+    /// Order events by time
+    bool operator <(const EnergeticEvent& e) const {
+      return t < e.t;
+    }
+  };
+
+  template<class TaskView>
+  forceinline ExecStatus
+  energetic(int c, const TaskViewArray<TaskView>& t) {
+    int n = t.size();
+    Region r;
+
+    // Candidate left interval bounds
+    int* o = r.alloc<int>(3*n);
+    for (int i=0; i<n; i++) {
+      o[3*i+0] = t[i].est();
+      o[3*i+1] = t[i].lst();
+      o[3*i+2] = t[i].ect();
+    }
+    Support::quicksort(o, 3*n);
+
+    EnergeticEvent* e = r.alloc<EnergeticEvent>(2*n);
+
+    for (int k=0; k<3*n; k++) {
+      if ((k > 0) && (o[k] == o[k-1]))
+        continue;
+      int t1 = o[k];
+      /*
+       * The minimal energy a task i must consume in [t1,t2) is
+       * c_i * min(t2-a_i, p_i) for t2 >= a_i, where a_i = max(t1,lst_i)
+       * and p_i = min(pmin_i, ect_i-t1), and zero otherwise.
+       */
+      int n_e = 0;
+      for (int i=0; i<n; i++) {
+        if (t[i].c() <= 0)
+          continue;
+        long long int p =
+          std::min(static_cast<long long int>(t[i].pmin()),
+                   static_cast<long long int>(t[i].ect())-t1);
+        if (p <= 0)
+          continue;
+        int a = std::max(t1,t[i].lst());
+        e[n_e].t = a; e[n_e].c = t[i].c(); n_e++;
+        e[n_e].t = static_cast<int>(a+p); e[n_e].c = -t[i].c(); n_e++;
+      }
+      Support::quicksort(e, n_e);
+      // Sweep over all right interval bounds
+      long long int w = 0, s = 0;
+      int t2 = t1;
+      for (int i=0; i<n_e; ) {
+        w += s * (static_cast<long long int>(e[i].t) - t2);
+        t2 = e[i].t;
+        if (w > static_cast<long long int>(c) *
+            (static_cast<long long int>(t2) - t1))
+          return ES_FAILED;
+        while ((i < n_e) && (e[i].t == t2))
+          s += e[i++].c;
+      }
+    }
+    return ES_OK;
+  }
+
+  template<class Task>
+  ExecStatus
+  energetic(Space&, int c, TaskArray<Task>& t) {
+    TaskViewArray<typename TaskTraits<Task>::TaskViewFwd> f(t);
+    return energetic(c,f);
+  }
+
+}}}
+
+// STATISTICS: int-prop
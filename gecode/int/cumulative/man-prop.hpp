@@ -47,6 +47,7 @@ namespace Gecode { namespace Int { namespace Cumulative {
   ManProp<ManTask,Cap,PL>::ManProp(Space& home, ManProp<ManTask,Cap,PL>& p)
     : TaskProp<ManTask,PL>(home,p) {
     c.update(home,p.c);
+    pr.update(home,p.pr);
   }
 
   template<class ManTask, class Cap, class PL>
@@ -85,6 +86,7 @@ namespace Gecode { namespace Int { namespace Cumulative {
   ManProp<ManTask,Cap,PL>::dispose(Space& home) {
     (void) TaskProp<ManTask,PL>::dispose(home);
     c.cancel(home,*this,PC_INT_BND);
+    pr.dispose(home);
     return sizeof(*this);
   }
 
@@ -98,8 +100,14 @@ namespace Gecode { namespace Int { namespace Cumulative {
     if (PL::advanced)
       GECODE_ES_CHECK(edgefinding(home,c.max(),t));
 
+    if (PL::ttef)
+      GECODE_ES_CHECK(ttef(home,c.max(),t));
+
+    if (PL::energetic)
+      GECODE_ES_CHECK(energetic(home,c.max(),t));
+
     if (PL::basic)
-      GECODE_ES_CHECK(timetabling(home,*this,c,t));
+      GECODE_ES_CHECK(timetabling(home,*this,c,t,pr));
 
     if (Cap::varderived() && c.assigned() && (c.val() == 1)) {
       // Check that tasks do not overload resource
@@ -49,6 +49,7 @@ namespace Gecode { namespace Int { namespace Cumulative {
   OptProp<OptTask,Cap,PL>::OptProp(Space& home, OptProp<OptTask,Cap,PL>& p)
     : TaskProp<OptTask,PL>(home,p) {
     c.update(home,p.c);
+    pr.update(home,p.pr);
   }
 
   template<class OptTask, class Cap, class PL>
@@ -108,6 +109,7 @@ namespace Gecode { namespace Int { namespace Cumulative {
   OptProp<OptTask,Cap,PL>::dispose(Space& home) {
     (void) TaskProp<OptTask,PL>::dispose(home);
     c.cancel(home,*this,PC_INT_BND);
+    pr.dispose(home);
     return sizeof(*this);
   }
 
@@ -123,7 +125,7 @@ namespace Gecode { namespace Int { namespace Cumulative {
       GECODE_ES_CHECK(overload(home,c.max(),t));
 
     if (PL::basic)
-      GECODE_ES_CHECK(timetabling(home,*this,c,t));
+      GECODE_ES_CHECK(timetabling(home,*this,c,t,pr));
 
     if (PL::advanced) {
       // Partition into mandatory and optional activities
@@ -40,9 +40,23 @@ namespace Gecode { namespace Int { namespace Cumulative {
     case IPL_BASIC: default:
       return ManProp<ManTask,Cap,PLB>::post(home,c,t);
     case IPL_ADVANCED:
-      return ManProp<ManTask,Cap,PLA>::post(home,c,t);
+      switch (vbd(ipl)) {
+      case IPL_BND:
+        return ManProp<ManTask,Cap,PLAT>::post(home,c,t);
+      case IPL_DOM:
+        return ManProp<ManTask,Cap,PLATE>::post(home,c,t);
+      default:
+        return ManProp<ManTask,Cap,PLA>::post(home,c,t);
+      }
     case IPL_BASIC_ADVANCED:
-      return ManProp<ManTask,Cap,PLBA>::post(home,c,t);
+      switch (vbd(ipl)) {
+      case IPL_BND:
+        return ManProp<ManTask,Cap,PLBAT>::post(home,c,t);
+      case IPL_DOM:
+        return ManProp<ManTask,Cap,PLBATE>::post(home,c,t);
+      default:
+        return ManProp<ManTask,Cap,PLBA>::post(home,c,t);
+      }
     }
     GECODE_NEVER;
     return ES_OK;
@@ -43,14 +43,14 @@ namespace Gecode { namespace Int { namespace Cumulative {
   ManFixPTask::ManFixPTask(void) {}
   forceinline
   ManFixPTask::ManFixPTask(IntVar s, int p, int c)
-    : Unary::ManFixPTask(s,p), _c(c) {}
+    : Unary::ManFixPTask(s,p), _c(c), _ps(0), _pe(0) {}
   forceinline void
   ManFixPTask::init(IntVar s, int p, int c) {
-    Unary::ManFixPTask::init(s,p); _c=c;
+    Unary::ManFixPTask::init(s,p); _c=c; _ps=_pe=0;
   }
   forceinline void
   ManFixPTask::init(const ManFixPTask& t) {
-    Unary::ManFixPTask::init(t); _c=t._c;
+    Unary::ManFixPTask::init(t); _c=t._c; _ps=_pe=0;
   }
 
   forceinline int
@@ -62,9 +62,22 @@ namespace Gecode { namespace Int { namespace Cumulative {
     return static_cast<long long int>(pmin())*c();
   }
 
+  forceinline int
+  ManFixPTask::ps(void) const {
+    return _ps;
+  }
+  forceinline int
+  ManFixPTask::pe(void) const {
+    return _pe;
+  }
+  forceinline void
+  ManFixPTask::profile(int s, int e) {
+    _ps=s; _pe=e;
+  }
+
   forceinline void
   ManFixPTask::update(Space& home, ManFixPTask& t) {
-    Unary::ManFixPTask::update(home,t); _c=t._c;
+    Unary::ManFixPTask::update(home,t); _c=t._c; _ps=t._ps; _pe=t._pe;
   }
 
   template<class Char, class Traits>
@@ -84,14 +97,14 @@ namespace Gecode { namespace Int { namespace Cumulative {
   ManFixPSETask::ManFixPSETask(void) {}
   forceinline
   ManFixPSETask::ManFixPSETask(TaskType t, IntVar s, int p, int c)
-    : Unary::ManFixPSETask(t,s,p), _c(c) {}
+    : Unary::ManFixPSETask(t,s,p), _c(c), _ps(0), _pe(0) {}
   forceinline void
   ManFixPSETask::init(TaskType t, IntVar s, int p, int c) {
-    Unary::ManFixPSETask::init(t,s,p); _c=c;
+    Unary::ManFixPSETask::init(t,s,p); _c=c; _ps=_pe=0;
   }
   forceinline void
   ManFixPSETask::init(const ManFixPSETask& t0) {
-    Unary::ManFixPSETask::init(t0); _c=t0._c;
+    Unary::ManFixPSETask::init(t0); _c=t0._c; _ps=_pe=0;
   }
 
   forceinline int
@@ -103,9 +116,22 @@ namespace Gecode { namespace Int { namespace Cumulative {
     return static_cast<long long int>(pmin())*c();
   }
 
+  forceinline int
+  ManFixPSETask::ps(void) const {
+    return _ps;
+  }
+  forceinline int
+  ManFixPSETask::pe(void) const {
+    return _pe;
+  }
+  forceinline void
+  ManFixPSETask::profile(int s, int e) {
+    _ps=s; _pe=e;
+  }
+
   forceinline void
   ManFixPSETask::update(Space& home, ManFixPSETask& t) {
-    Unary::ManFixPSETask::update(home,t); _c=t._c;
+    Unary::ManFixPSETask::update(home,t); _c=t._c; _ps=t._ps; _pe=t._pe;
   }
 
   template<class Char, class Traits>
@@ -125,14 +151,14 @@ namespace Gecode { namespace Int { namespace Cumulative {
   ManFlexTask::ManFlexTask(void) {}
   forceinline
   ManFlexTask::ManFlexTask(IntVar s, IntVar p, IntVar e, int c)
-    : Unary::ManFlexTask(s,p,e), _c(c) {}
+    : Unary::ManFlexTask(s,p,e), _c(c), _ps(0), _pe(0) {}
   forceinline void
   ManFlexTask::init(IntVar s, IntVar p, IntVar e, int c) {
-    Unary::ManFlexTask::init(s,p,e); _c=c;
+    Unary::ManFlexTask::init(s,p,e); _c=c; _ps=_pe=0;
   }
   forceinline void
   ManFlexTask::init(const ManFlexTask& t) {
-    Unary::ManFlexTask::init(t); _c=t._c;
+    Unary::ManFlexTask::init(t); _c=t._c; _ps=_pe=0;
   }
 
   forceinline int
@@ -144,9 +170,22 @@ namespace Gecode { namespace Int { namespace Cumulative {
     return static_cast<long long int>(pmin())*c();
   }
 
+  forceinline int
+  ManFlexTask::ps(void) const {
+    return _ps;
+  }
+  forceinline int
+  ManFlexTask::pe(void) const {
+    return _pe;
+  }
+  forceinline void
+  ManFlexTask::profile(int s, int e) {
+    _ps=s; _pe=e;
+  }
+
   forceinline void
   ManFlexTask::update(Space& home, ManFlexTask& t) {
-    Unary::ManFlexTask::update(home,t); _c=t._c;
+    Unary::ManFlexTask::update(home,t); _c=t._c; _ps=t._ps; _pe=t._pe;
   }
 
   template<class Char, class Traits>
@@ -35,89 +35,87 @@
 
 namespace Gecode { namespace Int { namespace Cumulative {
 
-  /// Sort order for tasks by decreasing capacity
-  template<class Task>
-  class TaskByDecCap {
-  public:
-    /// Sort order
-    bool operator ()(const Task& t1, const Task& t2) const;
-  };
-
-  template<class Task>
-  forceinline bool
-  TaskByDecCap<Task>::operator ()(const Task& t1, const Task& t2) const {
-    return t1.c() > t2.c();
-  }
-
   // Basic propagation (timetabling)
   template<class Task, class Cap>
   forceinline ExecStatus
-  timetabling(Space& home, Propagator& p, Cap c, TaskArray<Task>& t) {
-    int ccur = c.max();
-    int cmax = ccur;
-    int cmin = ccur;
-
-    // Sort tasks by decreasing capacity
-    TaskByDecCap<Task> tbdc;
-    Support::quicksort(&t[0], t.size(), tbdc);
+  timetabling(Space& home, Propagator& p, Cap c, TaskArray<Task>& t,
+              Profile& pr) {
+    // Update profile for tasks whose compulsory part has changed
+    bool assigned = true;
+    for (int i=0; i<t.size(); i++) {
+      if (!t[i].assigned())
+        assigned = false;
+      int s = 0, e = 0;
+      if (t[i].mandatory() && (t[i].c() > 0) && (t[i].lst() < t[i].ect())) {
+        s = t[i].lst(); e = t[i].ect();
+      }
+      if ((s != t[i].ps()) || (e != t[i].pe())) {
+        if (t[i].ps() < t[i].pe())
+          pr.remove(home,t[i].ps(),t[i].pe(),t[i].c(),1);
+        if (s < e)
+          pr.add(home,s,e,t[i].c(),1);
+        t[i].profile(s,e);
+      }
+    }
 
     Region r;
 
-    bool assigned;
-    if (Event* e = Event::events(r,t,assigned)) {
-      // Set of current but not required tasks
-      Support::BitSet<Region> tasks(r,static_cast<unsigned int>(t.size()));
+    // Usage between point i and point i+1
+    int n = pr.size();
+    long long int* h = r.alloc<long long int>(n+1);
+    long long int hmax = 0;
+    {
+      long long int u = 0;
+      for (int i=0; i<n; i++) {
+        u += pr[i].h; h[i] = u;
+        hmax = std::max(hmax,u);
+      }
+    }
 
-      // Process events, use ccur as the capacity that is still free
-      do {
-        // Current time
-        int time = e->time();
+    /*
+     * Zero-length tasks require the resource at their start time,
+     * together with all tasks that start before and end after it
+     */
+    for (int i=0; i<t.size(); i++)
+      if (t[i].assigned() && t[i].mandatory() &&
+          (t[i].pmax() == 0) && (t[i].c() > 0)) {
+        int z = t[i].lst();
+        long long int u = t[i].c();
+        for (int j=0; j<t.size(); j++)
+          if ((t[j].ps() < z) && (z < t[j].pe()))
+            u += t[j].c();
+        hmax = std::max(hmax,u);
+      }
 
-        // Process events for completion of required part
-        for ( ; (e->type() == Event::LRT) && (e->time() == time); e++)
-          if (t[e->idx()].mandatory()) {
-            tasks.set(static_cast<unsigned int>(e->idx()));
-            ccur += t[e->idx()].c();
-          }
-        // Process events for completion of task
-        for ( ; (e->type() == Event::LCT) && (e->time() == time); e++)
-          tasks.clear(static_cast<unsigned int>(e->idx()));
-        // Process events for start of task
-        for ( ; (e->type() == Event::EST) && (e->time() == time); e++)
-          tasks.set(static_cast<unsigned int>(e->idx()));
-        // Process events for zero-length task
-        for ( ; (e->type() == Event::ZRO) && (e->time() == time); e++) {
-          ccur -= t[e->idx()].c();
-          if (ccur < cmin) cmin=ccur;
-          if (ccur < 0)
-            return ES_FAILED;
-          ccur += t[e->idx()].c();
-        }
+    int cap = c.max();
+    if (hmax > cap)
+      return ES_FAILED;
+    GECODE_ME_CHECK(c.gq(home,static_cast<int>(hmax)));
 
-        // norun start time
-        int nrstime = time;
-        // Process events for start of required part
-        for ( ; (e->type() == Event::ERT) && (e->time() == time); e++)
-          if (t[e->idx()].mandatory()) {
-            tasks.clear(static_cast<unsigned int>(e->idx()));
-            ccur -= t[e->idx()].c();
-            if (ccur < cmin) cmin=ccur;
-            nrstime = time+1;
-            if (ccur < 0)
-              return ES_FAILED;
-          } else if (t[e->idx()].optional() && (t[e->idx()].c() > ccur)) {
-            GECODE_ME_CHECK(t[e->idx()].excluded(home));
+    // Prune tasks that do not fit next to the profile
+    for (int j=0; j<t.size(); j++) {
+      if (t[j].assigned() || t[j].excluded() || (t[j].c() + hmax <= cap))
+        continue;
+      int est = t[j].est(), lct = t[j].lct();
+      for (int i=std::max(pr.upper(est)-1,0);
+           (i < n-1) && (pr[i].t < lct); i++) {
+        if (h[i] + t[j].c() <= cap)
+          continue;
+        int a = std::max(pr[i].t,est), b = std::min(pr[i+1].t,lct);
+        if (t[j].mandatory()) {
+          // The task can only run in its own compulsory part
+          if (t[j].ps() < t[j].pe()) {
+            GECODE_ME_CHECK(t[j].norun(home, a, std::min(b,t[j].ps()) - 1));
+            GECODE_ME_CHECK(t[j].norun(home, std::max(a,t[j].pe()), b - 1));
+          } else {
+            GECODE_ME_CHECK(t[j].norun(home, a, b - 1));
           }
-
-        // Exploit that tasks are sorted according to capacity
-        for (Iter::Values::BitSet<Support::BitSet<Region> > j(tasks);
-             j() && (t[j.val()].c() > ccur); ++j)
-          // Task j cannot run from zltime to next time - 1
-          if (t[j.val()].mandatory())
-            GECODE_ME_CHECK(t[j.val()].norun(home, nrstime, e->time() - 1));
-      } while (e->type() != Event::END);
-
-      GECODE_ME_CHECK(c.gq(home,cmax-cmin));
+        } else if ((pr[i].t < t[j].ect()) && (t[j].lst() < pr[i+1].t)) {
+          // Optional task cannot run through its compulsory part
+          GECODE_ME_CHECK(t[j].excluded(home));
+          break;
+        }
+      }
     }
 
     if (assigned)
@@ -0,0 +1,219 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.dev
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <algorithm>
+
+namespace Gecode { namespace Int { namespace Cumulative {
+
+  /// Event for the compulsory part profile
+  class TTEFEvent {
+  public:
+    /// Time of the event
+    int t;
+    /// Change in resource usage
+    int c;
+    /// Order events by time
+    bool operator <(const TTEFEvent& e) const {
+      return t < e.t;
+    }
+  };
+
+  /// Profile of compulsory parts for computing energies in intervals
+  class TTEFProfile {
+  protected:
+    /// Number of breakpoints
+    int n;
+    /// Breakpoints in increasing order
+    int* tp;
+    /// Height of the profile between a breakpoint and the next one
+    long long int* h;
+    /// Energy of the profile before a breakpoint
+    long long int* en;
+  public:
+    /// Initialize profile for tasks \a t
+    template<class TaskView>
+    TTEFProfile(Region& r, const TaskViewArray<TaskView>& t);
+    /// Return energy of the profile before time \a x
+    long long int energy(int x) const;
+  };
+
+  template<class TaskView>
+  forceinline
+  TTEFProfile::TTEFProfile(Region& r, const TaskViewArray<TaskView>& t)
+    : n(0) {
+    TTEFEvent* e = r.alloc<TTEFEvent>(2*t.size()+1);
+    int n_e = 0;
+    for (int i=0; i<t.size(); i++)
+      if ((t[i].lst() < t[i].ect()) && (t[i].c() > 0)) {
+        e[n_e].t = t[i].lst(); e[n_e].c = t[i].c(); n_e++;
+        e[n_e].t = t[i].ect(); e[n_e].c = -t[i].c(); n_e++;
+      }
+    Support::quicksort(e, n_e);
+    tp = r.alloc<int>(n_e+1);
+    h = r.alloc<long long int>(n_e+1);
+    en = r.alloc<long long int>(n_e+1);
+    long long int ch = 0, ce = 0;
+    for (int i=0; i<n_e; ) {
+      int x = e[i].t;
+      if (n > 0)
+        ce += h[n-1] * (static_cast<long long int>(x) - tp[n-1]);
+      while ((i < n_e) && (e[i].t == x))
+        ch += e[i++].c;
+      tp[n] = x; h[n] = ch; en[n] = ce; n++;
+    }
+  }
+
+  forceinline long long int
+  TTEFProfile::energy(int x) const {
+    // Find last breakpoint not after x
+    int l = 0, r = n;
+    while (l < r) {
+      int m = l + (r-l) / 2;
+      if (tp[m] <= x)
+        l = m+1;
+      else
+        r = m;
+    }
+    if (l == 0)
+      return 0;
+    l--;
+    return en[l] + h[l] * (static_cast<long long int>(x) - tp[l]);
+  }
+
+  template<class TaskView>
+  forceinline ExecStatus
+  ttef(Space& home, int c, TaskViewArray<TaskView>& t) {
+    sort<TaskView,STO_EST,true>(t);
+
+    Region r;
+
+    TTEFProfile tt(r,t);
+
+    int n = t.size();
+
+    // Energy of the profile before earliest start and latest completion
+    long long int* e_est = r.alloc<long long int>(n);
+    long long int* e_lct = r.alloc<long long int>(n);
+    // Length of compulsory part
+    int* cp = r.alloc<int>(n);
+    // Distinct latest completion times
+    int* lct = r.alloc<int>(n);
+    for (int i=0; i<n; i++) {
+      e_est[i] = tt.energy(t[i].est());
+      e_lct[i] = tt.energy(t[i].lct());
+      cp[i] = std::max(0, t[i].ect() - t[i].lst());
+      lct[i] = i;
+    }
+    SortMap<TaskView,StoLct,true> o(t);
+    Support::quicksort(lct, n, o);
+
+    // Available energy for intervals starting at a task's earliest start
+    long long int* avail = r.alloc<long long int>(n);
+    // New earliest start times
+    int* est = r.alloc<int>(n);
+    for (int i=0; i<n; i++)
+      est[i] = t[i].est();
+
+    for (int k=0; k<n; k++) {
+      int j = lct[k];
+      int b = t[j].lct();
+      // Only consider distinct latest completion times
+      if ((k+1 < n) && (t[lct[k+1]].lct() == b))
+        continue;
+      long long int e_b = e_lct[j];
+
+      // Compute available energy for all intervals [a,b)
+      long long int en_free = 0;
+      for (int i=n; i--; ) {
+        int a = t[i].est();
+        if ((t[i].lct() <= b) && (t[i].c() > 0) && (t[i].pmin() > cp[i]))
+          en_free += static_cast<long long int>(t[i].c())*
+            (t[i].pmin() - cp[i]);
+        if ((i > 0) && (t[i-1].est() == a))
+          continue;
+        if (a >= b) {
+          for (int l=i; (l < n) && (t[l].est() == a); l++)
+            avail[l] = Limits::llinfinity;
+          continue;
+        }
+        long long int av = static_cast<long long int>(c)*
+          (static_cast<long long int>(b)-a) - (e_b - e_est[i]) - en_free;
+        if (av < 0)
+          return ES_FAILED;
+        for (int l=i; (l < n) && (t[l].est() == a); l++)
+          avail[l] = av;
+      }
+
+      // Minimal available energy of intervals starting not later
+      for (int i=1; i<n; i++)
+        avail[i] = std::min(avail[i],avail[i-1]);
+
+      // Push tasks that cannot start at their earliest start time
+      for (int i=0; i<n; i++) {
+        if ((t[i].lct() <= b) || (t[i].est() >= b) ||
+            (t[i].c() <= 0) || (t[i].pmin() <= 0))
+          continue;
+        // The task's compulsory part must not be inside the interval
+        if ((cp[i] > 0) && (b > t[i].lst()))
+          continue;
+        long long int y =
+          std::min(static_cast<long long int>(b)-t[i].est(),
+                   static_cast<long long int>(t[i].pmin()));
+        if (static_cast<long long int>(t[i].c())*y > avail[i]) {
+          long long int s = b - avail[i] / t[i].c();
+          if (s > est[i])
+            est[i] = static_cast<int>(s);
+        }
+      }
+    }
+
+    for (int i=0; i<n; i++)
+      if (est[i] > t[i].est())
+        GECODE_ME_CHECK(t[i].est(home,est[i]));
+
+    return ES_OK;
+  }
+
+  template<class Task>
+  ExecStatus
+  ttef(Space& home, int c, TaskArray<Task>& t) {
+    TaskViewArray<typename TaskTraits<Task>::TaskViewFwd> f(t);
+    GECODE_ES_CHECK(ttef(home,c,f));
+    TaskViewArray<typename TaskTraits<Task>::TaskViewBwd> b(t);
+    GECODE_ES_CHECK(ttef(home,c,b));
+    return ES_OK;
+  }
+
+}}}
+
+// STATISTICS: int-prop
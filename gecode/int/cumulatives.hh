@@ -35,6 +35,7 @@
 #define GECODE_INT_CUMULATIVES_HH
 
 #include <gecode/int.hh>
+#include <gecode/int/task.hh>
 
 namespace Gecode { namespace Int { namespace Cumulatives {
 
@@ -79,6 +80,12 @@ namespace Gecode { namespace Int { namespace Cumulatives {
    * This class implements Beldiceanu's and Carlsson's sweep-line
    * propagation algorithm for the cumulatives constraint.
    *
+   * The compulsory parts of tasks assigned to a resource are kept in
+   * an incrementally updated profile per resource: only tasks whose
+   * compulsory part has changed are re-inserted. Only the remaining
+   * events (negative heights of unassigned tasks and pruning events)
+   * are sorted during propagation.
+   *
    * Requires \code #include <gecode/int/cumulatives.hh> \endcode
    * \ingroup FuncIntProp
    */
@@ -93,6 +100,25 @@ namespace Gecode { namespace Int { namespace Cumulatives {
     SharedArray<int>  c;
     const bool        at_most;
 
+    /// Compulsory part of a task as recorded in the profile of a resource
+    class CompPart {
+    public:
+      /// Resource (-1 if not recorded)
+      int r;
+      /// Start and end of the compulsory part
+      int s, e;
+      /// Height contributed to the profile
+      int h;
+      /// Whether the task is checked for the limit (0 or 1)
+      int k;
+    };
+    /// Incrementally maintained profile of compulsory parts per resource
+    Profile* pr;
+    /// Compulsory part as currently recorded for each task
+    CompPart* cp;
+    /// Update the compulsory part recorded for task \a t on resource \a r
+    void compulsory(Space& home, int t, int r);
+
     Val(Space& home, Val<ViewM, ViewP, ViewU, View>& p);
     Val(Home home, const ViewArray<ViewM>&, const ViewArray<View>&,
         const ViewArray<ViewP>&, const ViewArray<View>&,
@@ -100,12 +126,11 @@ namespace Gecode { namespace Int { namespace Cumulatives {
 
     ExecStatus prune(Space& home, int low, int up, int r,
                      int ntask, int su,
-                     int* contribution,
                      int* prune_tasks, int& prune_tasks_size);
   public:
     /// Create copy during cloning
     virtual Actor* copy(Space& home);
-    /// Cost function (defined as low quadratic)
+    /// Cost function (defined as high linear)
     virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
     /// Schedule function
     virtual void reschedule(Space& home);
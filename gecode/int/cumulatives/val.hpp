@@ -56,6 +56,13 @@ namespace Gecode { namespace Int { namespace Cumulatives {
     m(_m), s(_s), p(_p), e(_e), u(_u), c(_c), at_most(_at_most) {
     home.notice(*this,AP_DISPOSE);
 
+    Space& sh = home;
+    pr = sh.alloc<Profile>(c.size());
+    cp = sh.alloc<CompPart>(s.size());
+    for (int t=0; t<s.size(); t++) {
+      cp[t].r = -1; cp[t].s = cp[t].e = cp[t].h = cp[t].k = 0;
+    }
+
     m.subscribe(home,*this,Int::PC_INT_DOM);
     s.subscribe(home,*this,Int::PC_INT_BND);
     p.subscribe(home,*this,Int::PC_INT_BND);
@@ -70,6 +77,9 @@ namespace Gecode { namespace Int { namespace Cumulatives {
          const ViewArray<View>& s, const ViewArray<ViewP>& p,
          const ViewArray<View>& e, const ViewArray<ViewU>& u,
          const SharedArray<int>& c, bool at_most) {
+    // Without tasks or resources there is nothing to propagate
+    if ((s.size() == 0) || (c.size() == 0))
+      return ES_OK;
     (void) new (home) Val(home, m,s,p,e,u,c,at_most);
     return ES_OK;
   }
@@ -84,6 +94,12 @@ namespace Gecode { namespace Int { namespace Cumulatives {
     p.update(home, vp.p);
     e.update(home, vp.e);
     u.update(home, vp.u);
+    pr = home.alloc<Profile>(c.size());
+    for (int r=0; r<c.size(); r++)
+      pr[r].update(home,vp.pr[r]);
+    cp = home.alloc<CompPart>(s.size());
+    for (int t=0; t<s.size(); t++)
+      cp[t] = vp.cp[t];
   }
 
   template<class ViewM, class ViewP, class ViewU, class View>
@@ -97,6 +113,10 @@ namespace Gecode { namespace Int { namespace Cumulatives {
       e.cancel(home,*this,Int::PC_INT_BND);
       u.cancel(home,*this,Int::PC_INT_BND);
     }
+    for (int r=0; r<c.size(); r++)
+      pr[r].dispose(home);
+    home.free<Profile>(pr,c.size());
+    home.free<CompPart>(cp,s.size());
     c.~SharedArray();
     (void) Propagator::dispose(home);
     return sizeof(*this);
@@ -105,7 +125,7 @@ namespace Gecode { namespace Int { namespace Cumulatives {
   template<class ViewM, class ViewP, class ViewU, class View>
   PropCost
   Val<ViewM,ViewP,ViewU,View>::cost(const Space&, const ModEventDelta&) const {
-    return PropCost::quadratic(PropCost::LO, s.size());
+    return PropCost::linear(PropCost::HI, s.size());
   }
 
   template<class ViewM, class ViewP, class ViewU, class View>
@@ -124,8 +144,13 @@ namespace Gecode { namespace Int { namespace Cumulatives {
     return new (home) Val<ViewM,ViewP,ViewU,View>(home,*this);
   }
 
-  /// Types of events for the sweep-line
-  typedef enum {EVENT_CHCK, EVENT_PROF, EVENT_PRUN} ev_t;
+  /**
+   * \brief Types of events for the sweep-line
+   *
+   * Events for compulsory parts are not needed as they are
+   * maintained by the profile of each resource.
+   */
+  typedef enum {EVENT_PROF, EVENT_PRUN} ev_t;
   /// An event collects the information for one event for the sweep-line
   class Event
   {
@@ -138,15 +163,10 @@ namespace Gecode { namespace Int { namespace Cumulatives {
     int date;
     /// The quantity changed by this event (if any)
     int inc;
-    /** If the type is EVENT_PROF and it is the first of the pair,
-     * this value is true. Added to handle contribution-values
-     * correctly for both at_most and at_least.
-     */
-    bool first_prof;
 
     /// Simple constructor
-    Event(ev_t _e, int _task, int _date, int _inc = 0, bool _first_prof = false)
-      : e(_e), task(_task), date(_date), inc(_inc), first_prof(_first_prof)
+    Event(ev_t _e, int _task, int _date, int _inc = 0)
+      : e(_e), task(_task), date(_date), inc(_inc)
     {}
 
     // Default constructor for region-allocated memory
@@ -154,11 +174,8 @@ namespace Gecode { namespace Int { namespace Cumulatives {
 
     /// Order events based on date.
     bool operator <(const Event& ev) const {
-      if (date == ev.date) {
-        if (e == EVENT_PROF && ev.e != EVENT_PROF) return true;
-        if (e == EVENT_CHCK && ev.e == EVENT_PRUN) return true;
-        return false;
-      }
+      if (date == ev.date)
+        return (e == EVENT_PROF) && (ev.e == EVENT_PRUN);
       return date < ev.date;
     }
   };
@@ -167,7 +184,6 @@ namespace Gecode { namespace Int { namespace Cumulatives {
   ExecStatus
   Val<ViewM,ViewP,ViewU,View>::prune(Space& home, int low, int up, int r,
                                      int ntask, int su,
-                                     int* contribution,
                                      int* prune_tasks, int& prune_tasks_size) {
 
     if (ntask > 0 && (at_most ? su > c[r] : su < c[r])) {
@@ -177,6 +193,8 @@ namespace Gecode { namespace Int { namespace Cumulatives {
     int pti = 0;
     while (pti != prune_tasks_size) {
       int t = prune_tasks[pti];
+      // Contribution of the compulsory part of t to the profile at low
+      int contribution = ((cp[t].r == r) && (cp[t].s <= low)) ? cp[t].h : 0;
 
       // Algorithm 2.
       // Prune the machine, start, and end for required
@@ -184,8 +202,8 @@ namespace Gecode { namespace Int { namespace Cumulatives {
       if (ntask != 0 &&
           (at_most ? u[t].min() < 0
            : u[t].max() > 0) &&
-          (at_most ? su-contribution[t] > c[r]
-           : su-contribution[t] < c[r])) {
+          (at_most ? su-contribution > c[r]
+           : su-contribution < c[r])) {
         if (me_failed(m[t].eq(home, r))||
             me_failed(s[t].gq(home, up-p[t].max()+1))||
             me_failed(s[t].lq(home, low))||
@@ -201,8 +219,8 @@ namespace Gecode { namespace Int { namespace Cumulatives {
       // Remove values that prevent us from reaching the limit
       if (at_most ? u[t].min() > std::min(0, c[r])
           : u[t].max() < std::max(0, c[r])) {
-        if (at_most ? su-contribution[t]+u[t].min() > c[r]
-            : su-contribution[t]+u[t].max() < c[r]) {
+        if (at_most ? su-contribution+u[t].min() > c[r]
+            : su-contribution+u[t].max() < c[r]) {
           if (e[t].min() > low  &&
               s[t].max() <= up &&
               p[t].min() > 0) {
@@ -239,8 +257,8 @@ namespace Gecode { namespace Int { namespace Cumulatives {
           s[t].max() <= up  &&
           p[t].min() > 0 ) {
         if (me_failed(at_most
-                      ? u[t].lq(home, c[r]-su+contribution[t])
-                      : u[t].gq(home, c[r]-su+contribution[t]))) {
+                      ? u[t].lq(home, c[r]-su+contribution)
+                      : u[t].gq(home, c[r]-su+contribution))) {
           return ES_FAILED;
         }
       }
@@ -256,6 +274,34 @@ namespace Gecode { namespace Int { namespace Cumulatives {
     return ES_OK;
   }
 
+  template<class ViewM, class ViewP, class ViewU, class View>
+  forceinline void
+  Val<ViewM,ViewP,ViewU,View>::compulsory(Space& home, int t, int r) {
+    CompPart n;
+    n.r = -1; n.s = n.e = n.h = n.k = 0;
+    if (m[t].assigned() && (m[t].val() == r) && (s[t].max() < e[t].min())) {
+      if (at_most
+          ? u[t].min() > std::min(0, c[r])
+          : u[t].max() < std::max(0, c[r]))
+        n.k = 1;
+      if (at_most
+          ? u[t].min() > 0
+          : u[t].max() < 0)
+        n.h = at_most ? u[t].min() : u[t].max();
+      if ((n.k != 0) || (n.h != 0)) {
+        n.r = r; n.s = s[t].max(); n.e = e[t].min();
+      }
+    }
+    if ((n.r != cp[t].r) || (n.s != cp[t].s) || (n.e != cp[t].e) ||
+        (n.h != cp[t].h) || (n.k != cp[t].k)) {
+      if (cp[t].r >= 0)
+        pr[cp[t].r].remove(home,cp[t].s,cp[t].e,cp[t].h,cp[t].k);
+      if (n.r >= 0)
+        pr[n.r].add(home,n.s,n.e,n.h,n.k);
+      cp[t] = n;
+    }
+  }
+
   namespace {
     template<class C>
     class Less {
@@ -278,104 +324,125 @@ namespace Gecode { namespace Int { namespace Cumulatives {
         subsumed = false;
         break;
       }
-    // Propagate information for machine r
+
     Region region;
-    Event *events = region.alloc<Event>(s.size()*8);
+
+    // Collect the tasks that can run on each resource
+    int *first = region.alloc<int>(c.size()+1);
+    for (int r = c.size()+1; r--; ) first[r] = 0;
+    int n_rt = 0;
+    for (int t = s.size(); t--; )
+      for (ViewValues<ViewM> i(m[t]); i(); ++i)
+        if ((i.val() >= 0) && (i.val() < c.size())) {
+          first[i.val()+1]++; n_rt++;
+        }
+    for (int r = 0; r < c.size(); r++)
+      first[r+1] += first[r];
+    int *tasks = region.alloc<int>(std::max(n_rt,1));
+    {
+      int *next = region.alloc<int>(c.size());
+      for (int r = c.size(); r--; ) next[r] = first[r];
+      for (int t = 0; t < s.size(); t++)
+        for (ViewValues<ViewM> i(m[t]); i(); ++i)
+          if ((i.val() >= 0) && (i.val() < c.size()))
+            tasks[next[i.val()]++] = t;
+    }
+
+    // Propagate information for machine r
+    Event *events = region.alloc<Event>(s.size()*3);
     int  events_size;
     int *prune_tasks = region.alloc<int>(s.size());
     int  prune_tasks_size;
-    int *contribution = region.alloc<int>(s.size());
     for (int r = c.size(); r--; ) {
       events_size = 0;
-#define GECODE_PUSH_EVENTS(E) assert(events_size < s.size()*8);     \
+#define GECODE_PUSH_EVENTS(E) assert(events_size < s.size()*3);     \
         events[events_size++] = E
 
-      // Find events for sweep-line
-      for (int t = s.size(); t--; ) {
-        if (m[t].assigned() &&
-            m[t].val() == r &&
-            s[t].max() < e[t].min()) {
-          if (at_most
-              ? u[t].min() > std::min(0, c[r])
-              : u[t].max() < std::max(0, c[r])) {
-            GECODE_PUSH_EVENTS(Event(EVENT_CHCK, t, s[t].max(), 1));
-            GECODE_PUSH_EVENTS(Event(EVENT_CHCK, t, e[t].min(), -1));
-          }
-          if (at_most
-              ? u[t].min() > 0
-              : u[t].max() < 0) {
-            GECODE_PUSH_EVENTS(Event(EVENT_PROF, t, s[t].max(),
-                                     at_most ? u[t].min() : u[t].max(), true));
-            GECODE_PUSH_EVENTS(Event(EVENT_PROF, t, e[t].min(),
-                                     at_most ? -u[t].min() : -u[t].max()));
-          }
+      /*
+       * Update the profile for compulsory parts and find the
+       * remaining events for the sweep-line
+       */
+      for (int i = first[r]; i < first[r+1]; i++) {
+        int t = tasks[i];
+        // Pruning for an earlier resource might have removed r
+        if (!m[t].in(r))
+          continue;
+        compulsory(home,t,r);
+        if (at_most
+            ? u[t].min() < 0
+            : u[t].max() > 0) {
+          GECODE_PUSH_EVENTS(Event(EVENT_PROF, t, s[t].min(),
+                                   at_most ? u[t].min() : u[t].max()));
+          GECODE_PUSH_EVENTS(Event(EVENT_PROF, t, e[t].max(),
+                                   at_most ? -u[t].min() : -u[t].max()));
         }
-
-        if (m[t].in(r)) {
-          if (at_most
-              ? u[t].min() < 0
-              : u[t].max() > 0) {
-            GECODE_PUSH_EVENTS(Event(EVENT_PROF, t, s[t].min(),
-                                     at_most ? u[t].min() : u[t].max(), true));
-            GECODE_PUSH_EVENTS(Event(EVENT_PROF, t, e[t].max(),
-                                     at_most ? -u[t].min() : -u[t].max()));
-          }
-          if (!(m[t].assigned() &&
-                u[t].assigned() &&
-                s[t].assigned() &&
-                e[t].assigned())) {
-            GECODE_PUSH_EVENTS(Event(EVENT_PRUN, t, s[t].min()));
-          }
+        if (!(m[t].assigned() &&
+              u[t].assigned() &&
+              s[t].assigned() &&
+              e[t].assigned())) {
+          GECODE_PUSH_EVENTS(Event(EVENT_PRUN, t, s[t].min()));
         }
       }
 #undef GECODE_PUSH_EVENTS
 
+      const Profile& prof = pr[r];
       // If there are no events, continue with next machine
-      if (events_size == 0) {
+      if ((events_size == 0) && (prof.size() == 0)) {
         continue;
       }
 
       // Sort the events according to date
       Less<Event> less;
-      Support::insertion(&events[0], events_size, less);
+      Support::quicksort(&events[0], events_size, less);
 
-      // Sweep line along d, starting at 0
+      /*
+       * Sweep line along d, merging the points of the profile with
+       * the events. A point of the profile comes before the events
+       * at the same date.
+       */
       int d        = 0;
       int ntask    = 0;
       int su  = 0;
       int ei = 0;
+      int pi = 0;
 
       prune_tasks_size = 0;
-      for (int i = s.size(); i--; ) contribution[i] = 0;
 
-      d = events[ei].date;
-      while (ei < events_size) {
-        if (events[ei].e != EVENT_PRUN) {
-          if (d != events[ei].date) {
-            GECODE_ES_CHECK(prune(home, d, events[ei].date-1, r,
+      if (prof.size() == 0)
+        d = events[0].date;
+      else if (events_size == 0)
+        d = prof[0].t;
+      else
+        d = std::min(prof[0].t, events[0].date);
+      while ((ei < events_size) || (pi < prof.size())) {
+        bool point = (pi < prof.size()) &&
+          ((ei == events_size) || (prof[pi].t <= events[ei].date));
+        if (point || (events[ei].e != EVENT_PRUN)) {
+          int date = point ? prof[pi].t : events[ei].date;
+          if (d != date) {
+            GECODE_ES_CHECK(prune(home, d, date-1, r,
                                   ntask, su,
-                                  contribution, prune_tasks, prune_tasks_size));
-            d = events[ei].date;
+                                  prune_tasks, prune_tasks_size));
+            d = date;
           }
-          if (events[ei].e == EVENT_CHCK) {
-            ntask += events[ei].inc;
+          if (point) {
+            ntask += prof[pi].k;
+            su += static_cast<int>(prof[pi].h);
+            pi++;
           } else /* if (events[ei].e == EVENT_PROF) */ {
             su += events[ei].inc;
-            if(events[ei].first_prof)
-              contribution[events[ei].task] = at_most
-                ? std::max(contribution[events[ei].task], events[ei].inc)
-                : std::min(contribution[events[ei].task], events[ei].inc);
+            ei++;
           }
         } else /* if (events[ei].e == EVENT_PRUN) */ {
           assert(prune_tasks_size<s.size());
           prune_tasks[prune_tasks_size++] = events[ei].task;
+          ei++;
         }
-        ei++;
       }
 
       GECODE_ES_CHECK(prune(home, d, d, r,
                             ntask, su,
-                            contribution, prune_tasks, prune_tasks_size));
+                            prune_tasks, prune_tasks_size));
     }
     return subsumed ? home.ES_SUBSUMED(*this): ES_NOFIX;
   }
@@ -190,6 +190,140 @@ namespace Gecode { namespace Int { namespace Element {
     virtual size_t dispose(Space& home);
   };
 
+  /**
+   * \brief Index for element over an array of integers
+   *
+   * The index stores the sorted distinct values of an array and, for
+   * each value, the positions where the value occurs. An index is built
+   * once per IntSharedArray and is shared read-only by all propagators
+   * (and all their clones) posted over the same array.
+   */
+  class IntIndex : public SharedHandle {
+  protected:
+    /// The actual index
+    class Data : public SharedHandle::Object {
+    public:
+      /// The array (keeps the array alive while indexed)
+      IntSharedArray c;
+      /// Number of index handles referring to the data
+      Support::RefCount users;
+      /// Number of distinct values
+      int n_vals;
+      /// Distinct values in increasing order
+      int* val;
+      /// Value number for each position
+      int* vid;
+      /// Start of positions for each value number (size n_vals+1)
+      int* fst;
+      /// Positions sorted by value (and by position for equal values)
+      int* pos;
+      /// Build index for array \a c
+      Data(const IntSharedArray& c);
+      /// Delete index
+      virtual ~Data(void);
+    };
+    /// Entry in the cache of indices
+    class Entry;
+    /// Mutex protecting the cache
+    static Support::Mutex m;
+    /// The cache of indices
+    static Entry* cache;
+    /// Initialize for data \a d
+    IntIndex(Data* d);
+    /// Return data
+    Data& data(void) const;
+  public:
+    /// Initialize as empty index
+    IntIndex(void);
+    /// Initialize from index \a i (index is shared)
+    IntIndex(const IntIndex& i);
+    /// Assignment operator
+    IntIndex& operator =(const IntIndex& i);
+    /// Destructor
+    ~IntIndex(void);
+    /// Return (possibly cached) index for array \a c
+    GECODE_INT_EXPORT static IntIndex get(const IntSharedArray& c);
+    /// Return size of indexed array
+    int size(void) const;
+    /// Return element at position \a i of indexed array
+    int operator [](int i) const;
+    /// Return number of distinct values
+    int values(void) const;
+    /// Return value with number \a k
+    int val(int k) const;
+    /// Return value number for position \a i
+    int vid(int i) const;
+    /// Return number of the smallest value greater or equal to \a n
+    int lq(int n) const;
+    /// Return first position for value number \a k
+    const int* begin(int k) const;
+    /// Return position after last position for value number \a k
+    const int* end(int k) const;
+  };
+
+  /// Minimal array size for which element uses a shared index
+  const int index_min = 256;
+
+  /**
+   * \brief Domain consistent element propagator for large arrays of integers
+   *
+   * Uses a shared IntIndex for the array. The only data copied during
+   * cloning is a bit set of the positions that are still supported.
+   *
+   * Requires \code #include <gecode/int/element.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class V0, class V1>
+  class Indexed : public Propagator {
+  protected:
+    /// Value iterator for supported positions
+    class IterPos {
+    protected:
+      /// The positions
+      const Support::BitSetBase& b;
+      /// Offset of positions
+      int o;
+      /// Current bit
+      unsigned int i;
+    public:
+      /// Initialize with positions \a b with offset \a o
+      IterPos(const Support::BitSetBase& b, int o);
+      /// Test whether more positions to be iterated
+      bool operator ()(void) const;
+      /// Move to next position
+      void operator ++(void);
+      /// Return current position
+      int val(void) const;
+    };
+    /// View for index
+    V0 x0;
+    /// View for result
+    V1 x1;
+    /// The shared index
+    IntIndex ix;
+    /// Offset of first position in \a s
+    int o;
+    /// Positions still supported
+    Support::BitSetBase s;
+    /// Constructor for cloning \a p
+    Indexed(Space& home, Indexed& p);
+    /// Constructor for creation
+    Indexed(Home home, const IntIndex& ix, V0 x0, V1 x1);
+  public:
+    /// Perform copying during cloning
+    virtual Actor* copy(Space& home);
+    /// Cost function (defined as high binary)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Post propagator for \f$i_{x_0}=x_1\f$ with index \a ix
+    static  ExecStatus post(Home home, const IntIndex& ix, V0 x0, V1 x1);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+  };
+
   /// Post propagator with appropriate index and value types
   template<class V0, class V1>
   ExecStatus post_int(Home home, IntSharedArray& c, V0 x0, V1 x1);
@@ -348,6 +482,7 @@ namespace Gecode { namespace Int { namespace Element {
 }}}
 
 #include <gecode/int/element/int.hpp>
+#include <gecode/int/element/int-index.hpp>
 #include <gecode/int/element/view.hpp>
 #include <gecode/int/element/pair.hpp>
 
@@ -0,0 +1,138 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.dev
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/int/element.hh>
+
+namespace Gecode { namespace Int { namespace Element {
+
+  /// Entry in the cache of indices
+  class IntIndex::Entry : public HeapAllocated {
+  public:
+    /// Handle owning the data
+    SharedHandle h;
+    /// The data
+    Data* d;
+    /// Next entry
+    Entry* next;
+    /// Initialize with data \a d0 and next entry \a n
+    Entry(Data* d0, Entry* n);
+  };
+
+  forceinline
+  IntIndex::Entry::Entry(Data* d0, Entry* n)
+    : h(d0), d(d0), next(n) {}
+
+  Support::Mutex IntIndex::m;
+
+  IntIndex::Entry* IntIndex::cache = nullptr;
+
+  /// Sort positions by value and then by position
+  class ByValPos {
+  protected:
+    /// The array
+    const IntSharedArray& c;
+  public:
+    /// Initialize with array \a c
+    ByValPos(const IntSharedArray& c);
+    /// Compare positions \a i and \a j
+    bool operator ()(const int& i, const int& j) const;
+  };
+
+  forceinline
+  ByValPos::ByValPos(const IntSharedArray& c0) : c(c0) {}
+  forceinline bool
+  ByValPos::operator ()(const int& i, const int& j) const {
+    return (c[i] < c[j]) || ((c[i] == c[j]) && (i < j));
+  }
+
+  IntIndex::Data::Data(const IntSharedArray& c0)
+    : c(c0), users(0) {
+    int n = c.size();
+    assert(n > 0);
+    vid = heap.alloc<int>(n);
+    pos = heap.alloc<int>(n);
+    for (int i=0; i<n; i++)
+      pos[i] = i;
+    ByValPos bvp(c);
+    Support::quicksort<int,ByValPos>(pos,n,bvp);
+    n_vals = 1;
+    for (int j=1; j<n; j++)
+      if (c[pos[j-1]] != c[pos[j]])
+        n_vals++;
+    val = heap.alloc<int>(n_vals);
+    fst = heap.alloc<int>(n_vals+1);
+    int k = -1;
+    for (int j=0; j<n; j++) {
+      if ((j == 0) || (c[pos[j-1]] != c[pos[j]])) {
+        k++; val[k] = c[pos[j]]; fst[k] = j;
+      }
+      vid[pos[j]] = k;
+    }
+    assert(k+1 == n_vals);
+    fst[n_vals] = n;
+  }
+
+  IntIndex::Data::~Data(void) {
+    heap.rfree(val);
+    heap.rfree(vid);
+    heap.rfree(fst);
+    heap.rfree(pos);
+  }
+
+  IntIndex
+  IntIndex::get(const IntSharedArray& c) {
+    Support::Lock l(m);
+    Data* d = nullptr;
+    Entry** p = &cache;
+    while (*p != nullptr) {
+      Entry* e = *p;
+      if ((e->d->c.size() == c.size()) && (&e->d->c[0] == &c[0])) {
+        d = e->d; p = &e->next;
+      } else if (!e->d->users) {
+        // Nobody but the cache refers to the index: drop it
+        *p = e->next;
+        delete e;
+      } else {
+        p = &e->next;
+      }
+    }
+    if (d == nullptr) {
+      d = new Data(c);
+      cache = new Entry(d,cache);
+    }
+    return IntIndex(d);
+  }
+
+}}}
+
+// STATISTICS: int-prop
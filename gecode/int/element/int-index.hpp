@@ -0,0 +1,281 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.dev
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <algorithm>
+
+namespace Gecode { namespace Int { namespace Element {
+
+  /*
+   * Shared index
+   *
+   */
+  forceinline
+  IntIndex::IntIndex(void) {}
+  forceinline
+  IntIndex::IntIndex(Data* d)
+    : SharedHandle(d) {
+    d->users.inc();
+  }
+  forceinline
+  IntIndex::IntIndex(const IntIndex& i)
+    : SharedHandle(i) {
+    if (object() != nullptr)
+      data().users.inc();
+  }
+  forceinline IntIndex&
+  IntIndex::operator =(const IntIndex& i) {
+    if (object() != i.object()) {
+      if (i.object() != nullptr)
+        i.data().users.inc();
+      if (object() != nullptr)
+        (void) data().users.dec();
+      (void) SharedHandle::operator =(i);
+    }
+    return *this;
+  }
+  forceinline
+  IntIndex::~IntIndex(void) {
+    if (object() != nullptr)
+      (void) data().users.dec();
+  }
+
+  forceinline IntIndex::Data&
+  IntIndex::data(void) const {
+    return *static_cast<Data*>(object());
+  }
+  forceinline int
+  IntIndex::size(void) const {
+    return data().c.size();
+  }
+  forceinline int
+  IntIndex::operator [](int i) const {
+    return data().c[i];
+  }
+  forceinline int
+  IntIndex::values(void) const {
+    return data().n_vals;
+  }
+  forceinline int
+  IntIndex::val(int k) const {
+    assert((k >= 0) && (k < values()));
+    return data().val[k];
+  }
+  forceinline int
+  IntIndex::vid(int i) const {
+    assert((i >= 0) && (i < size()));
+    return data().vid[i];
+  }
+  forceinline int
+  IntIndex::lq(int n) const {
+    const int* v = data().val;
+    return static_cast<int>(std::lower_bound(v,v+values(),n) - v);
+  }
+  forceinline const int*
+  IntIndex::begin(int k) const {
+    return data().pos + data().fst[k];
+  }
+  forceinline const int*
+  IntIndex::end(int k) const {
+    return data().pos + data().fst[k+1];
+  }
+
+
+  /*
+   * Iterator for supported positions
+   *
+   */
+  template<class V0, class V1>
+  forceinline
+  Indexed<V0,V1>::IterPos::IterPos(const Support::BitSetBase& b0, int o0)
+    : b(b0), o(o0), i(b0.next(0U)) {}
+  template<class V0, class V1>
+  forceinline bool
+  Indexed<V0,V1>::IterPos::operator ()(void) const {
+    return i < b.size();
+  }
+  template<class V0, class V1>
+  forceinline void
+  Indexed<V0,V1>::IterPos::operator ++(void) {
+    i = b.next(i+1U);
+  }
+  template<class V0, class V1>
+  forceinline int
+  Indexed<V0,V1>::IterPos::val(void) const {
+    return o + static_cast<int>(i);
+  }
+
+
+  /*
+   * Element propagator with shared index
+   *
+   */
+  template<class V0, class V1>
+  forceinline
+  Indexed<V0,V1>::Indexed(Home home, const IntIndex& ix0, V0 y0, V1 y1)
+    : Propagator(home), x0(y0), x1(y1), ix(ix0), o(y0.min()),
+      s(static_cast<Space&>(home),
+        static_cast<unsigned int>(y0.max()-y0.min()+1)) {
+    for (ViewRanges<V0> r(x0); r(); ++r)
+      for (int i=r.min(); i<=r.max(); i++)
+        s.set(static_cast<unsigned int>(i-o));
+    home.notice(*this,AP_DISPOSE);
+    x0.subscribe(home,*this,PC_INT_DOM);
+    x1.subscribe(home,*this,PC_INT_DOM);
+  }
+
+  template<class V0, class V1>
+  forceinline
+  Indexed<V0,V1>::Indexed(Space& home, Indexed& p)
+    : Propagator(home,p), ix(p.ix), o(p.o), s(home,p.s) {
+    x0.update(home,p.x0);
+    x1.update(home,p.x1);
+  }
+
+  template<class V0, class V1>
+  Actor*
+  Indexed<V0,V1>::copy(Space& home) {
+    return new (home) Indexed<V0,V1>(home,*this);
+  }
+
+  template<class V0, class V1>
+  PropCost
+  Indexed<V0,V1>::cost(const Space&, const ModEventDelta& med) const {
+    if ((V0::me(med) == ME_INT_VAL) ||
+        (V1::me(med) == ME_INT_VAL))
+      return PropCost::unary(PropCost::LO);
+    else
+      return PropCost::binary(PropCost::HI);
+  }
+
+  template<class V0, class V1>
+  void
+  Indexed<V0,V1>::reschedule(Space& home) {
+    x0.reschedule(home,*this,PC_INT_DOM);
+    x1.reschedule(home,*this,PC_INT_DOM);
+  }
+
+  template<class V0, class V1>
+  forceinline size_t
+  Indexed<V0,V1>::dispose(Space& home) {
+    home.ignore(*this,AP_DISPOSE);
+    x0.cancel(home,*this,PC_INT_DOM);
+    x1.cancel(home,*this,PC_INT_DOM);
+    s.dispose(home);
+    ix.~IntIndex();
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+  template<class V0, class V1>
+  ExecStatus
+  Indexed<V0,V1>::post(Home home, const IntIndex& ix, V0 x0, V1 x1) {
+    GECODE_ME_CHECK(x1.gq(home,ix.val(0)));
+    GECODE_ME_CHECK(x1.lq(home,ix.val(ix.values()-1)));
+    if (x0.assigned()) {
+      GECODE_ME_CHECK(x1.eq(home,ix[x0.val()]));
+    } else if (x1.assigned()) {
+      // Positions for a value are sorted
+      int k = ix.lq(x1.val());
+      if ((k == ix.values()) || (ix.val(k) != x1.val()))
+        return ES_FAILED;
+      Iter::Values::Array p(const_cast<int*>(ix.begin(k)),
+                            static_cast<int>(ix.end(k)-ix.begin(k)));
+      GECODE_ME_CHECK(x0.inter_v(home,p,false));
+    } else {
+      (void) new (home) Indexed<V0,V1>(home,ix,x0,x1);
+    }
+    return ES_OK;
+  }
+
+  template<class V0, class V1>
+  ExecStatus
+  Indexed<V0,V1>::propagate(Space& home, const ModEventDelta&) {
+    if (x0.assigned()) {
+      GECODE_ME_CHECK(x1.eq(home,ix[x0.val()]));
+      return home.ES_SUBSUMED(*this);
+    }
+
+    Region r;
+    // Mark the numbers of all values of x1
+    Support::BitSet<Region> vm(r,static_cast<unsigned int>(ix.values()));
+    int n_vm = 0;
+    for (ViewRanges<V1> v(x1); v(); ++v)
+      for (int k=ix.lq(v.min());
+           (k < ix.values()) && (ix.val(k) <= v.max()); k++) {
+        vm.set(static_cast<unsigned int>(k)); n_vm++;
+      }
+
+    // Remove positions not in x0 or having a value not in x1
+    {
+      unsigned int i = s.next(0U);
+      for (ViewRanges<V0> v(x0); v(); ++v) {
+        unsigned int l = static_cast<unsigned int>(v.min()-o);
+        unsigned int u = static_cast<unsigned int>(v.max()-o);
+        for ( ; i < l; i = s.next(i+1U))
+          s.clear(i);
+        for ( ; i <= u; i = s.next(i+1U))
+          if (!vm.get(static_cast<unsigned int>
+                      (ix.vid(o+static_cast<int>(i)))))
+            s.clear(i);
+      }
+      for ( ; i < s.size(); i = s.next(i+1U))
+        s.clear(i);
+    }
+    {
+      IterPos p(s,o);
+      GECODE_ME_CHECK(x0.narrow_v(home,p,false));
+    }
+
+    // Keep values that still have a supported position
+    int* sv = r.alloc<int>(n_vm);
+    int n = 0;
+    for (unsigned int k = vm.next(0U); k < vm.size(); k = vm.next(k+1U)) {
+      const int* e = ix.end(static_cast<int>(k));
+      for (const int* j = ix.begin(static_cast<int>(k)); j < e; j++)
+        if ((*j >= o) &&
+            (static_cast<unsigned int>(*j-o) < s.size()) &&
+            s.get(static_cast<unsigned int>(*j-o))) {
+          sv[n++] = ix.val(static_cast<int>(k));
+          break;
+        }
+    }
+    Iter::Values::Array v(sv,n);
+    GECODE_ME_CHECK(x1.narrow_v(home,v,false));
+
+    return (x0.assigned() || x1.assigned()) ?
+      home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -406,6 +406,8 @@ namespace Gecode { namespace Int { namespace Element {
     assert(c.size() > 0);
     GECODE_ME_CHECK(x0.gq(home,0));
     GECODE_ME_CHECK(x0.le(home,c.size()));
+    if ((c.size() >= index_min) && !shared(x0,x1))
+      return Indexed<V0,V1>::post(home,IntIndex::get(c),x0,x1);
     Support::IntType idx_type = Support::s_type(c.size());
     int min = c[0];
     int max = c[0];
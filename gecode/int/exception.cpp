@@ -80,6 +80,9 @@ namespace Gecode { namespace Int {
   AlreadyFinalized::AlreadyFinalized(const char* l)
     : Exception(l,"Tuple set already finalized") {}
 
+  InvalidFile::InvalidFile(const char* l)
+    : Exception(l,"File cannot be accessed or has invalid format") {}
+
   LDSBUnbranchedVariable::LDSBUnbranchedVariable(const char* l)
     : Exception(l,"Variable in symmetry not branched on") {}
 
@@ -146,6 +146,13 @@ namespace Gecode { namespace Int {
     AlreadyFinalized(const char* l);
   };
 
+  /// %Exception: File cannot be accessed or has invalid format
+  class GECODE_INT_EXPORT InvalidFile : public Exception {
+  public:
+    /// Initialize with location \a l
+    InvalidFile(const char* l);
+  };
+
   /// %Exception: Variable in symmetry not branched on
   class GECODE_INT_EXPORT LDSBUnbranchedVariable : public Exception {
   public:
@@ -241,11 +241,200 @@ namespace Gecode { namespace Int { namespace Extensional {
 
 #include <gecode/int/extensional/layered-graph.hpp>
 
+namespace Gecode { namespace Int { namespace Extensional {
+
+  /**
+   * \brief Domain consistent propagator for extensional constraints described by an %MDD
+   *
+   * The nodes and edges of the %MDD are shared (also between clones)
+   * and never change. A propagator only maintains the number of
+   * remaining incoming and outgoing edges of each node, the number of
+   * remaining edges of each value, and which nodes and values have
+   * been removed. When a node loses its last incoming or outgoing
+   * edge, all its edges are removed. A value is pruned when it loses
+   * its last edge.
+   *
+   * The propagator is not capable of dealing with multiple occurrences
+   * of the same view.
+   *
+   * Requires \code #include <gecode/int/extensional.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class View>
+  class DecisionDiagram : public Propagator {
+  protected:
+    /// %Advisors for views (by position in array)
+    class Index : public Advisor {
+    public:
+      /// The position of the view in the view array
+      int i;
+      /// Create index advisor
+      Index(Space& home, Propagator& p, Council<Index>& c, int i);
+      /// Clone index advisor \a a
+      Index(Space& home, Index& a);
+    };
+    /// Iterator over the values of a layer of an %MDD
+    class LayerValues {
+    private:
+      /// Current support
+      const MDD::Support* s1;
+      /// End of supports
+      const MDD::Support* s2;
+    public:
+      /// Initialize for layer \a i of %MDD \a m
+      LayerValues(const MDD::MDDI& m, int i);
+      /// Test whether there are values left
+      bool operator ()(void) const;
+      /// Move to next value
+      void operator ++(void);
+      /// Return value
+      int val(void) const;
+    };
+    /// The advisor council
+    Council<Index> c;
+    /// The views
+    ViewArray<View> x;
+    /// The decision diagram
+    MDD mdd;
+    /// Number of remaining incoming edges of each node
+    int* i_deg;
+    /// Number of remaining outgoing edges of each node
+    int* o_deg;
+    /// Number of remaining edges of each support
+    int* s_cnt;
+    /// Which nodes have not been removed
+    Gecode::Support::BitSetBase n_alive;
+    /// Which supports have not been removed
+    Gecode::Support::BitSetBase s_alive;
+    /// First layer with removed values
+    int ch_fst;
+    /// Last layer with removed values
+    int ch_lst;
+    /// Whether the propagator is pruning views itself
+    bool pruning;
+    /// Stack of nodes without incoming or outgoing edges
+    typedef Gecode::Support::DynamicStack<int,Region> NodeStack;
+    /// Remove edge \a e (pushing nodes without edges on \a ns)
+    void remove(const MDD::MDDI& m, const MDD::Edge& e, NodeStack& ns);
+    /// Return layer of node \a v
+    static int layer(const MDD::MDDI& m, int v);
+    /// Constructor for cloning \a p
+    DecisionDiagram(Space& home, DecisionDiagram<View>& p);
+    /// Constructor for posting
+    DecisionDiagram(Home home, ViewArray<View>& x, const MDD& m);
+  public:
+    /// Copy propagator during cloning
+    virtual Actor* copy(Space& home);
+    /// Cost function (defined as high linear)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+    /// Post propagator on views \a x and %MDD \a m
+    static ExecStatus post(Home home, ViewArray<View>& x, const MDD& m);
+  };
+
+}}}
+
+#include <gecode/int/extensional/decision-diagram.hpp>
+
 namespace Gecode { namespace Int { namespace Extensional {
 
   /// Import type
   typedef Gecode::Support::BitSetData BitSetData;
 
+  /**
+   * \brief Instruction sets for the word kernels of bit-sets
+   *
+   * The word kernels perform the mask-building and intersection loops
+   * of large bit-sets. By default, the scalar kernels are used: the
+   * vector kernels are not faster on the tested processors and are
+   * used only if requested by word_kernel(WordKernel).
+   */
+  enum WordKernel {
+    WK_SCALAR, ///< Portable scalar kernels
+    WK_AVX2,   ///< AVX2 kernels
+    WK_AVX512  ///< AVX-512 kernels
+  };
+  /// Return the instruction set used by the word kernels
+  GECODE_INT_EXPORT WordKernel word_kernel(void);
+  /**
+   * \brief Use the instruction set \a wk for the word kernels
+   *
+   * If \a wk is not supported, the best supported instruction set
+   * below \a wk is used. Returns the instruction set used. Must not be
+   * called while propagators are running in other threads.
+   */
+  GECODE_INT_EXPORT WordKernel word_kernel(WordKernel wk);
+  /// Minimal number of active words for which the word kernels are used
+  const unsigned int word_kernel_min = 16U;
+
+  /**
+   * \name Word kernels for bit-sets
+   *
+   * The kernels operate on \a n words, where \a x maps the words of
+   * \a b to the words of the masks. The kernels that intersect return
+   * whether some word of \a b has become empty.
+   */
+  //@{
+  /// Perform \f$b_i\gets b_i\wedge m_i\f$ for \f$0\leq i<n\f$
+  GECODE_INT_EXPORT bool
+  and_words(BitSetData* b, const BitSetData* m, unsigned int n);
+  /// Perform \f$b_i\gets b_i\wedge m_{x_i}\f$ for \f$0\leq i<n\f$
+  GECODE_INT_EXPORT bool
+  and_words(BitSetData* b, const BitSetData* m,
+            const unsigned char* x, unsigned int n);
+  /// Perform \f$b_i\gets b_i\wedge m_{x_i}\f$ for \f$0\leq i<n\f$
+  GECODE_INT_EXPORT bool
+  and_words(BitSetData* b, const BitSetData* m,
+            const unsigned short int* x, unsigned int n);
+  /// Perform \f$b_i\gets b_i\wedge m_{x_i}\f$ for \f$0\leq i<n\f$
+  GECODE_INT_EXPORT bool
+  and_words(BitSetData* b, const BitSetData* m,
+            const unsigned int* x, unsigned int n);
+  /// Perform \f$b_i\gets b_i\wedge (m_{x_i}\vee o_{x_i})\f$ for \f$0\leq i<n\f$
+  GECODE_INT_EXPORT bool
+  and_or_words(BitSetData* b, const BitSetData* m, const BitSetData* o,
+               const unsigned char* x, unsigned int n);
+  /// Perform \f$b_i\gets b_i\wedge (m_{x_i}\vee o_{x_i})\f$ for \f$0\leq i<n\f$
+  GECODE_INT_EXPORT bool
+  and_or_words(BitSetData* b, const BitSetData* m, const BitSetData* o,
+               const unsigned short int* x, unsigned int n);
+  /// Perform \f$b_i\gets b_i\wedge (m_{x_i}\vee o_{x_i})\f$ for \f$0\leq i<n\f$
+  GECODE_INT_EXPORT bool
+  and_or_words(BitSetData* b, const BitSetData* m, const BitSetData* o,
+               const unsigned int* x, unsigned int n);
+  /// Perform \f$b_i\gets b_i\wedge\neg m_{x_i}\f$ for \f$0\leq i<n\f$
+  GECODE_INT_EXPORT bool
+  nand_words(BitSetData* b, const BitSetData* m,
+             const unsigned char* x, unsigned int n);
+  /// Perform \f$b_i\gets b_i\wedge\neg m_{x_i}\f$ for \f$0\leq i<n\f$
+  GECODE_INT_EXPORT bool
+  nand_words(BitSetData* b, const BitSetData* m,
+             const unsigned short int* x, unsigned int n);
+  /// Perform \f$b_i\gets b_i\wedge\neg m_{x_i}\f$ for \f$0\leq i<n\f$
+  GECODE_INT_EXPORT bool
+  nand_words(BitSetData* b, const BitSetData* m,
+             const unsigned int* x, unsigned int n);
+  /// Perform \f$b_i\gets b_i\vee m_{x_i}\f$ for \f$0\leq i<n\f$
+  GECODE_INT_EXPORT void
+  or_words(BitSetData* b, const BitSetData* m,
+           const unsigned char* x, unsigned int n);
+  /// Perform \f$b_i\gets b_i\vee m_{x_i}\f$ for \f$0\leq i<n\f$
+  GECODE_INT_EXPORT void
+  or_words(BitSetData* b, const BitSetData* m,
+           const unsigned short int* x, unsigned int n);
+  /// Perform \f$b_i\gets b_i\vee m_{x_i}\f$ for \f$0\leq i<n\f$
+  GECODE_INT_EXPORT void
+  or_words(BitSetData* b, const BitSetData* m,
+           const unsigned int* x, unsigned int n);
+  //@}
+
   /*
    * Forward declarations
    */
@@ -269,6 +458,10 @@ namespace Gecode { namespace Int { namespace Extensional {
     IndexType* _active_position;
     /// Replace active word \a active_pos, dropping it if \a word is zero
     void replace_and_decrease(IndexType active_pos, BitSetData word);
+    /// Drop the empty active word \a active_pos
+    void decrease(IndexType active_pos);
+    /// Drop all empty active words
+    void compact(void);
   public:
     /// Initialize bit set for a number of words \a n
     BitSet(Space& home, unsigned int n, bool indexed=false);
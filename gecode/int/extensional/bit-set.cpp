@@ -0,0 +1,445 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.dev
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/int/extensional.hh>
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef GECODE_HAS_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace Gecode { namespace Int { namespace Extensional {
+
+  namespace {
+
+    /*
+     * Scalar kernels
+     *
+     */
+    bool
+    and_words_scalar(BitSetData* b, const BitSetData* m, unsigned int n) {
+      bool e = false;
+      for (unsigned int i=0; i<n; i++) {
+        b[i] = BitSetData::a(b[i],m[i]);
+        e |= b[i].none();
+      }
+      return e;
+    }
+
+    template<class IndexType>
+    bool
+    and_words_scalar(BitSetData* b, const BitSetData* m,
+               const IndexType* x, unsigned int n) {
+      bool e = false;
+      for (unsigned int i=0; i<n; i++) {
+        b[i] = BitSetData::a(b[i],m[x[i]]);
+        e |= b[i].none();
+      }
+      return e;
+    }
+
+    template<class IndexType>
+    bool
+    and_or_words_scalar(BitSetData* b, const BitSetData* m, const BitSetData* o,
+                  const IndexType* x, unsigned int n) {
+      bool e = false;
+      for (unsigned int i=0; i<n; i++) {
+        b[i] = BitSetData::a(b[i],BitSetData::o(m[x[i]],o[x[i]]));
+        e |= b[i].none();
+      }
+      return e;
+    }
+
+    template<class IndexType>
+    bool
+    nand_words_scalar(BitSetData* b, const BitSetData* m,
+                const IndexType* x, unsigned int n) {
+      bool e = false;
+      for (unsigned int i=0; i<n; i++) {
+        b[i] = BitSetData::a(b[i],~m[x[i]]);
+        e |= b[i].none();
+      }
+      return e;
+    }
+
+    template<class IndexType>
+    void
+    or_words_scalar(BitSetData* b, const BitSetData* m,
+              const IndexType* x, unsigned int n) {
+      for (unsigned int i=0; i<n; i++)
+        b[i] = BitSetData::o(b[i],m[x[i]]);
+    }
+
+#ifdef GECODE_HAS_X86_KERNELS
+
+    /*
+     * AVX2 kernels: four words at a time
+     *
+     */
+
+    /// Load four indices as 32-bit integers
+    __attribute__((target("avx2"))) inline __m128i
+    idx4(const unsigned char* x) {
+      int v; std::memcpy(&v,x,sizeof(int));
+      return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(v));
+    }
+    __attribute__((target("avx2"))) inline __m128i
+    idx4(const unsigned short int* x) {
+      return _mm_cvtepu16_epi32
+        (_mm_loadl_epi64(reinterpret_cast<const __m128i*>(x)));
+    }
+    __attribute__((target("avx2"))) inline __m128i
+    idx4(const unsigned int* x) {
+      return _mm_loadu_si128(reinterpret_cast<const __m128i*>(x));
+    }
+
+    /// Gather the words of \a m at indices \a x
+    template<class IndexType>
+    __attribute__((target("avx2"))) inline __m256i
+    gather4(const BitSetData* m, const IndexType* x) {
+      return _mm256_i32gather_epi64
+        (reinterpret_cast<const long long int*>(m),idx4(x),8);
+    }
+
+    /// Test whether some word in \a v is empty
+    __attribute__((target("avx2"))) inline bool
+    empty4(__m256i v) {
+      return _mm256_movemask_epi8
+        (_mm256_cmpeq_epi64(v,_mm256_setzero_si256())) != 0;
+    }
+
+    __attribute__((target("avx2"))) bool
+    and_words_avx2(BitSetData* b, const BitSetData* m, unsigned int n) {
+      __m256i* vb = reinterpret_cast<__m256i*>(b);
+      const __m256i* vm = reinterpret_cast<const __m256i*>(m);
+      bool e = false;
+      unsigned int i = 0;
+      for (; i+4 <= n; i += 4, vb++, vm++) {
+        __m256i v = _mm256_and_si256(_mm256_loadu_si256(vb),
+                                     _mm256_loadu_si256(vm));
+        _mm256_storeu_si256(vb,v);
+        e |= empty4(v);
+      }
+      return and_words_scalar(b+i,m+i,n-i) || e;
+    }
+
+    template<class IndexType>
+    __attribute__((target("avx2"))) bool
+    and_words_avx2(BitSetData* b, const BitSetData* m,
+             const IndexType* x, unsigned int n) {
+      bool e = false;
+      unsigned int i = 0;
+      for (; i+4 <= n; i += 4) {
+        __m256i* vb = reinterpret_cast<__m256i*>(b+i);
+        __m256i v = _mm256_and_si256(_mm256_loadu_si256(vb),
+                                     gather4(m,x+i));
+        _mm256_storeu_si256(vb,v);
+        e |= empty4(v);
+      }
+      return and_words_scalar(b+i,m,x+i,n-i) || e;
+    }
+
+    template<class IndexType>
+    __attribute__((target("avx2"))) bool
+    and_or_words_avx2(BitSetData* b, const BitSetData* m, const BitSetData* o,
+                const IndexType* x, unsigned int n) {
+      bool e = false;
+      unsigned int i = 0;
+      for (; i+4 <= n; i += 4) {
+        __m256i* vb = reinterpret_cast<__m256i*>(b+i);
+        __m128i vx = idx4(x+i);
+        __m256i vo = _mm256_or_si256
+          (_mm256_i32gather_epi64
+           (reinterpret_cast<const long long int*>(m),vx,8),
+           _mm256_i32gather_epi64
+           (reinterpret_cast<const long long int*>(o),vx,8));
+        __m256i v = _mm256_and_si256(_mm256_loadu_si256(vb),vo);
+        _mm256_storeu_si256(vb,v);
+        e |= empty4(v);
+      }
+      return and_or_words_scalar(b+i,m,o,x+i,n-i) || e;
+    }
+
+    template<class IndexType>
+    __attribute__((target("avx2"))) bool
+    nand_words_avx2(BitSetData* b, const BitSetData* m,
+              const IndexType* x, unsigned int n) {
+      bool e = false;
+      unsigned int i = 0;
+      for (; i+4 <= n; i += 4) {
+        __m256i* vb = reinterpret_cast<__m256i*>(b+i);
+        __m256i v = _mm256_andnot_si256(gather4(m,x+i),
+                                        _mm256_loadu_si256(vb));
+        _mm256_storeu_si256(vb,v);
+        e |= empty4(v);
+      }
+      return nand_words_scalar(b+i,m,x+i,n-i) || e;
+    }
+
+    template<class IndexType>
+    __attribute__((target("avx2"))) void
+    or_words_avx2(BitSetData* b, const BitSetData* m,
+            const IndexType* x, unsigned int n) {
+      unsigned int i = 0;
+      for (; i+4 <= n; i += 4) {
+        __m256i* vb = reinterpret_cast<__m256i*>(b+i);
+        _mm256_storeu_si256(vb,_mm256_or_si256(_mm256_loadu_si256(vb),
+                                               gather4(m,x+i)));
+      }
+      or_words_scalar(b+i,m,x+i,n-i);
+    }
+
+
+    /*
+     * AVX-512 kernels: eight words at a time
+     *
+     */
+
+    /// Load eight indices as 32-bit integers
+    __attribute__((target("avx512f"))) inline __m256i
+    idx8(const unsigned char* x) {
+      return _mm256_cvtepu8_epi32
+        (_mm_loadl_epi64(reinterpret_cast<const __m128i*>(x)));
+    }
+    __attribute__((target("avx512f"))) inline __m256i
+    idx8(const unsigned short int* x) {
+      return _mm256_cvtepu16_epi32
+        (_mm_loadu_si128(reinterpret_cast<const __m128i*>(x)));
+    }
+    __attribute__((target("avx512f"))) inline __m256i
+    idx8(const unsigned int* x) {
+      return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x));
+    }
+
+    /// Gather the words of \a m at indices \a x
+    template<class IndexType>
+    __attribute__((target("avx512f"))) inline __m512i
+    gather8(const BitSetData* m, const IndexType* x) {
+      return _mm512_i32gather_epi64(idx8(x),m,8);
+    }
+
+    /// Test whether some word in \a v is empty
+    __attribute__((target("avx512f"))) inline bool
+    empty8(__m512i v) {
+      return _mm512_test_epi64_mask(v,v) != 0xff;
+    }
+
+    __attribute__((target("avx512f"))) bool
+    and_words_avx512(BitSetData* b, const BitSetData* m, unsigned int n) {
+      bool e = false;
+      unsigned int i = 0;
+      for (; i+8 <= n; i += 8) {
+        __m512i v = _mm512_and_si512(_mm512_loadu_si512(b+i),
+                                     _mm512_loadu_si512(m+i));
+        _mm512_storeu_si512(b+i,v);
+        e |= empty8(v);
+      }
+      return and_words_scalar(b+i,m+i,n-i) || e;
+    }
+
+    template<class IndexType>
+    __attribute__((target("avx512f"))) bool
+    and_words_avx512(BitSetData* b, const BitSetData* m,
+               const IndexType* x, unsigned int n) {
+      bool e = false;
+      unsigned int i = 0;
+      for (; i+8 <= n; i += 8) {
+        __m512i v = _mm512_and_si512(_mm512_loadu_si512(b+i),
+                                     gather8(m,x+i));
+        _mm512_storeu_si512(b+i,v);
+        e |= empty8(v);
+      }
+      return and_words_scalar(b+i,m,x+i,n-i) || e;
+    }
+
+    template<class IndexType>
+    __attribute__((target("avx512f"))) bool
+    and_or_words_avx512(BitSetData* b, const BitSetData* m, const BitSetData* o,
+                  const IndexType* x, unsigned int n) {
+      bool e = false;
+      unsigned int i = 0;
+      for (; i+8 <= n; i += 8) {
+        __m256i vx = idx8(x+i);
+        __m512i vo = _mm512_or_si512(_mm512_i32gather_epi64(vx,m,8),
+                                     _mm512_i32gather_epi64(vx,o,8));
+        __m512i v = _mm512_and_si512(_mm512_loadu_si512(b+i),vo);
+        _mm512_storeu_si512(b+i,v);
+        e |= empty8(v);
+      }
+      return and_or_words_scalar(b+i,m,o,x+i,n-i) || e;
+    }
+
+    template<class IndexType>
+    __attribute__((target("avx512f"))) bool
+    nand_words_avx512(BitSetData* b, const BitSetData* m,
+                const IndexType* x, unsigned int n) {
+      bool e = false;
+      unsigned int i = 0;
+      for (; i+8 <= n; i += 8) {
+        __m512i v = _mm512_andnot_si512(gather8(m,x+i),
+                                        _mm512_loadu_si512(b+i));
+        _mm512_storeu_si512(b+i,v);
+        e |= empty8(v);
+      }
+      return nand_words_scalar(b+i,m,x+i,n-i) || e;
+    }
+
+    template<class IndexType>
+    __attribute__((target("avx512f"))) void
+    or_words_avx512(BitSetData* b, const BitSetData* m,
+              const IndexType* x, unsigned int n) {
+      unsigned int i = 0;
+      for (; i+8 <= n; i += 8)
+        _mm512_storeu_si512(b+i,_mm512_or_si512(_mm512_loadu_si512(b+i),
+                                                gather8(m,x+i)));
+      or_words_scalar(b+i,m,x+i,n-i);
+    }
+
+#endif
+
+    /// Return the best instruction set supported by the processor
+    WordKernel
+    supported(void) {
+#ifdef GECODE_HAS_X86_KERNELS
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx512f"))
+        return WK_AVX512;
+      if (__builtin_cpu_supports("avx2"))
+        return WK_AVX2;
+#endif
+      return WK_SCALAR;
+    }
+
+    /// The instruction set in use (vector kernels must be requested)
+    WordKernel wk_used = WK_SCALAR;
+
+  }
+
+  WordKernel
+  word_kernel(void) {
+    return wk_used;
+  }
+
+  WordKernel
+  word_kernel(WordKernel wk) {
+    wk_used = std::min(wk,supported());
+    return wk_used;
+  }
+
+#ifdef GECODE_HAS_X86_KERNELS
+#define GECODE_INT_WORD_KERNEL(NAME,ARGS)       \
+  switch (wk_used) {                            \
+  case WK_AVX512: return NAME ## _avx512 ARGS;  \
+  case WK_AVX2:   return NAME ## _avx2 ARGS;    \
+  default:        return NAME ## _scalar ARGS;  \
+  }
+#else
+#define GECODE_INT_WORD_KERNEL(NAME,ARGS)       \
+  return NAME ## _scalar ARGS;
+#endif
+
+  bool
+  and_words(BitSetData* b, const BitSetData* m, unsigned int n) {
+    GECODE_INT_WORD_KERNEL(and_words,(b,m,n));
+  }
+  bool
+  and_words(BitSetData* b, const BitSetData* m,
+            const unsigned char* x, unsigned int n) {
+    GECODE_INT_WORD_KERNEL(and_words,(b,m,x,n));
+  }
+  bool
+  and_words(BitSetData* b, const BitSetData* m,
+            const unsigned short int* x, unsigned int n) {
+    GECODE_INT_WORD_KERNEL(and_words,(b,m,x,n));
+  }
+  bool
+  and_words(BitSetData* b, const BitSetData* m,
+            const unsigned int* x, unsigned int n) {
+    GECODE_INT_WORD_KERNEL(and_words,(b,m,x,n));
+  }
+
+  bool
+  and_or_words(BitSetData* b, const BitSetData* m, const BitSetData* o,
+               const unsigned char* x, unsigned int n) {
+    GECODE_INT_WORD_KERNEL(and_or_words,(b,m,o,x,n));
+  }
+  bool
+  and_or_words(BitSetData* b, const BitSetData* m, const BitSetData* o,
+               const unsigned short int* x, unsigned int n) {
+    GECODE_INT_WORD_KERNEL(and_or_words,(b,m,o,x,n));
+  }
+  bool
+  and_or_words(BitSetData* b, const BitSetData* m, const BitSetData* o,
+               const unsigned int* x, unsigned int n) {
+    GECODE_INT_WORD_KERNEL(and_or_words,(b,m,o,x,n));
+  }
+
+  bool
+  nand_words(BitSetData* b, const BitSetData* m,
+             const unsigned char* x, unsigned int n) {
+    GECODE_INT_WORD_KERNEL(nand_words,(b,m,x,n));
+  }
+  bool
+  nand_words(BitSetData* b, const BitSetData* m,
+             const unsigned short int* x, unsigned int n) {
+    GECODE_INT_WORD_KERNEL(nand_words,(b,m,x,n));
+  }
+  bool
+  nand_words(BitSetData* b, const BitSetData* m,
+             const unsigned int* x, unsigned int n) {
+    GECODE_INT_WORD_KERNEL(nand_words,(b,m,x,n));
+  }
+
+  void
+  or_words(BitSetData* b, const BitSetData* m,
+           const unsigned char* x, unsigned int n) {
+    GECODE_INT_WORD_KERNEL(or_words,(b,m,x,n));
+  }
+  void
+  or_words(BitSetData* b, const BitSetData* m,
+           const unsigned short int* x, unsigned int n) {
+    GECODE_INT_WORD_KERNEL(or_words,(b,m,x,n));
+  }
+  void
+  or_words(BitSetData* b, const BitSetData* m,
+           const unsigned int* x, unsigned int n) {
+    GECODE_INT_WORD_KERNEL(or_words,(b,m,x,n));
+  }
+
+#undef GECODE_INT_WORD_KERNEL
+
+}}}
+
+// STATISTICS: int-prop
@@ -190,6 +190,22 @@ namespace Gecode { namespace Int { namespace Extensional {
     GECODE_NEVER;
   }
 
+  template<class IndexType>
+  forceinline void
+  BitSet<IndexType>::decrease(IndexType active_pos) {
+    assert(_word_bits[active_pos].none());
+    const IndexType removed_word_index = _word_index[active_pos];
+    _active_words--;
+    const IndexType moved_word_index = _word_index[_active_words];
+    _word_bits[active_pos] = _word_bits[_active_words];
+    _word_index[active_pos] = moved_word_index;
+    if (_active_position != nullptr) {
+      _active_position[removed_word_index] = 0;
+      if (active_pos < _active_words)
+        _active_position[moved_word_index] = active_pos+1;
+    }
+  }
+
   template<class IndexType>
   forceinline void
   BitSet<IndexType>::replace_and_decrease(IndexType active_pos,
@@ -198,22 +214,20 @@ namespace Gecode { namespace Int { namespace Extensional {
     BitSetData old_word = _word_bits[active_pos];
     if (word != old_word) {
       _word_bits[active_pos] = word;
-      if (word.none()) {
-        assert(_word_bits[active_pos].none());
-        const IndexType removed_word_index = _word_index[active_pos];
-        _active_words--;
-        const IndexType moved_word_index = _word_index[_active_words];
-        _word_bits[active_pos] = _word_bits[_active_words];
-        _word_index[active_pos] = moved_word_index;
-        if (_active_position != nullptr) {
-          _active_position[removed_word_index] = 0;
-          if (active_pos < _active_words)
-            _active_position[moved_word_index] = active_pos+1;
-        }
-      }
+      if (word.none())
+        decrease(active_pos);
     }
   }
 
+  template<class IndexType>
+  forceinline void
+  BitSet<IndexType>::compact(void) {
+    // Same order of removal as for replace_and_decrease in a downward loop
+    for (IndexType i = _active_words; i--; )
+      if (_word_bits[i].none())
+        decrease(i);
+  }
+
   template<class IndexType>
   forceinline void
   BitSet<IndexType>::clear_mask(BitSetData* mask) const {
@@ -229,6 +243,10 @@ namespace Gecode { namespace Int { namespace Extensional {
   BitSet<IndexType>::add_to_mask(const BitSetData* support,
                                  BitSetData* mask) const {
     assert(_active_words > 0U);
+    if (_active_words >= word_kernel_min) {
+      or_words(mask,support,_word_index,_active_words);
+      return;
+    }
     for (IndexType i=0; i<_active_words; i++)
       mask[i] = BitSetData::o(mask[i],support[_word_index[i]]);
   }
@@ -264,6 +282,12 @@ namespace Gecode { namespace Int { namespace Extensional {
   forceinline void
   BitSet<IndexType>::intersect_with_mask(const BitSetData* mask) {
     assert(_active_words > 0U);
+    if (_active_words >= word_kernel_min) {
+      if (sparse ? and_words(_word_bits,mask,_word_index,_active_words) :
+          and_words(_word_bits,mask,_active_words))
+        compact();
+      return;
+    }
     if (sparse) {
       for (IndexType i = _active_words; i--; ) {
         assert(!_word_bits[i].none());
@@ -308,6 +332,11 @@ namespace Gecode { namespace Int { namespace Extensional {
   BitSet<IndexType>::intersect_with_masks(const BitSetData* a,
                                           const BitSetData* b) {
     assert(_active_words > 0U);
+    if (_active_words >= word_kernel_min) {
+      if (and_or_words(_word_bits,a,b,_word_index,_active_words))
+        compact();
+      return;
+    }
     for (IndexType i = _active_words; i--; ) {
       assert(!_word_bits[i].none());
       BitSetData old_word = _word_bits[i];
@@ -349,6 +378,11 @@ namespace Gecode { namespace Int { namespace Extensional {
   forceinline void
   BitSet<IndexType>::nand_with_mask(const BitSetData* mask) {
     assert(_active_words > 0U);
+    if (_active_words >= word_kernel_min) {
+      if (nand_words(_word_bits,mask,_word_index,_active_words))
+        compact();
+      return;
+    }
     for (IndexType i = _active_words; i--; ) {
       assert(!_word_bits[i].none());
       BitSetData new_word =
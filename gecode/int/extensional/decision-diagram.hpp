@@ -0,0 +1,287 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.dev
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Int { namespace Extensional {
+
+  /*
+   * Index advisors
+   *
+   */
+  template<class View>
+  forceinline
+  DecisionDiagram<View>::Index::Index(Space& home, Propagator& p,
+                                      Council<Index>& c, int i0)
+    : Advisor(home,p,c), i(i0) {}
+
+  template<class View>
+  forceinline
+  DecisionDiagram<View>::Index::Index(Space& home, Index& a)
+    : Advisor(home,a), i(a.i) {}
+
+
+  /*
+   * Value iterator
+   *
+   */
+  template<class View>
+  forceinline
+  DecisionDiagram<View>::LayerValues::LayerValues(const MDD::MDDI& m, int i)
+    : s1(m.support+m.s_layer[i]), s2(m.support+m.s_layer[i+1]) {}
+  template<class View>
+  forceinline bool
+  DecisionDiagram<View>::LayerValues::operator ()(void) const {
+    return s1<s2;
+  }
+  template<class View>
+  forceinline void
+  DecisionDiagram<View>::LayerValues::operator ++(void) {
+    s1++;
+  }
+  template<class View>
+  forceinline int
+  DecisionDiagram<View>::LayerValues::val(void) const {
+    return s1->val;
+  }
+
+
+  /*
+   * The propagator
+   *
+   */
+  template<class View>
+  forceinline
+  DecisionDiagram<View>::DecisionDiagram(Home home, ViewArray<View>& x0,
+                                         const MDD& m)
+    : Propagator(home), c(home), x(x0), mdd(m),
+      ch_fst(0), ch_lst(x0.size()-1), pruning(false) {
+    home.notice(*this,AP_DISPOSE);
+    Space& h = home;
+    const MDD::MDDI& d = *mdd.mddi();
+    i_deg = h.alloc<int>(d.n_nodes);
+    o_deg = h.alloc<int>(d.n_nodes);
+    for (int v=0; v<d.n_nodes; v++) {
+      i_deg[v] = d.i_fst[v+1] - d.i_fst[v];
+      o_deg[v] = d.o_fst[v+1] - d.o_fst[v];
+    }
+    // The root and the terminal never lose their virtual edges
+    i_deg[0] = 1; o_deg[d.n_nodes-1] = 1;
+    s_cnt = h.alloc<int>(d.n_supports);
+    for (int s=0; s<d.n_supports; s++)
+      s_cnt[s] = d.support[s].lst - d.support[s].fst;
+    n_alive.init(h,static_cast<unsigned int>(d.n_nodes),true);
+    s_alive.init(h,static_cast<unsigned int>(d.n_supports),true);
+    for (int i=0; i<x.size(); i++)
+      if (!x[i].assigned())
+        x[i].subscribe(home, *new (home) Index(home,*this,c,i));
+    // Remove edges for values that are not in the domains
+    View::schedule(home,*this,ME_INT_DOM);
+  }
+
+  template<class View>
+  ExecStatus
+  DecisionDiagram<View>::post(Home home, ViewArray<View>& x, const MDD& m) {
+    if (m.arity() != x.size())
+      throw ArgumentSizeMismatch("Int::extensional");
+    if (m.empty())
+      return ES_FAILED;
+    if (x.size() == 0)
+      return ES_OK;
+    const MDD::MDDI& d = *m.mddi();
+    for (int i=0; i<x.size(); i++) {
+      LayerValues lv(d,i);
+      GECODE_ME_CHECK(x[i].inter_v(home,lv,false));
+    }
+    (void) new (home) DecisionDiagram<View>(home,x,m);
+    return ES_OK;
+  }
+
+  template<class View>
+  forceinline
+  DecisionDiagram<View>::DecisionDiagram(Space& home, DecisionDiagram<View>& p)
+    : Propagator(home,p), mdd(p.mdd),
+      n_alive(home,p.n_alive), s_alive(home,p.s_alive),
+      ch_fst(p.ch_fst), ch_lst(p.ch_lst), pruning(false) {
+    c.update(home,p.c);
+    x.update(home,p.x);
+    const MDD::MDDI& d = *mdd.mddi();
+    i_deg = Heap::copy(home.alloc<int>(d.n_nodes),p.i_deg,d.n_nodes);
+    o_deg = Heap::copy(home.alloc<int>(d.n_nodes),p.o_deg,d.n_nodes);
+    s_cnt = Heap::copy(home.alloc<int>(d.n_supports),p.s_cnt,d.n_supports);
+  }
+
+  template<class View>
+  Actor*
+  DecisionDiagram<View>::copy(Space& home) {
+    return new (home) DecisionDiagram<View>(home,*this);
+  }
+
+  template<class View>
+  PropCost
+  DecisionDiagram<View>::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::linear(PropCost::HI,x.size());
+  }
+
+  template<class View>
+  void
+  DecisionDiagram<View>::reschedule(Space& home) {
+    View::schedule(home,*this,c.empty() ? ME_INT_VAL : ME_INT_DOM);
+  }
+
+  template<class View>
+  ExecStatus
+  DecisionDiagram<View>::advise(Space& home, Advisor& _a, const Delta& d) {
+    Index& a = static_cast<Index&>(_a);
+    if (pruning) {
+      // Values have been pruned by the propagator itself
+      return (View::modevent(d) == ME_INT_VAL)
+        ? home.ES_FIX_DISPOSE(c,a) : ES_FIX;
+    }
+    ch_fst = std::min(ch_fst,a.i);
+    ch_lst = std::max(ch_lst,a.i);
+    return (View::modevent(d) == ME_INT_VAL)
+      ? home.ES_NOFIX_DISPOSE(c,a) : ES_NOFIX;
+  }
+
+  template<class View>
+  forceinline void
+  DecisionDiagram<View>::remove(const MDD::MDDI&, const MDD::Edge& e,
+                                NodeStack& ns) {
+    s_cnt[e.sup]--;
+    if (--o_deg[e.src] == 0)
+      ns.push(e.src);
+    if (--i_deg[e.dst] == 0)
+      ns.push(e.dst);
+  }
+
+  template<class View>
+  forceinline int
+  DecisionDiagram<View>::layer(const MDD::MDDI& m, int v) {
+    int l = 0, h = m.n;
+    // Find last layer starting not after v
+    while (l < h) {
+      int k = l + (h - l + 1) / 2;
+      if (m.layer[k] <= v)
+        l = k;
+      else
+        h = k-1;
+    }
+    return l;
+  }
+
+  template<class View>
+  ExecStatus
+  DecisionDiagram<View>::propagate(Space& home, const ModEventDelta&) {
+    const MDD::MDDI& d = *mdd.mddi();
+    Region r;
+    NodeStack ns(r);
+
+    // Remove edges for values that are not in the domains any longer
+    for (int i=ch_fst; i<=ch_lst; i++)
+      for (int s=d.s_layer[i]; s<d.s_layer[i+1]; s++)
+        if (s_alive.get(static_cast<unsigned int>(s)) &&
+            !x[i].in(d.support[s].val)) {
+          s_alive.clear(static_cast<unsigned int>(s));
+          for (int k=d.support[s].fst; k<d.support[s].lst; k++) {
+            const MDD::Edge& e = d.edge[k];
+            if (n_alive.get(static_cast<unsigned int>(e.src)) &&
+                n_alive.get(static_cast<unsigned int>(e.dst)))
+              remove(d,e,ns);
+          }
+        }
+    ch_fst = INT_MAX; ch_lst = INT_MIN;
+
+    // Layers with values that lost all their edges
+    int p_fst = INT_MAX, p_lst = INT_MIN;
+
+    // Remove nodes without incoming or outgoing edges
+    while (!ns.empty()) {
+      int v = ns.pop();
+      if (!n_alive.get(static_cast<unsigned int>(v)))
+        continue;
+      if ((v == 0) || (v == d.n_nodes-1))
+        return ES_FAILED;
+      n_alive.clear(static_cast<unsigned int>(v));
+      int l = layer(d,v);
+      for (int k=d.o_fst[v]; k<d.o_fst[v+1]; k++) {
+        const MDD::Edge& e = d.edge[d.o_edge[k]];
+        if (s_alive.get(static_cast<unsigned int>(e.sup)) &&
+            n_alive.get(static_cast<unsigned int>(e.dst))) {
+          if (--s_cnt[e.sup] == 0) {
+            p_fst = std::min(p_fst,l); p_lst = std::max(p_lst,l);
+          }
+          if (--i_deg[e.dst] == 0)
+            ns.push(e.dst);
+        }
+      }
+      for (int k=d.i_fst[v]; k<d.i_fst[v+1]; k++) {
+        const MDD::Edge& e = d.edge[d.i_edge[k]];
+        if (s_alive.get(static_cast<unsigned int>(e.sup)) &&
+            n_alive.get(static_cast<unsigned int>(e.src))) {
+          if (--s_cnt[e.sup] == 0) {
+            p_fst = std::min(p_fst,l-1); p_lst = std::max(p_lst,l-1);
+          }
+          if (--o_deg[e.src] == 0)
+            ns.push(e.src);
+        }
+      }
+    }
+
+    // Prune values without edges
+    pruning = true;
+    for (int i=p_fst; i<=p_lst; i++)
+      for (int s=d.s_layer[i]; s<d.s_layer[i+1]; s++)
+        if (s_alive.get(static_cast<unsigned int>(s)) && (s_cnt[s] == 0)) {
+          s_alive.clear(static_cast<unsigned int>(s));
+          if (me_failed(x[i].nq(home,d.support[s].val))) {
+            pruning = false;
+            return ES_FAILED;
+          }
+        }
+    pruning = false;
+
+    return c.empty() ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+  template<class View>
+  forceinline size_t
+  DecisionDiagram<View>::dispose(Space& home) {
+    home.ignore(*this,AP_DISPOSE);
+    c.dispose(home);
+    mdd.~MDD();
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -68,6 +68,10 @@ namespace Gecode {
     HashEntry* table;
     /// Size of table (as binary logarithm)
     int n_log;
+    /// Read-only file image holding the transitions (or nullptr)
+    void* image;
+    /// Size of the file image in bytes
+    std::size_t n_image;
     /// Fill hash table
     void fill(void);
     /// Initialize automaton implementation with \a nt transitions
@@ -80,11 +84,14 @@ namespace Gecode {
 
   forceinline
   DFA::DFAI::DFAI(int nt)
-    : trans(nt == 0 ? nullptr : heap.alloc<Transition>(nt)) {}
+    : trans(nt == 0 ? nullptr : heap.alloc<Transition>(nt)),
+      image(nullptr), n_image(0U) {}
 
   forceinline
   DFA::DFAI::~DFAI(void) {
-    if (n_trans > 0)
+    if (image != nullptr)
+      Int::Extensional::unmap(image,n_image);
+    else if (n_trans > 0)
       heap.rfree(trans);
     heap.rfree(table);
   }
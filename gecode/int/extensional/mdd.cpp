@@ -0,0 +1,631 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.dev
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/int.hh>
+
+namespace Gecode { namespace Int { namespace Extensional {
+
+  namespace {
+
+    /// %Edge of a layered graph during construction of an %MDD
+    class BuildEdge {
+    public:
+      int l;   ///< Layer
+      int src; ///< Source node (numbered within layer \a l)
+      int val; ///< Value
+      int dst; ///< Destination node (numbered within layer \a l + 1)
+    };
+
+    /// Order edges by layer, source, value, and destination
+    class BySource {
+    public:
+      bool operator ()(const BuildEdge& x, const BuildEdge& y) const {
+        if (x.l != y.l)   return x.l < y.l;
+        if (x.src != y.src) return x.src < y.src;
+        if (x.val != y.val) return x.val < y.val;
+        return x.dst < y.dst;
+      }
+    };
+
+    /// Order edges by value and source
+    class ByValue {
+    public:
+      bool operator ()(const BuildEdge& x, const BuildEdge& y) const {
+        if (x.val != y.val) return x.val < y.val;
+        return x.src < y.src;
+      }
+    };
+
+    /// Order edges by value and destination
+    class ByValueDst {
+    public:
+      bool operator ()(const BuildEdge& x, const BuildEdge& y) const {
+        if (x.val != y.val) return x.val < y.val;
+        return x.dst < y.dst;
+      }
+    };
+
+    /**
+     * \brief Layered graph from which a reduced %MDD is built
+     *
+     * Layer zero must have a single node (the root) and the last
+     * layer must have a single node (the terminal). All nodes must be
+     * reachable from the root.
+     */
+    class Builder {
+    public:
+      /// Arity
+      int n;
+      /// Number of nodes per layer
+      int* n_nodes;
+      /// Number of edges
+      int n_edges;
+      /// The edges
+      Support::DynamicArray<BuildEdge,Heap> edges;
+      /// Initialize for arity \a n0 (with only the root and terminal)
+      Builder(int n0);
+      /// Delete builder
+      ~Builder(void);
+      /// Add edge
+      void edge(int l, int src, int val, int dst);
+      /// Return reduced %MDD
+      MDD::MDDI* reduce(void);
+    };
+
+    forceinline
+    Builder::Builder(int n0)
+      : n(n0), n_nodes(heap.alloc<int>(n0+1)), n_edges(0), edges(heap) {
+      for (int i=0; i<=n; i++)
+        n_nodes[i] = 1;
+    }
+
+    forceinline
+    Builder::~Builder(void) {
+      heap.free<int>(n_nodes,n+1);
+    }
+
+    forceinline void
+    Builder::edge(int l, int src, int val, int dst) {
+      BuildEdge& e = edges[n_edges++];
+      e.l = l; e.src = src; e.val = val; e.dst = dst;
+    }
+
+    /// Hash table for hash-consing the nodes of a layer
+    class UniqueTable {
+    protected:
+      /// Signatures (outgoing edges) of all unique nodes
+      const BuildEdge* sig;
+      /// First edge of the signature of each unique node
+      const int* fst;
+      /// Table of node numbers (-1 for empty entries)
+      int* table;
+      /// Mask for table size
+      unsigned int mask;
+      /// Return hash key of signature \a e of \a n edges
+      static std::size_t key(const BuildEdge* e, int n);
+    public:
+      /// Initialize for at most \a n nodes
+      UniqueTable(Region& r, int n, const BuildEdge* sig, const int* fst);
+      /**
+       * \brief Find node with signature \a e of \a n edges
+       *
+       * If there is no such node, \a u is entered as node number
+       * and \a u is returned.
+       */
+      int find(const BuildEdge* e, int n, int u);
+    };
+
+    forceinline std::size_t
+    UniqueTable::key(const BuildEdge* e, int n) {
+      std::size_t k = static_cast<std::size_t>(n);
+      for (int i=0; i<n; i++) {
+        cmb_hash(k, e[i].val);
+        cmb_hash(k, e[i].dst);
+      }
+      return k;
+    }
+
+    forceinline
+    UniqueTable::UniqueTable(Region& r, int n,
+                             const BuildEdge* sig0, const int* fst0)
+      : sig(sig0), fst(fst0) {
+      unsigned int s = 4U;
+      while (s < 2U*static_cast<unsigned int>(n))
+        s <<= 1;
+      table = r.alloc<int>(s);
+      for (unsigned int i=0; i<s; i++)
+        table[i] = -1;
+      mask = s-1U;
+    }
+
+    forceinline int
+    UniqueTable::find(const BuildEdge* e, int n, int u) {
+      unsigned int p = static_cast<unsigned int>(key(e,n)) & mask;
+      while (table[p] >= 0) {
+        int v = table[p];
+        if (fst[v+1]-fst[v] == n) {
+          const BuildEdge* f = sig + fst[v];
+          int i = 0;
+          while ((i < n) && (f[i].val == e[i].val) && (f[i].dst == e[i].dst))
+            i++;
+          if (i == n)
+            return v;
+        }
+        p = (p+1U) & mask;
+      }
+      table[p] = u;
+      return u;
+    }
+
+    MDD::MDDI*
+    Builder::reduce(void) {
+      Region r;
+      BuildEdge* e = static_cast<BuildEdge*>(edges);
+      {
+        BySource by_source;
+        Support::quicksort<BuildEdge,BySource>(e,n_edges,by_source);
+      }
+      // First edge of each layer
+      int* l_fst = r.alloc<int>(n+1);
+      for (int i=0, j=0; i<=n; i++) {
+        while ((j < n_edges) && (e[j].l < i))
+          j++;
+        l_fst[i] = j;
+      }
+
+      /*
+       * Bottom-up pass: map each node to the unique node with the same
+       * outgoing edges (-1 if the node cannot reach the terminal)
+       */
+      int** id = r.alloc<int*>(n+1);
+      // Number of unique nodes per layer
+      int* m = r.alloc<int>(n+1);
+      // Outgoing edges of the unique nodes per layer
+      BuildEdge** sig = r.alloc<BuildEdge*>(n+1);
+      // Number of edges of unique nodes per layer
+      int* m_edges = r.alloc<int>(n+1);
+      id[n] = r.alloc<int>(1);
+      id[n][0] = 0; m[n] = 1;
+      for (int i=n; i--; ) {
+        int n_e = l_fst[i+1] - l_fst[i];
+        id[i] = r.alloc<int>(n_nodes[i]);
+        for (int j=0; j<n_nodes[i]; j++)
+          id[i][j] = -1;
+        sig[i] = r.alloc<BuildEdge>(std::max(n_e,1));
+        int* fst = r.alloc<int>(n_nodes[i]+1);
+        UniqueTable ut(r,n_nodes[i],sig[i],fst);
+        m[i] = 0; m_edges[i] = 0; fst[0] = 0;
+        for (int j=l_fst[i]; j<l_fst[i+1]; ) {
+          int src = e[j].src;
+          // Collect the edges to nodes that can reach the terminal
+          BuildEdge* f = sig[i] + m_edges[i];
+          int k = 0;
+          for (; (j<l_fst[i+1]) && (e[j].src == src); j++)
+            if (id[i+1][e[j].dst] >= 0) {
+              f[k] = e[j]; f[k].src = m[i];
+              f[k].dst = id[i+1][e[j].dst];
+              k++;
+            }
+          if (k == 0)
+            continue;
+          {
+            ByValueDst by_value_dst;
+            Support::quicksort<BuildEdge,ByValueDst>(f,k,by_value_dst);
+          }
+          // Remove duplicate edges
+          int d = 1;
+          for (int h=1; h<k; h++)
+            if ((f[h].val != f[d-1].val) || (f[h].dst != f[d-1].dst))
+              f[d++] = f[h];
+          fst[m[i]+1] = m_edges[i] + d;
+          int u = ut.find(f,d,m[i]);
+          id[i][src] = u;
+          if (u == m[i]) {
+            // New unique node
+            m[i]++; m_edges[i] += d;
+          }
+        }
+      }
+
+      if (id[0][0] < 0) {
+        // No tuple is accepted
+        MDD::MDDI* o = new MDD::MDDI(n,0,0,0);
+        for (int i=0; i<=n+1; i++)
+          o->layer[i] = 0;
+        for (int i=0; i<=n; i++)
+          o->s_layer[i] = 0;
+        o->o_fst[0] = o->i_fst[0] = 0;
+        return o;
+      }
+      assert(m[0] == 1);
+
+      // Count nodes, edges, and supports
+      int t_nodes = 0, t_edges = 0, t_supports = 0;
+      for (int i=0; i<=n; i++)
+        t_nodes += m[i];
+      for (int i=0; i<n; i++) {
+        t_edges += m_edges[i];
+        ByValue by_value;
+        Support::quicksort<BuildEdge,ByValue>(sig[i],m_edges[i],by_value);
+        for (int j=0; j<m_edges[i]; j++)
+          if ((j == 0) || (sig[i][j].val != sig[i][j-1].val))
+            t_supports++;
+      }
+
+      MDD::MDDI* o = new MDD::MDDI(n,t_nodes,t_edges,t_supports);
+      o->layer[0] = 0;
+      for (int i=0; i<=n; i++)
+        o->layer[i+1] = o->layer[i] + m[i];
+      for (int i=0, k=0, s=0; i<n; i++) {
+        o->s_layer[i] = s;
+        for (int j=0; j<m_edges[i]; j++, k++) {
+          if ((j == 0) || (sig[i][j].val != sig[i][j-1].val)) {
+            if (j > 0)
+              o->support[s-1].lst = k;
+            o->support[s].val = sig[i][j].val;
+            o->support[s].fst = k;
+            s++;
+          }
+          o->edge[k].src = o->layer[i]   + sig[i][j].src;
+          o->edge[k].dst = o->layer[i+1] + sig[i][j].dst;
+          o->edge[k].sup = s-1;
+        }
+        if (m_edges[i] > 0)
+          o->support[s-1].lst = k;
+        if (i+1 == n)
+          o->s_layer[n] = s;
+      }
+      if (n == 0)
+        o->s_layer[0] = 0;
+
+      // Index outgoing and incoming edges by node
+      for (int v=0; v<=t_nodes; v++)
+        o->o_fst[v] = o->i_fst[v] = 0;
+      for (int k=0; k<t_edges; k++) {
+        o->o_fst[o->edge[k].src+1]++;
+        o->i_fst[o->edge[k].dst+1]++;
+      }
+      for (int v=0; v<t_nodes; v++) {
+        o->o_fst[v+1] += o->o_fst[v];
+        o->i_fst[v+1] += o->i_fst[v];
+      }
+      {
+        int* o_nxt = r.alloc<int>(std::max(t_nodes,1));
+        int* i_nxt = r.alloc<int>(std::max(t_nodes,1));
+        for (int v=0; v<t_nodes; v++) {
+          o_nxt[v] = o->o_fst[v]; i_nxt[v] = o->i_fst[v];
+        }
+        for (int k=0; k<t_edges; k++) {
+          o->o_edge[o_nxt[o->edge[k].src]++] = k;
+          o->i_edge[i_nxt[o->edge[k].dst]++] = k;
+        }
+      }
+      return o;
+    }
+
+    /// Map from pairs of nodes to node numbers
+    class PairMap {
+    protected:
+      /// Entry of the hash table
+      class Entry {
+      public:
+        int a, b; ///< The pair (a is -1 for empty entries)
+        int v;    ///< The node number
+      };
+      /// The hash table
+      Entry* table;
+      /// Size of the table
+      unsigned int size;
+      /// Number of entries
+      unsigned int n;
+      /// Return position for pair \a a and \a b
+      unsigned int pos(int a, int b) const;
+    public:
+      /// Initialize as empty
+      PairMap(void);
+      /// Delete map
+      ~PairMap(void);
+      /// Remove all entries
+      void clear(void);
+      /// Return number of pair \a a and \a b, enter new number if needed
+      int find(int a, int b);
+      /// Return number of entries
+      int entries(void) const;
+    };
+
+    forceinline
+    PairMap::PairMap(void)
+      : table(heap.alloc<Entry>(64U)), size(64U), n(0U) {
+      clear();
+    }
+    forceinline
+    PairMap::~PairMap(void) {
+      heap.free<Entry>(table,size);
+    }
+    forceinline void
+    PairMap::clear(void) {
+      for (unsigned int i=0; i<size; i++)
+        table[i].a = -1;
+      n = 0U;
+    }
+    forceinline unsigned int
+    PairMap::pos(int a, int b) const {
+      std::size_t k = static_cast<std::size_t>(a);
+      cmb_hash(k, b);
+      unsigned int p = static_cast<unsigned int>(k) & (size-1U);
+      while ((table[p].a >= 0) && ((table[p].a != a) || (table[p].b != b)))
+        p = (p+1U) & (size-1U);
+      return p;
+    }
+    forceinline int
+    PairMap::find(int a, int b) {
+      unsigned int p = pos(a,b);
+      if (table[p].a >= 0)
+        return table[p].v;
+      if (2U*(n+1U) > size) {
+        // Grow table
+        Entry* t = table; unsigned int s = size;
+        size *= 2U;
+        table = heap.alloc<Entry>(size);
+        for (unsigned int i=0; i<size; i++)
+          table[i].a = -1;
+        for (unsigned int i=0; i<s; i++)
+          if (t[i].a >= 0)
+            table[pos(t[i].a,t[i].b)] = t[i];
+        heap.free<Entry>(t,s);
+        p = pos(a,b);
+      }
+      table[p].a = a; table[p].b = b; table[p].v = static_cast<int>(n++);
+      return table[p].v;
+    }
+    forceinline int
+    PairMap::entries(void) const {
+      return static_cast<int>(n);
+    }
+
+    /// Return %MDD of arity zero accepting the empty tuple if \a a is true
+    MDD::MDDI*
+    nullary(bool a) {
+      MDD::MDDI* o = new MDD::MDDI(0,a ? 1 : 0,0,0);
+      o->layer[0] = 0; o->layer[1] = a ? 1 : 0;
+      o->s_layer[0] = 0;
+      o->o_fst[0] = o->i_fst[0] = 0;
+      if (a)
+        o->o_fst[1] = o->i_fst[1] = 0;
+      return o;
+    }
+
+  }
+
+}}}
+
+namespace Gecode {
+
+  MDD::MDDI::MDDI(int n0, int nn, int ne, int ns)
+    : n(n0), n_nodes(nn), n_edges(ne), n_supports(ns),
+      layer(heap.alloc<int>(n0+2)), s_layer(heap.alloc<int>(n0+1)),
+      support(ns == 0 ? nullptr : heap.alloc<Support>(ns)),
+      edge(ne == 0 ? nullptr : heap.alloc<Edge>(ne)),
+      o_fst(heap.alloc<int>(nn+1)),
+      o_edge(ne == 0 ? nullptr : heap.alloc<int>(ne)),
+      i_fst(heap.alloc<int>(nn+1)),
+      i_edge(ne == 0 ? nullptr : heap.alloc<int>(ne)) {}
+
+  MDD::MDDI::~MDDI(void) {
+    heap.rfree(layer); heap.rfree(s_layer);
+    if (n_supports > 0)
+      heap.rfree(support);
+    if (n_edges > 0) {
+      heap.rfree(edge); heap.rfree(o_edge); heap.rfree(i_edge);
+    }
+    heap.rfree(o_fst); heap.rfree(i_fst);
+  }
+
+  MDD::MDD(int n, const DFA& d) {
+    using namespace Int::Extensional;
+    if (n < 0)
+      throw Int::OutOfLimits("MDD::MDD");
+    if (n == 0) {
+      object(nullary((d.final_fst() <= 0) && (d.final_lst() >= 0)));
+      return;
+    }
+    Builder b(n);
+    Region r;
+    // Node number of each state in the current and the next layer
+    int* cur = r.alloc<int>(d.n_states());
+    int* nxt = r.alloc<int>(d.n_states());
+    for (int s=0; s<d.n_states(); s++)
+      cur[s] = nxt[s] = -1;
+    cur[0] = 0;
+    for (int i=0; i<n; i++) {
+      int n_nxt = 0;
+      for (DFA::Transitions t(d); t(); ++t)
+        if (cur[t.i_state()] >= 0) {
+          if (i+1 < n) {
+            if (nxt[t.o_state()] < 0)
+              nxt[t.o_state()] = n_nxt++;
+            b.edge(i,cur[t.i_state()],t.symbol(),nxt[t.o_state()]);
+          } else if ((t.o_state() >= d.final_fst()) &&
+                     (t.o_state() < d.final_lst())) {
+            b.edge(i,cur[t.i_state()],t.symbol(),0);
+          }
+        }
+      if (i+1 < n) {
+        if (n_nxt == 0) {
+          // No word of length n is accepted
+          b.n_nodes[i+1] = 1;
+          break;
+        }
+        b.n_nodes[i+1] = n_nxt;
+        std::swap(cur,nxt);
+        for (int s=0; s<d.n_states(); s++)
+          nxt[s] = -1;
+      }
+    }
+    object(b.reduce());
+  }
+
+  namespace {
+
+    /// Order tuples lexicographically
+    class TupleLess {
+    public:
+      /// Arity
+      int a;
+      /// Initialize for arity \a a0
+      TupleLess(int a0) : a(a0) {}
+      bool operator ()(const int* x, const int* y) const {
+        for (int i=0; i<a; i++)
+          if (x[i] != y[i])
+            return x[i] < y[i];
+        return false;
+      }
+    };
+
+  }
+
+  MDD::MDD(const TupleSet& t) {
+    using namespace Int::Extensional;
+    if (!t.finalized())
+      throw Int::NotYetFinalized("MDD::MDD");
+    int a = t.arity();
+    if (a == 0) {
+      object(nullary(t.tuples() > 0));
+      return;
+    }
+    Builder b(a);
+    Region r;
+    int n_t = t.tuples();
+    int** ts = r.alloc<int*>(std::max(n_t,1));
+    for (int k=0; k<n_t; k++)
+      ts[k] = t[k];
+    {
+      TupleLess tl(a);
+      Gecode::Support::quicksort<int*,TupleLess>(ts,n_t,tl);
+    }
+    // Node number of the current prefix of each length
+    int* cur = r.alloc<int>(a+1);
+    for (int i=0; i<=a; i++)
+      cur[i] = 0;
+    for (int k=0; k<n_t; k++) {
+      // First position where tuple differs from the previous one
+      int d = 0;
+      if (k > 0)
+        while ((d < a) && (ts[k][d] == ts[k-1][d]))
+          d++;
+      for (int i=d; i<a; i++) {
+        if ((k > 0) && (i+1 < a))
+          cur[i+1] = b.n_nodes[i+1]++;
+        b.edge(i,cur[i],ts[k][i],(i+1 < a) ? cur[i+1] : 0);
+      }
+    }
+    object(b.reduce());
+  }
+
+  MDD&
+  MDD::operator &=(const MDD& m) {
+    using namespace Int::Extensional;
+    if (arity() != m.arity())
+      throw Int::ArgumentSizeMismatch("MDD::operator &=");
+    const MDDI* x = mddi();
+    const MDDI* y = m.mddi();
+    if ((x == y) || (y == nullptr))
+      return *this;
+    if (x == nullptr) {
+      *this = m;
+      return *this;
+    }
+    int n = x->n;
+    if (n == 0) {
+      object(nullary((x->n_nodes > 0) && (y->n_nodes > 0)));
+      return *this;
+    }
+    if ((x->n_nodes == 0) || (y->n_nodes == 0)) {
+      object(x->n_nodes == 0 ? const_cast<MDDI*>(x) : const_cast<MDDI*>(y));
+      return *this;
+    }
+    Builder b(n);
+    // Map pairs of nodes of the next layer to node numbers
+    PairMap pm;
+    // Pairs of nodes for the current and the next layer
+    Gecode::Support::DynamicArray<int,Heap> ca(heap), cb(heap), na(heap), nb(heap);
+    ca[0] = 0; cb[0] = 0;
+    int n_cur = 1;
+    for (int i=0; i<n; i++) {
+      pm.clear();
+      for (int j=0; j<n_cur; j++) {
+        int u = ca[j], v = cb[j];
+        int p = x->o_fst[u], pe = x->o_fst[u+1];
+        int q = y->o_fst[v], qe = y->o_fst[v+1];
+        // Join the outgoing edges (ordered by value) by value
+        while ((p < pe) && (q < qe)) {
+          const Edge& ep = x->edge[x->o_edge[p]];
+          const Edge& eq = y->edge[y->o_edge[q]];
+          int vp = x->support[ep.sup].val;
+          int vq = y->support[eq.sup].val;
+          if (vp < vq) {
+            p++;
+          } else if (vq < vp) {
+            q++;
+          } else {
+            if (i+1 < n) {
+              int k = pm.entries();
+              int w = pm.find(ep.dst,eq.dst);
+              if (w == k) {
+                na[w] = ep.dst; nb[w] = eq.dst;
+              }
+              b.edge(i,j,vp,w);
+            } else {
+              b.edge(i,j,vp,0);
+            }
+            p++; q++;
+          }
+        }
+      }
+      if (i+1 < n) {
+        n_cur = pm.entries();
+        if (n_cur == 0)
+          break;
+        b.n_nodes[i+1] = n_cur;
+        for (int j=0; j<n_cur; j++) {
+          ca[j] = na[j]; cb[j] = nb[j];
+        }
+      }
+    }
+    object(b.reduce());
+    return *this;
+  }
+
+}
+
+// STATISTICS: int-prop
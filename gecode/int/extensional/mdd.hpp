@@ -0,0 +1,128 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.dev
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode {
+
+  /**
+   * \brief Data stored for an %MDD
+   *
+   * Nodes are numbered layer by layer: the root is node zero and the
+   * terminal is the last node. The edges of a layer are grouped by
+   * their value, each group is described by a support.
+   */
+  class MDD::MDDI : public SharedHandle::Object {
+  public:
+    /// Arity (number of layers minus one)
+    int n;
+    /// Number of nodes
+    int n_nodes;
+    /// Number of edges
+    int n_edges;
+    /// Number of supports
+    int n_supports;
+    /// First node of each layer (\a n + 2 elements)
+    int* layer;
+    /// First support of each layer (\a n + 1 elements)
+    int* s_layer;
+    /// Supports ordered by layer and value
+    Support* support;
+    /// Edges ordered by support
+    Edge* edge;
+    /// First outgoing edge of each node (\a n_nodes + 1 elements)
+    int* o_fst;
+    /// Outgoing edges of all nodes
+    int* o_edge;
+    /// First incoming edge of each node (\a n_nodes + 1 elements)
+    int* i_fst;
+    /// Incoming edges of all nodes
+    int* i_edge;
+    /// Allocate memory for the given numbers of nodes, edges, and supports
+    GECODE_INT_EXPORT
+    MDDI(int n, int n_nodes, int n_edges, int n_supports);
+    /// Delete implementation
+    GECODE_INT_EXPORT
+    virtual ~MDDI(void);
+  };
+
+  forceinline
+  MDD::MDD(void) {}
+
+  forceinline
+  MDD::MDD(MDDI* m)
+    : SharedHandle(m) {}
+
+  forceinline
+  MDD::MDD(const MDD& m)
+    : SharedHandle(m) {}
+
+  forceinline MDD&
+  MDD::operator =(const MDD& m) {
+    (void) SharedHandle::operator =(m);
+    return *this;
+  }
+
+  forceinline const MDD::MDDI*
+  MDD::mddi(void) const {
+    return static_cast<const MDDI*>(object());
+  }
+
+  forceinline int
+  MDD::arity(void) const {
+    return (mddi() == nullptr) ? 0 : mddi()->n;
+  }
+
+  forceinline int
+  MDD::nodes(void) const {
+    return (mddi() == nullptr) ? 1 : mddi()->n_nodes;
+  }
+
+  forceinline int
+  MDD::edges(void) const {
+    return (mddi() == nullptr) ? 0 : mddi()->n_edges;
+  }
+
+  forceinline bool
+  MDD::empty(void) const {
+    return nodes() == 0;
+  }
+
+  forceinline MDD
+  operator &(const MDD& m, const MDD& n) {
+    MDD r(m);
+    r &= n;
+    return r;
+  }
+
+}
+
+// STATISTICS: int-prop
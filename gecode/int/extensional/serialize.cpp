@@ -0,0 +1,727 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.dev
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/int.hh>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#ifdef HAVE_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/*
+ * Binary file format for finalized tuple sets and DFAs
+ *
+ * A file starts with a FileHeader followed by sections. Each section
+ * is a plain array of the in-memory representation and starts at an
+ * offset aligned to file_align. As the arrays are used in place after
+ * mapping the file, the header records byte order and the sizes of all
+ * stored types: files are only portable between compatible platforms.
+ *
+ * Sections of a tuple set (in order, empty sections take no space):
+ *  - number of ranges per position (arity unsigned ints)
+ *  - ranges as pairs of minimum and maximum (2*n_ranges ints)
+ *  - range base support ids (n_ranges unsigned ints, sparse and
+ *    compressed only)
+ *  - tuple data (arity*n_tuples ints)
+ *  - dense supports (n_words*n_vals words, dense only)
+ *  - sparse offsets, tuple ids, and tuple cell ids (sparse only)
+ *  - compressed offsets and words (compressed only)
+ *
+ * Sections of a DFA: the transitions (n_trans transitions).
+ *
+ */
+
+namespace Gecode { namespace Int { namespace Extensional {
+
+  /// Version of the binary file format
+  const std::uint64_t file_version = 1U;
+  /// Byte order tag of the binary file format
+  const std::uint64_t file_order = 0x0102030405060708ULL;
+  /// Alignment of sections in binary files
+  const std::uint64_t file_align = 64U;
+
+  /// Header of binary files (all members are 64 bit to avoid padding)
+  class FileHeader {
+  public:
+    /// Magic identifying the kind of object
+    char magic[8];
+    /// Format version
+    std::uint64_t version;
+    /// Byte order tag
+    std::uint64_t order;
+    /// Sizes of stored types
+    std::uint64_t layout;
+    /// Object specific fields
+    std::uint64_t field[12];
+  };
+
+  /// Magic for tuple sets
+  const char ts_magic[8] = {'G','E','C','O','D','E','T','S'};
+  /// Magic for DFAs
+  const char dfa_magic[8] = {'G','E','C','O','D','E','F','A'};
+
+  /// Return sizes of the types stored in files on this platform
+  forceinline std::uint64_t
+  file_layout(void) {
+    return static_cast<std::uint64_t>(sizeof(int)) |
+      (static_cast<std::uint64_t>(sizeof(TupleSet::BitSetData)) << 8) |
+      (static_cast<std::uint64_t>(sizeof(TupleSet::CSupportWord)) << 16) |
+      (static_cast<std::uint64_t>(sizeof(DFA::Transition)) << 24) |
+      (static_cast<std::uint64_t>(sizeof(std::size_t)) << 32);
+  }
+
+  /// Initialize header \a h with magic \a m
+  forceinline void
+  file_header(FileHeader& h, const char m[8]) {
+    std::memset(&h, 0, sizeof(FileHeader));
+    std::memcpy(h.magic, m, 8);
+    h.version = file_version;
+    h.order = file_order;
+    h.layout = file_layout();
+  }
+
+  /// Sequential writer for binary files
+  class FileWriter {
+  protected:
+    /// The output stream
+    std::ofstream os;
+    /// Current position
+    std::uint64_t pos;
+    /// Location for exceptions
+    const char* l;
+  public:
+    /// Open file \a fn for writing, use \a l in exceptions
+    FileWriter(const std::string& fn, const char* l);
+    /// Write \a n bytes from \a p
+    void bytes(const void* p, std::size_t n);
+    /// Write section of \a n elements from \a p
+    template<class T>
+    void section(const T* p, std::size_t n);
+    /// Flush and close the file
+    void close(void);
+  };
+
+  FileWriter::FileWriter(const std::string& fn, const char* l0)
+    : os(fn.c_str(), std::ios::out | std::ios::binary | std::ios::trunc),
+      pos(0U), l(l0) {
+    if (!os)
+      throw InvalidFile(l);
+  }
+
+  void
+  FileWriter::bytes(const void* p, std::size_t n) {
+    os.write(static_cast<const char*>(p),
+             static_cast<std::streamsize>(n));
+    if (!os)
+      throw InvalidFile(l);
+    pos += n;
+  }
+
+  template<class T>
+  void
+  FileWriter::section(const T* p, std::size_t n) {
+    if (n == 0U)
+      return;
+    static const char zero[file_align] = {};
+    std::size_t pad = static_cast<std::size_t>
+      ((file_align - (pos % file_align)) % file_align);
+    bytes(zero, pad);
+    bytes(p, n*sizeof(T));
+  }
+
+  void
+  FileWriter::close(void) {
+    os.close();
+    if (!os)
+      throw InvalidFile(l);
+  }
+
+
+  /// Read-only image of a binary file
+  class FileImage {
+  public:
+    /// Start of the image
+    char* p;
+    /// Size of the image in bytes
+    std::size_t n;
+    /// Current read position
+    std::uint64_t pos;
+    /// Location for exceptions
+    const char* l;
+    /// Map file \a fn, use \a l in exceptions
+    FileImage(const std::string& fn, const char* l);
+    /// Return header, check magic \a m
+    const FileHeader& header(const char m[8]);
+    /// Return section of \a n elements
+    template<class T>
+    T* section(std::uint64_t n);
+    /// Hand the image over to its owner
+    void* release(void);
+    /// Unmap the image unless released
+    ~FileImage(void);
+  };
+
+  FileImage::FileImage(const std::string& fn, const char* l0)
+    : p(nullptr), n(0U), pos(0U), l(l0) {
+#ifdef HAVE_MMAP
+    int fd = ::open(fn.c_str(), O_RDONLY);
+    if (fd == -1)
+      throw InvalidFile(l);
+    struct stat sb;
+    if ((::fstat(fd, &sb) == -1) || (sb.st_size <= 0)) {
+      (void) ::close(fd);
+      throw InvalidFile(l);
+    }
+    n = static_cast<std::size_t>(sb.st_size);
+    void* m = ::mmap(nullptr, n, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping stays valid after the descriptor has been closed
+    (void) ::close(fd);
+    if (m == MAP_FAILED)
+      throw InvalidFile(l);
+    p = static_cast<char*>(m);
+#else
+    std::ifstream is(fn.c_str(), std::ios::in | std::ios::binary);
+    if (!is)
+      throw InvalidFile(l);
+    is.seekg(0, std::ios::end);
+    std::streamoff s = is.tellg();
+    if (s <= 0)
+      throw InvalidFile(l);
+    is.seekg(0, std::ios::beg);
+    n = static_cast<std::size_t>(s);
+    p = static_cast<char*>(heap.ralloc(n));
+    if (!is.read(p, static_cast<std::streamsize>(n))) {
+      heap.rfree(p);
+      throw InvalidFile(l);
+    }
+#endif
+  }
+
+  const FileHeader&
+  FileImage::header(const char m[8]) {
+    if (n < sizeof(FileHeader))
+      throw InvalidFile(l);
+    const FileHeader& h = *reinterpret_cast<const FileHeader*>(p);
+    if ((std::memcmp(h.magic, m, 8) != 0) ||
+        (h.version != file_version) || (h.order != file_order) ||
+        (h.layout != file_layout()))
+      throw InvalidFile(l);
+    pos = sizeof(FileHeader);
+    return h;
+  }
+
+  template<class T>
+  T*
+  FileImage::section(std::uint64_t m) {
+    if (m == 0U)
+      return nullptr;
+    pos += (file_align - (pos % file_align)) % file_align;
+    if ((pos > n) || (m > (n - pos) / sizeof(T)))
+      throw InvalidFile(l);
+    T* s = reinterpret_cast<T*>(p + pos);
+    pos += m * sizeof(T);
+    return s;
+  }
+
+  void*
+  FileImage::release(void) {
+    void* r = p;
+    p = nullptr;
+    return r;
+  }
+
+  FileImage::~FileImage(void) {
+    if (p != nullptr)
+      unmap(p, n);
+  }
+
+  void
+  unmap(void* p, std::size_t n) {
+#ifdef HAVE_MMAP
+    (void) ::munmap(p, n);
+#else
+    (void) n;
+    heap.rfree(p);
+#endif
+  }
+
+  /// Sizes of the sections of a tuple set
+  class TupleSetSections {
+  public:
+    /// Number of tuple cells
+    std::uint64_t n_tcells;
+    /// Number of range base ids
+    std::uint64_t n_base;
+    /// Number of dense support words
+    std::uint64_t n_dense;
+    /// Number of sparse offsets
+    std::uint64_t n_sparse_offsets;
+    /// Number of sparse tuple ids (and tuple cell ids)
+    std::uint64_t n_sparse;
+    /// Number of compressed offsets
+    std::uint64_t n_compressed_offsets;
+    /// Initialize from the header information
+    TupleSetSections(ExtensionalPropKind epk, std::uint64_t arity,
+                     std::uint64_t n_tuples, std::uint64_t n_words,
+                     std::uint64_t n_ranges, std::uint64_t n_vals);
+  };
+
+  TupleSetSections::TupleSetSections(ExtensionalPropKind epk,
+                                     std::uint64_t arity,
+                                     std::uint64_t n_tuples,
+                                     std::uint64_t n_words,
+                                     std::uint64_t n_ranges,
+                                     std::uint64_t n_vals)
+    : n_tcells(arity * n_tuples), n_base(0U), n_dense(0U),
+      n_sparse_offsets(0U), n_sparse(0U), n_compressed_offsets(0U) {
+    if (n_tuples == 0U)
+      return;
+    switch (epk) {
+    case EPK_DENSE:
+      n_dense = n_words * n_vals;
+      break;
+    case EPK_SPARSE:
+      n_base = n_ranges;
+      n_sparse_offsets = n_vals + 1U;
+      n_sparse = n_tcells;
+      break;
+    case EPK_DENSE_COMPRESSED:
+      n_base = n_ranges;
+      n_compressed_offsets = n_vals + 1U;
+      break;
+    default:
+      GECODE_NEVER;
+    }
+  }
+
+}}}
+
+namespace Gecode {
+
+  /*
+   * Tuple sets
+   *
+   */
+
+  void
+  TupleSet::save(const std::string& fn) const {
+    using namespace Int::Extensional;
+    const Data& d = data();
+    std::uint64_t n_ranges = 0U, n_vals = 0U;
+    if (d.n_tuples > 0)
+      for (int a=0; a<d.arity; a++) {
+        n_ranges += d.vd[a].n;
+        for (unsigned int i=0U; i<d.vd[a].n; i++)
+          n_vals += d.vd[a].r[i].width();
+      }
+    TupleSetSections ss(representation(), static_cast<std::uint64_t>(d.arity),
+                        static_cast<std::uint64_t>(d.n_tuples),
+                        d.n_words, n_ranges, n_vals);
+    FileHeader h;
+    file_header(h, ts_magic);
+    h.field[0] = static_cast<std::uint64_t>(d.arity);
+    h.field[1] = static_cast<std::uint64_t>(d.n_tuples);
+    h.field[2] = d.n_words;
+    h.field[3] = static_cast<std::uint64_t>(static_cast<std::int64_t>(d.min));
+    h.field[4] = static_cast<std::uint64_t>(static_cast<std::int64_t>(d.max));
+    h.field[5] = static_cast<std::uint64_t>(d.key);
+    h.field[6] = static_cast<std::uint64_t>(d.state);
+    h.field[7] = n_ranges;
+    h.field[8] = n_vals;
+    h.field[9] = d.compressed_n_entries;
+
+    FileWriter fw(fn, "TupleSet::save()");
+    fw.bytes(&h, sizeof(FileHeader));
+    if (d.n_tuples > 0) {
+      Region r;
+      unsigned int* rn = r.alloc<unsigned int>(d.arity);
+      int* rb = r.alloc<int>(2U*n_ranges);
+      unsigned int k = 0U;
+      for (int a=0; a<d.arity; a++) {
+        rn[a] = d.vd[a].n;
+        for (unsigned int i=0U; i<d.vd[a].n; i++) {
+          rb[k++] = d.vd[a].r[i].min; rb[k++] = d.vd[a].r[i].max;
+        }
+      }
+      fw.section(rn, static_cast<std::size_t>(d.arity));
+      fw.section(rb, static_cast<std::size_t>(2U*n_ranges));
+    }
+    fw.section(d.range_base, static_cast<std::size_t>(ss.n_base));
+    fw.section(d.td, static_cast<std::size_t>(ss.n_tcells));
+    fw.section(d.support, static_cast<std::size_t>(ss.n_dense));
+    fw.section(d.sparse_offsets,
+               static_cast<std::size_t>(ss.n_sparse_offsets));
+    fw.section(d.sparse_tuples, static_cast<std::size_t>(ss.n_sparse));
+    fw.section(d.sparse_tv, static_cast<std::size_t>(ss.n_sparse));
+    fw.section(d.compressed_offsets,
+               static_cast<std::size_t>(ss.n_compressed_offsets));
+    fw.section(d.compressed_words,
+               static_cast<std::size_t>(d.compressed_n_entries));
+    fw.close();
+  }
+
+  TupleSet
+  TupleSet::load(const std::string& fn) {
+    using namespace Int::Extensional;
+    const char* l = "TupleSet::load()";
+    FileImage fi(fn, l);
+    const FileHeader& h = fi.header(ts_magic);
+    const std::uint64_t arity = h.field[0];
+    const std::uint64_t n_tuples = h.field[1];
+    const std::uint64_t n_words = h.field[2];
+    const std::int64_t min = static_cast<std::int64_t>(h.field[3]);
+    const std::int64_t max = static_cast<std::int64_t>(h.field[4]);
+    const std::uint64_t n_ranges = h.field[7];
+    const std::uint64_t n_vals = h.field[8];
+    const std::uint64_t n_entries = h.field[9];
+    const std::uint64_t u_max = std::numeric_limits<unsigned int>::max();
+    const std::uint64_t i_max = std::numeric_limits<int>::max();
+    if ((h.field[6] != Data::TS_DENSE) && (h.field[6] != Data::TS_SPARSE) &&
+        (h.field[6] != Data::TS_DENSE_COMPRESSED))
+      throw Int::InvalidFile(l);
+    const Data::State state = static_cast<Data::State>(h.field[6]);
+    // Bound all counts such that no size computation can overflow
+    if ((arity > i_max) ||
+        (n_tuples > i_max) ||
+        (n_words != Support::BitSetData::data
+         (static_cast<unsigned int>(n_tuples))) ||
+        (n_ranges > u_max) || (n_vals > u_max) || (n_entries > u_max) ||
+        (n_words * n_vals > u_max) || (arity * n_tuples > u_max) ||
+        ((n_tuples > 0U) &&
+         ((min < Int::Limits::min) || (max > Int::Limits::max) ||
+          (min > max) || (n_ranges < arity))))
+      throw Int::InvalidFile(l);
+    TupleSetSections ss((state == Data::TS_DENSE) ? EPK_DENSE :
+                        ((state == Data::TS_SPARSE) ? EPK_SPARSE :
+                         EPK_DENSE_COMPRESSED),
+                        arity, n_tuples, n_words, n_ranges, n_vals);
+
+    unsigned int* rn = fi.section<unsigned int>
+      ((n_tuples > 0U) ? arity : 0U);
+    int* rb = fi.section<int>((n_tuples > 0U) ? 2U*n_ranges : 0U);
+
+    TupleSet ts(static_cast<int>(arity));
+    Data& d = ts.raw();
+    heap.rfree(d.td);
+    d.td = nullptr;
+    d.n_free = 0;
+    d.n_tuples = static_cast<int>(n_tuples);
+    d.n_words = static_cast<unsigned int>(n_words);
+    d.key = static_cast<std::size_t>(h.field[5]);
+    if (n_tuples > 0U) {
+      d.min = static_cast<int>(min);
+      d.max = static_cast<int>(max);
+    }
+    for (int a=0; a<d.arity; a++) {
+      d.vd[a].n = 0U; d.vd[a].r = nullptr; d.vd[a].base = nullptr;
+    }
+    // Reconstruct ranges with their support pointers
+    if (n_tuples > 0U) {
+      Range* rc = d.range = heap.alloc<Range>(n_ranges);
+      std::uint64_t k = 0U, v = 0U;
+      for (int a=0; a<d.arity; a++) {
+        if ((rn[a] == 0U) || (rn[a] > n_ranges - k))
+          throw Int::InvalidFile(l);
+        d.vd[a].n = rn[a];
+        d.vd[a].r = rc;
+        for (unsigned int i=0U; i<rn[a]; i++) {
+          rc[i].min = rb[2U*k]; rc[i].max = rb[2U*k+1U];
+          if ((rc[i].min > rc[i].max) || (rc[i].min < d.min) ||
+              (rc[i].max > d.max) ||
+              ((i > 0U) && (rc[i-1U].max+1 >= rc[i].min)))
+            throw Int::InvalidFile(l);
+          v += rc[i].width();
+          k++;
+        }
+        rc += rn[a];
+      }
+      if ((k != n_ranges) || (v != n_vals))
+        throw Int::InvalidFile(l);
+    }
+    // Map the remaining sections, they are only owned by the data
+    // once the image has been handed over
+    unsigned int* range_base = fi.section<unsigned int>(ss.n_base);
+    int* td = fi.section<int>(ss.n_tcells);
+    BitSetData* support = fi.section<BitSetData>(ss.n_dense);
+    unsigned int* sparse_offsets =
+      fi.section<unsigned int>(ss.n_sparse_offsets);
+    unsigned int* sparse_tuples = fi.section<unsigned int>(ss.n_sparse);
+    unsigned int* sparse_tv = fi.section<unsigned int>(ss.n_sparse);
+    unsigned int* compressed_offsets =
+      fi.section<unsigned int>(ss.n_compressed_offsets);
+    CSupportWord* compressed_words = fi.section<CSupportWord>
+      ((state == Data::TS_DENSE_COMPRESSED) ? n_entries : 0U);
+    if (((sparse_offsets != nullptr) &&
+         (sparse_offsets[n_vals] != ss.n_sparse)) ||
+        ((compressed_offsets != nullptr) &&
+         (compressed_offsets[n_vals] != n_entries)))
+      throw Int::InvalidFile(l);
+    BitSetData* s = support;
+    unsigned int* b = range_base;
+    for (int a=0; a<d.arity; a++) {
+      if (b != nullptr) {
+        d.vd[a].base = b; b += d.vd[a].n;
+      }
+      for (unsigned int i=0U; i<d.vd[a].n; i++) {
+        d.vd[a].r[i].s = s;
+        if (s != nullptr)
+          s += n_words * d.vd[a].r[i].width();
+      }
+    }
+    if (n_tuples > 0U) {
+      // Check that every tuple cell lies in a range of its position and
+      // that all supports agree with the tuples. Support ids are numbered
+      // consecutively along the ranges of all positions.
+      Region r;
+      const unsigned int n_cells = static_cast<unsigned int>(ss.n_tcells);
+      unsigned int* sid = r.alloc<unsigned int>(n_cells);
+      unsigned int* n_sup = r.alloc<unsigned int>(n_vals);
+      unsigned int* fst = r.alloc<unsigned int>(d.arity+1);
+      unsigned int* base = r.alloc<unsigned int>(n_ranges);
+      for (unsigned int i=0U; i<n_vals; i++)
+        n_sup[i] = 0U;
+      unsigned int k = 0U, id = 0U;
+      for (int a=0; a<d.arity; a++) {
+        fst[a] = id;
+        for (unsigned int i=0U; i<d.vd[a].n; i++) {
+          if ((range_base != nullptr) && (range_base[k] != id))
+            throw Int::InvalidFile(l);
+          base[k++] = id;
+          id += d.vd[a].r[i].width();
+        }
+      }
+      fst[d.arity] = id;
+      for (unsigned int t=0U; t<static_cast<unsigned int>(n_tuples); t++)
+        for (int a=0; a<d.arity; a++) {
+          const unsigned int c = t*static_cast<unsigned int>(d.arity)+a;
+          const int v = td[c];
+          const Range* rf = d.vd[a].r;
+          const Range* rl = rf + d.vd[a].n;
+          const Range* ri = std::lower_bound
+            (rf, rl, v, [](const Range& x, int y) { return x.max < y; });
+          if ((ri == rl) || (v < ri->min))
+            throw Int::InvalidFile(l);
+          sid[c] = base[ri - d.range] + static_cast<unsigned int>(v - ri->min);
+          n_sup[sid[c]]++;
+          if (support != nullptr) {
+            const BitSetData* b = ri->supports(d.n_words, v);
+            if (!b[t / BitSetData::bpb].get(t % BitSetData::bpb))
+              throw Int::InvalidFile(l);
+          }
+          if ((sparse_tv != nullptr) && (sparse_tv[c] != sid[c]))
+            throw Int::InvalidFile(l);
+        }
+      if (support != nullptr) {
+        // No support bits beyond the tuples of a value
+        const BitSetData* b = support;
+        for (unsigned int i=0U; i<n_vals; i++) {
+          unsigned int o = 0U;
+          for (unsigned int j=0U; j<d.n_words; j++)
+            o += b[j].ones();
+          if (o != n_sup[i])
+            throw Int::InvalidFile(l);
+          b += d.n_words;
+        }
+      }
+      if (sparse_offsets != nullptr) {
+        // Each support list holds exactly the increasing tuple ids
+        if (sparse_offsets[0] != 0U)
+          throw Int::InvalidFile(l);
+        for (int a=0; a<d.arity; a++)
+          for (unsigned int i=fst[a]; i<fst[a+1]; i++) {
+            if (sparse_offsets[i+1U] - sparse_offsets[i] != n_sup[i])
+              throw Int::InvalidFile(l);
+            for (unsigned int p=sparse_offsets[i];
+                 p<sparse_offsets[i+1U]; p++) {
+              const unsigned int t = sparse_tuples[p];
+              if ((t >= static_cast<unsigned int>(n_tuples)) ||
+                  ((p > sparse_offsets[i]) && (sparse_tuples[p-1U] >= t)) ||
+                  (sid[t*static_cast<unsigned int>(d.arity)+a] != i))
+                throw Int::InvalidFile(l);
+            }
+          }
+      }
+      if (compressed_offsets != nullptr) {
+        // Each support list holds increasing words that cover exactly
+        // the tuples of the value
+        if (compressed_offsets[0] != 0U)
+          throw Int::InvalidFile(l);
+        for (unsigned int i=0U; i<n_vals; i++) {
+          if (compressed_offsets[i] > compressed_offsets[i+1U])
+            throw Int::InvalidFile(l);
+          unsigned int o = 0U;
+          for (unsigned int p=compressed_offsets[i];
+               p<compressed_offsets[i+1U]; p++) {
+            const CSupportWord& cw = compressed_words[p];
+            if ((cw.widx >= d.n_words) ||
+                ((p > compressed_offsets[i]) &&
+                 (compressed_words[p-1U].widx >= cw.widx)))
+              throw Int::InvalidFile(l);
+            o += cw.bits.ones();
+          }
+          if (o != n_sup[i])
+            throw Int::InvalidFile(l);
+        }
+        for (unsigned int c=0U; c<n_cells; c++) {
+          const unsigned int t = c / static_cast<unsigned int>(d.arity);
+          const CSupportWord* f = compressed_words + compressed_offsets[sid[c]];
+          const CSupportWord* e = compressed_words + compressed_offsets[sid[c]+1U];
+          const CSupportWord* w = std::lower_bound
+            (f, e, t / BitSetData::bpb,
+             [](const CSupportWord& x, unsigned int y) { return x.widx < y; });
+          if ((w == e) || (w->widx != t / BitSetData::bpb) ||
+              !w->bits.get(t % BitSetData::bpb))
+            throw Int::InvalidFile(l);
+        }
+      }
+    }
+    d.range_base = range_base;
+    d.td = td;
+    d.support = support;
+    if (state == Data::TS_SPARSE)
+      d.sparse_n_vals = static_cast<unsigned int>(n_vals);
+    d.sparse_offsets = sparse_offsets;
+    d.sparse_tuples = sparse_tuples;
+    d.sparse_tv = sparse_tv;
+    d.compressed_offsets = compressed_offsets;
+    d.compressed_words = compressed_words;
+    if (state == Data::TS_DENSE_COMPRESSED)
+      d.compressed_n_entries = static_cast<unsigned int>(n_entries);
+    d.state = state;
+    d.n_image = fi.n;
+    d.image = fi.release();
+    return ts;
+  }
+
+
+  /*
+   * DFAs
+   *
+   */
+
+  void
+  DFA::save(const std::string& fn) const {
+    using namespace Int::Extensional;
+    const DFAI* d = static_cast<DFAI*>(object());
+    FileHeader h;
+    file_header(h, dfa_magic);
+    h.field[0] = static_cast<std::uint64_t>(n_states());
+    h.field[1] = n_symbols();
+    h.field[2] = static_cast<std::uint64_t>(n_transitions());
+    h.field[3] = max_degree();
+    h.field[4] = static_cast<std::uint64_t>(final_fst());
+    h.field[5] = static_cast<std::uint64_t>(final_lst());
+    FileWriter fw(fn, "DFA::save()");
+    fw.bytes(&h, sizeof(FileHeader));
+    if (d != nullptr)
+      fw.section(d->trans, static_cast<std::size_t>(d->n_trans));
+    fw.close();
+  }
+
+  DFA
+  DFA::load(const std::string& fn) {
+    using namespace Int::Extensional;
+    const char* l = "DFA::load()";
+    FileImage fi(fn, l);
+    const FileHeader& h = fi.header(dfa_magic);
+    const std::uint64_t i_max = std::numeric_limits<int>::max();
+    if ((h.field[0] == 0U) || (h.field[0] > i_max) ||
+        (h.field[1] > i_max) || (h.field[2] > i_max) ||
+        (h.field[3] > i_max) || (h.field[4] > h.field[5]) ||
+        (h.field[5] > h.field[0]))
+      throw Int::InvalidFile(l);
+    // All states of a DFA are reachable from the start state
+    if (h.field[0] > h.field[2] + 1U)
+      throw Int::InvalidFile(l);
+    const int n_states = static_cast<int>(h.field[0]);
+    const int n_trans = static_cast<int>(h.field[2]);
+    Transition* t = fi.section<Transition>(h.field[2]);
+    for (int i=0; i<n_trans; i++)
+      if ((t[i].i_state < 0) || (t[i].i_state >= n_states) ||
+          (t[i].o_state < 0) || (t[i].o_state >= n_states) ||
+          ((i > 0) && (t[i-1].symbol > t[i].symbol)))
+        throw Int::InvalidFile(l);
+    // Recompute number of symbols and maximal degree as they determine
+    // the size of the symbol table and of the buffers of propagators
+    unsigned int n_symbols = 0U;
+    unsigned int max_degree = 0U;
+    {
+      Region r;
+      unsigned int* i_deg = r.alloc<unsigned int>(n_states);
+      unsigned int* o_deg = r.alloc<unsigned int>(n_states);
+      for (int i=0; i<n_states; i++)
+        i_deg[i] = o_deg[i] = 0U;
+      for (int i=0; i<n_trans; i++) {
+        i_deg[t[i].o_state]++; o_deg[t[i].i_state]++;
+      }
+      for (int i=0; i<n_states; i++)
+        max_degree = std::max(max_degree, std::max(i_deg[i],o_deg[i]));
+      for (int i=0; i<n_trans; ) {
+        int j = i++;
+        while ((i < n_trans) && (t[i].symbol == t[j].symbol))
+          i++;
+        n_symbols++;
+        max_degree = std::max(max_degree, static_cast<unsigned int>(i-j));
+      }
+    }
+    if ((n_symbols != h.field[1]) || (max_degree != h.field[3]) ||
+        (n_symbols >= (1U << 30)))
+      throw Int::InvalidFile(l);
+    DFAI* d = new DFAI(0);
+    d->n_states = n_states;
+    d->n_symbols = n_symbols;
+    d->n_trans = n_trans;
+    d->max_degree = max_degree;
+    d->final_fst = static_cast<int>(h.field[4]);
+    d->final_lst = static_cast<int>(h.field[5]);
+    d->trans = t;
+    d->n_image = fi.n;
+    d->image = fi.release();
+    d->fill();
+    DFA dfa;
+    dfa.object(d);
+    return dfa;
+  }
+
+}
+
+// STATISTICS: int-prop
@@ -590,9 +590,16 @@ namespace Gecode {
   }
 
   TupleSet::Data::~Data(void) {
-    clear_support();
-    heap.rfree(td);
-    heap.rfree(vd);
+    if (image != nullptr) {
+      // Only ranges and value data are allocated, the rest is mapped
+      heap.rfree(range);
+      heap.rfree(vd);
+      Int::Extensional::unmap(image,n_image);
+    } else {
+      clear_support();
+      heap.rfree(td);
+      heap.rfree(vd);
+    }
   }
 
 
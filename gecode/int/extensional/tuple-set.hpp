@@ -74,7 +74,7 @@ namespace Gecode {
       sparse_n_vals(0U), sparse_offsets(nullptr),
       sparse_tuples(nullptr), sparse_tv(nullptr),
       compressed_offsets(nullptr), compressed_words(nullptr),
-      compressed_n_entries(0U) {
+      compressed_n_entries(0U), image(nullptr), n_image(0U) {
   }
   
   forceinline bool
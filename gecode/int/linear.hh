@@ -767,10 +767,153 @@ namespace Gecode { namespace Int { namespace Linear {
     post(Home home, ViewArray<P>& x, ViewArray<N>& y, Val c, BoolView b);
   };
 
+  /**
+   * \brief Base-class for incremental n-ary linear propagators
+   *
+   * The propagator maintains the bounds of the left hand side
+   * incrementally by advisors, one per unassigned view. It also
+   * maintains an upper bound on the width of all unassigned views:
+   * as long as the slack exceeds this width, no view can be pruned
+   * and the propagator is not scheduled.
+   *
+   * The type \a Val can be either \c long long int or \c int, defining the
+   * numerical precision during propagation. Both positive and negative
+   * views are of type \a View.
+   */
+  template<class Val, class View>
+  class IncrLin : public Propagator {
+  protected:
+    /// %Advisor for a view and its last known bounds
+    class IncrAdvisor : public Advisor {
+    public:
+      /// Position of the view: \a x[i] if non-negative, \a y[-i-1] otherwise
+      int i;
+      /// Last known bounds of the view
+      Val l, u;
+      /// Create advisor for view at position \a i with bounds \a l and \a u
+      IncrAdvisor(Space& home, Propagator& p, Council<IncrAdvisor>& c,
+                  int i, Val l, Val u);
+      /// Clone advisor \a a
+      IncrAdvisor(Space& home, IncrAdvisor& a);
+    };
+    /// The advisor council
+    Council<IncrAdvisor> co;
+    /// Array of positive views
+    ViewArray<View> x;
+    /// Array of negative views
+    ViewArray<View> y;
+    /// Constant value
+    Val c;
+    /// Lower and upper bound of the left hand side
+    Val sl, su;
+    /// Upper bound on the width of all unassigned views
+    Val w;
+    /// Return view for advisor \a a
+    View view(const IncrAdvisor& a) const;
+    /// Update bounds after view of \a a has changed
+    void update(IncrAdvisor& a);
+    /// Eliminate assigned views from \a x and \a y by updating \a c
+    static void eliminate(ViewArray<View>& x, ViewArray<View>& y, Val& c);
+    /// Constructor for cloning \a p (only keeps unassigned views)
+    IncrLin(Space& home, IncrLin& p);
+    /// Constructor for creation
+    IncrLin(Home home, ViewArray<View>& x, ViewArray<View>& y, Val c);
+  public:
+    /// Cost function (defined as low linear)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+  };
+
+  /**
+   * \brief %Propagator for incremental bounds consistent n-ary linear equality
+   *
+   * The type \a Val can be either \c long long int or \c int, defining the
+   * numerical precision during propagation. The type \a View gives the
+   * type of the views.
+   *
+   * Requires \code #include <gecode/int/linear.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class Val, class View>
+  class IncrEq : public IncrLin<Val,View> {
+  protected:
+    typedef typename IncrLin<Val,View>::IncrAdvisor IncrAdvisor;
+    using IncrLin<Val,View>::co;
+    using IncrLin<Val,View>::x;
+    using IncrLin<Val,View>::y;
+    using IncrLin<Val,View>::c;
+    using IncrLin<Val,View>::sl;
+    using IncrLin<Val,View>::su;
+    using IncrLin<Val,View>::w;
+    using IncrLin<Val,View>::view;
+    using IncrLin<Val,View>::update;
+    /// Constructor for cloning \a p
+    IncrEq(Space& home, IncrEq& p);
+    /// Whether propagation might prune a view
+    bool prune(void) const;
+  public:
+    /// Constructor for creation
+    IncrEq(Home home, ViewArray<View>& x, ViewArray<View>& y, Val c);
+    /// Create copy during cloning
+    virtual Actor* copy(Space& home);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Post propagator for \f$\sum_{i=0}^{|x|-1}x_i-\sum_{i=0}^{|y|-1}y_i=c\f$
+    static ExecStatus
+    post(Home home, ViewArray<View>& x, ViewArray<View>& y, Val c);
+  };
+
+  /**
+   * \brief %Propagator for incremental bounds consistent n-ary linear less or equal
+   *
+   * The type \a Val can be either \c long long int or \c int, defining the
+   * numerical precision during propagation. The type \a View gives the
+   * type of the views.
+   *
+   * Requires \code #include <gecode/int/linear.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class Val, class View>
+  class IncrLq : public IncrLin<Val,View> {
+  protected:
+    typedef typename IncrLin<Val,View>::IncrAdvisor IncrAdvisor;
+    using IncrLin<Val,View>::co;
+    using IncrLin<Val,View>::x;
+    using IncrLin<Val,View>::y;
+    using IncrLin<Val,View>::c;
+    using IncrLin<Val,View>::sl;
+    using IncrLin<Val,View>::su;
+    using IncrLin<Val,View>::w;
+    using IncrLin<Val,View>::view;
+    using IncrLin<Val,View>::update;
+    /// Constructor for cloning \a p
+    IncrLq(Space& home, IncrLq& p);
+    /// Whether propagation might prune a view
+    bool prune(void) const;
+  public:
+    /// Constructor for creation
+    IncrLq(Home home, ViewArray<View>& x, ViewArray<View>& y, Val c);
+    /// Create copy during cloning
+    virtual Actor* copy(Space& home);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Post propagator for \f$\sum_{i=0}^{|x|-1}x_i-\sum_{i=0}^{|y|-1}y_i\leq c\f$
+    static ExecStatus
+    post(Home home, ViewArray<View>& x, ViewArray<View>& y, Val c);
+  };
+
 }}}
 
 #include <gecode/int/linear/int-nary.hpp>
 #include <gecode/int/linear/int-dom.hpp>
+#include <gecode/int/linear/int-incr.hpp>
 
 namespace Gecode { namespace Int { namespace Linear {
 
@@ -0,0 +1,331 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.dev
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <algorithm>
+
+namespace Gecode { namespace Int { namespace Linear {
+
+  /*
+   * Advisors
+   *
+   */
+  template<class Val, class View>
+  forceinline
+  IncrLin<Val,View>::IncrAdvisor::IncrAdvisor(Space& home, Propagator& p,
+                                              Council<IncrAdvisor>& c,
+                                              int i0, Val l0, Val u0)
+    : Advisor(home,p,c), i(i0), l(l0), u(u0) {}
+
+  template<class Val, class View>
+  forceinline
+  IncrLin<Val,View>::IncrAdvisor::IncrAdvisor(Space& home, IncrAdvisor& a)
+    : Advisor(home,a), i(a.i), l(a.l), u(a.u) {}
+
+
+  /*
+   * Incremental linear propagators
+   *
+   */
+  template<class Val, class View>
+  forceinline
+  IncrLin<Val,View>::IncrLin(Home home,
+                             ViewArray<View>& x0, ViewArray<View>& y0, Val c0)
+    : Propagator(home), co(home), x(x0), y(y0), c(c0), sl(0), su(0), w(0) {
+    for (int i=0; i<x.size(); i++) {
+      assert(!x[i].assigned());
+      Val l = x[i].min(), u = x[i].max();
+      sl += l; su += u; w = std::max(w,u-l);
+      x[i].subscribe(home,*new (home) IncrAdvisor(home,*this,co,i,l,u));
+    }
+    for (int i=0; i<y.size(); i++) {
+      assert(!y[i].assigned());
+      Val l = y[i].min(), u = y[i].max();
+      sl -= u; su -= l; w = std::max(w,u-l);
+      y[i].subscribe(home,*new (home) IncrAdvisor(home,*this,co,-i-1,l,u));
+    }
+    View::schedule(home,*this,ME_INT_BND);
+  }
+
+  template<class Val, class View>
+  forceinline
+  IncrLin<Val,View>::IncrLin(Space& home, IncrLin<Val,View>& p)
+    : Propagator(home,p), c(p.c), sl(p.sl), su(p.su), w(p.w) {
+    co.update(home,p.co);
+    // Only keep the views that still have an advisor
+    int n_x = 0, n_y = 0;
+    for (Advisors<IncrAdvisor> as(co); as(); ++as)
+      if (as.advisor().i >= 0)
+        n_x++;
+      else
+        n_y++;
+    x = ViewArray<View>(home,n_x);
+    y = ViewArray<View>(home,n_y);
+    n_x = 0; n_y = 0;
+    for (Advisors<IncrAdvisor> as(co); as(); ++as) {
+      IncrAdvisor& a = as.advisor();
+      if (a.i >= 0) {
+        x[n_x].update(home,p.x[a.i]); a.i = n_x++;
+      } else {
+        y[n_y].update(home,p.y[-a.i-1]); a.i = -(++n_y);
+      }
+    }
+  }
+
+  template<class Val, class View>
+  forceinline void
+  IncrLin<Val,View>::eliminate(ViewArray<View>& x, ViewArray<View>& y,
+                               Val& c) {
+    for (int i=x.size(); i--; )
+      if (x[i].assigned()) {
+        c -= x[i].val(); x.move_lst(i);
+      }
+    for (int i=y.size(); i--; )
+      if (y[i].assigned()) {
+        c += y[i].val(); y.move_lst(i);
+      }
+  }
+
+  template<class Val, class View>
+  forceinline View
+  IncrLin<Val,View>::view(const IncrAdvisor& a) const {
+    return (a.i >= 0) ? x[a.i] : y[-a.i-1];
+  }
+
+  template<class Val, class View>
+  forceinline void
+  IncrLin<Val,View>::update(IncrAdvisor& a) {
+    View v = view(a);
+    Val l = v.min(), u = v.max();
+    if (a.i >= 0) {
+      sl += l - a.l; su += u - a.u;
+    } else {
+      sl -= u - a.u; su -= l - a.l;
+    }
+    a.l = l; a.u = u;
+  }
+
+  template<class Val, class View>
+  PropCost
+  IncrLin<Val,View>::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::linear(PropCost::LO, x.size()+y.size());
+  }
+
+  template<class Val, class View>
+  void
+  IncrLin<Val,View>::reschedule(Space& home) {
+    View::schedule(home,*this,ME_INT_BND);
+  }
+
+  template<class Val, class View>
+  forceinline size_t
+  IncrLin<Val,View>::dispose(Space& home) {
+    for (Advisors<IncrAdvisor> as(co); as(); ++as)
+      view(as.advisor()).cancel(home,as.advisor());
+    co.dispose(home);
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+
+  /*
+   * Incremental bounds consistent linear equation
+   *
+   */
+  template<class Val, class View>
+  forceinline
+  IncrEq<Val,View>::IncrEq(Home home,
+                           ViewArray<View>& x, ViewArray<View>& y, Val c)
+    : IncrLin<Val,View>(home,x,y,c) {}
+
+  template<class Val, class View>
+  forceinline
+  IncrEq<Val,View>::IncrEq(Space& home, IncrEq<Val,View>& p)
+    : IncrLin<Val,View>(home,p) {}
+
+  template<class Val, class View>
+  ExecStatus
+  IncrEq<Val,View>::post(Home home,
+                         ViewArray<View>& x, ViewArray<View>& y, Val c) {
+    IncrLin<Val,View>::eliminate(x,y,c);
+    if (x.size() + y.size() == 0)
+      return (c == static_cast<Val>(0)) ? ES_OK : ES_FAILED;
+    (void) new (home) IncrEq<Val,View>(home,x,y,c);
+    return ES_OK;
+  }
+
+  template<class Val, class View>
+  Actor*
+  IncrEq<Val,View>::copy(Space& home) {
+    return new (home) IncrEq<Val,View>(home,*this);
+  }
+
+  template<class Val, class View>
+  forceinline bool
+  IncrEq<Val,View>::prune(void) const {
+    return (c - sl < w) || (su - c < w) || (sl == su);
+  }
+
+  template<class Val, class View>
+  ExecStatus
+  IncrEq<Val,View>::advise(Space& home, Advisor& a0, const Delta&) {
+    IncrAdvisor& a = static_cast<IncrAdvisor&>(a0);
+    update(a);
+    if (view(a).assigned())
+      a.dispose(home,co);
+    return prune() ? ES_NOFIX : ES_FIX;
+  }
+
+  template<class Val, class View>
+  ExecStatus
+  IncrEq<Val,View>::propagate(Space& home, const ModEventDelta&) {
+    bool mod;
+    do {
+      if ((sl > c) || (su < c))
+        return ES_FAILED;
+      // The bounds are updated by the advisors during propagation
+      Val ls = c - sl;
+      Val us = su - c;
+      if ((ls >= w) && (us >= w))
+        break;
+      mod = false;
+      Val nw = 0;
+      for (Advisors<IncrAdvisor> as(co); as(); ++as) {
+        IncrAdvisor& a = as.advisor();
+        ModEvent me;
+        if (a.i >= 0) {
+          View& v = x[a.i];
+          me = v.lq(home,v.min() + ls);
+          if (me_failed(me))
+            return ES_FAILED;
+          mod |= me_modified(me);
+          me = v.gq(home,v.max() - us);
+          if (me_failed(me))
+            return ES_FAILED;
+          mod |= me_modified(me);
+          nw = std::max(nw,v.max() - v.min());
+        } else {
+          View& v = y[-a.i-1];
+          me = v.gq(home,v.max() - ls);
+          if (me_failed(me))
+            return ES_FAILED;
+          mod |= me_modified(me);
+          me = v.lq(home,v.min() + us);
+          if (me_failed(me))
+            return ES_FAILED;
+          mod |= me_modified(me);
+          nw = std::max(nw,v.max() - v.min());
+        }
+      }
+      w = nw;
+    } while (mod);
+    return (sl == su) ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+
+  /*
+   * Incremental bounds consistent linear inequation
+   *
+   */
+  template<class Val, class View>
+  forceinline
+  IncrLq<Val,View>::IncrLq(Home home,
+                           ViewArray<View>& x, ViewArray<View>& y, Val c)
+    : IncrLin<Val,View>(home,x,y,c) {}
+
+  template<class Val, class View>
+  forceinline
+  IncrLq<Val,View>::IncrLq(Space& home, IncrLq<Val,View>& p)
+    : IncrLin<Val,View>(home,p) {}
+
+  template<class Val, class View>
+  ExecStatus
+  IncrLq<Val,View>::post(Home home,
+                         ViewArray<View>& x, ViewArray<View>& y, Val c) {
+    IncrLin<Val,View>::eliminate(x,y,c);
+    if (x.size() + y.size() == 0)
+      return (c >= static_cast<Val>(0)) ? ES_OK : ES_FAILED;
+    (void) new (home) IncrLq<Val,View>(home,x,y,c);
+    return ES_OK;
+  }
+
+  template<class Val, class View>
+  Actor*
+  IncrLq<Val,View>::copy(Space& home) {
+    return new (home) IncrLq<Val,View>(home,*this);
+  }
+
+  template<class Val, class View>
+  forceinline bool
+  IncrLq<Val,View>::prune(void) const {
+    return (c - sl < w) || (su <= c);
+  }
+
+  template<class Val, class View>
+  ExecStatus
+  IncrLq<Val,View>::advise(Space& home, Advisor& a0, const Delta&) {
+    IncrAdvisor& a = static_cast<IncrAdvisor&>(a0);
+    update(a);
+    if (view(a).assigned())
+      a.dispose(home,co);
+    return prune() ? ES_NOFIX : ES_FIX;
+  }
+
+  template<class Val, class View>
+  ExecStatus
+  IncrLq<Val,View>::propagate(Space& home, const ModEventDelta&) {
+    if (sl > c)
+      return ES_FAILED;
+    // Pruning upper bounds does not change the lower bound sl
+    Val s = c - sl;
+    if (s < w) {
+      Val nw = 0;
+      for (Advisors<IncrAdvisor> as(co); as(); ++as) {
+        IncrAdvisor& a = as.advisor();
+        if (a.i >= 0) {
+          View& v = x[a.i];
+          GECODE_ME_CHECK(v.lq(home,v.min() + s));
+          nw = std::max(nw,v.max() - v.min());
+        } else {
+          View& v = y[-a.i-1];
+          GECODE_ME_CHECK(v.gq(home,v.max() - s));
+          nw = std::max(nw,v.max() - v.min());
+        }
+      }
+      w = nw;
+    }
+    return (su <= c) ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+}}}
+
+// STATISTICS: int-prop
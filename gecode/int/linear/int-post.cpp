@@ -156,16 +156,27 @@ namespace Gecode { namespace Int { namespace Linear {
   template<class Val, class View>
   forceinline void
   post_nary(Home home,
-            ViewArray<View>& x, ViewArray<View>& y, IntRelType irt, Val c) {
+            ViewArray<View>& x, ViewArray<View>& y, IntRelType irt, Val c,
+            IntPropLevel ipl) {
+    // Advanced propagation uses the incremental propagators
+    bool incr = (ba(ipl) & IPL_ADVANCED) != 0;
     switch (irt) {
     case IRT_EQ:
-      GECODE_ES_FAIL((Eq<Val,View,View >::post(home,x,y,c)));
+      if (incr) {
+        GECODE_ES_FAIL((IncrEq<Val,View>::post(home,x,y,c)));
+      } else {
+        GECODE_ES_FAIL((Eq<Val,View,View >::post(home,x,y,c)));
+      }
       break;
     case IRT_NQ:
       GECODE_ES_FAIL((Nq<Val,View,View >::post(home,x,y,c)));
       break;
     case IRT_LQ:
-      GECODE_ES_FAIL((Lq<Val,View,View >::post(home,x,y,c)));
+      if (incr) {
+        GECODE_ES_FAIL((IncrLq<Val,View>::post(home,x,y,c)));
+      } else {
+        GECODE_ES_FAIL((Lq<Val,View,View >::post(home,x,y,c)));
+      }
       break;
     default: GECODE_NEVER;
     }
@@ -340,7 +351,7 @@ namespace Gecode { namespace Int { namespace Linear {
         ViewArray<IntView> y(home,n_n);
         for (int i=0; i<n_n; i++)
           y[i] = t_n[i].x;
-        post_nary<int,IntView>(home,x,y,irt,c);
+        post_nary<int,IntView>(home,x,y,irt,c,ipl);
       }
     } else if (is_ip) {
       if ((n==2) && is_unit &&
@@ -383,7 +394,7 @@ namespace Gecode { namespace Int { namespace Linear {
         if ((vbd(ipl) == IPL_DOM) && (irt == IRT_EQ)) {
           GECODE_ES_FAIL((DomEq<int,IntScaleView>::post(home,x,y,c)));
         } else {
-          post_nary<int,IntScaleView>(home,x,y,irt,c);
+          post_nary<int,IntScaleView>(home,x,y,irt,c,ipl);
         }
       }
     } else {
@@ -398,7 +409,7 @@ namespace Gecode { namespace Int { namespace Linear {
         GECODE_ES_FAIL((DomEq<long long int,LLongScaleView>
                         ::post(home,x,y,d)));
       } else {
-        post_nary<long long int,LLongScaleView>(home,x,y,irt,d);
+        post_nary<long long int,LLongScaleView>(home,x,y,irt,d,ipl);
       }
     }
   }
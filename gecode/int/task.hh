@@ -453,6 +453,10 @@ namespace Gecode { namespace Int {
     static const bool basic = true;
     /// Do not perform advanced propagation
     static const bool advanced = false;
+    /// Do not perform time-table edge-finding
+    static const bool ttef = false;
+    /// Do not perform energetic reasoning
+    static const bool energetic = false;
     /// For basic propagation, domain operations are needed
     static const PropCond pc = PC_INT_DOM;
   };
@@ -464,6 +468,10 @@ namespace Gecode { namespace Int {
     static const bool basic = false;
     /// Do not perform advanced propagation
     static const bool advanced = true;
+    /// Do not perform time-table edge-finding
+    static const bool ttef = false;
+    /// Do not perform energetic reasoning
+    static const bool energetic = false;
     /// For basic propagation, domain operations are needed
     static const PropCond pc = PC_INT_BND;
   };
@@ -475,6 +483,70 @@ namespace Gecode { namespace Int {
     static const bool basic = true;
     /// Do not perform advanced propagation
     static const bool advanced = true;
+    /// Do not perform time-table edge-finding
+    static const bool ttef = false;
+    /// Do not perform energetic reasoning
+    static const bool energetic = false;
+    /// For basic propagation, domain operations are needed
+    static const PropCond pc = PC_INT_DOM;
+  };
+
+  /// Class for defining advanced propagation level with time-table edge-finding
+  class PLAT {
+  public:
+    /// Do not perform basic propagation
+    static const bool basic = false;
+    /// Perform advanced propagation
+    static const bool advanced = true;
+    /// Perform time-table edge-finding
+    static const bool ttef = true;
+    /// Do not perform energetic reasoning
+    static const bool energetic = false;
+    /// For advanced propagation, bounds operations are sufficient
+    static const PropCond pc = PC_INT_BND;
+  };
+
+  /// Class for defining advanced propagation level with time-table edge-finding and energetic reasoning
+  class PLATE {
+  public:
+    /// Do not perform basic propagation
+    static const bool basic = false;
+    /// Perform advanced propagation
+    static const bool advanced = true;
+    /// Perform time-table edge-finding
+    static const bool ttef = true;
+    /// Perform energetic reasoning
+    static const bool energetic = true;
+    /// For advanced propagation, bounds operations are sufficient
+    static const PropCond pc = PC_INT_BND;
+  };
+
+  /// Class for defining basic and advanced propagation level with time-table edge-finding
+  class PLBAT {
+  public:
+    /// Perform basic propagation
+    static const bool basic = true;
+    /// Perform advanced propagation
+    static const bool advanced = true;
+    /// Perform time-table edge-finding
+    static const bool ttef = true;
+    /// Do not perform energetic reasoning
+    static const bool energetic = false;
+    /// For basic propagation, domain operations are needed
+    static const PropCond pc = PC_INT_DOM;
+  };
+
+  /// Class for defining basic and advanced propagation level with time-table edge-finding and energetic reasoning
+  class PLBATE {
+  public:
+    /// Perform basic propagation
+    static const bool basic = true;
+    /// Perform advanced propagation
+    static const bool advanced = true;
+    /// Perform time-table edge-finding
+    static const bool ttef = true;
+    /// Perform energetic reasoning
+    static const bool energetic = true;
     /// For basic propagation, domain operations are needed
     static const PropCond pc = PC_INT_DOM;
   };
@@ -527,9 +599,69 @@ namespace Gecode { namespace Int {
   std::basic_ostream<Char,Traits>&
   operator <<(std::basic_ostream<Char,Traits>& os, const Event& e);
 
+  /**
+   * \brief Incrementally maintained resource profile
+   *
+   * The profile records the times at which the resource usage and the
+   * number of tasks change, in increasing order of time. Usage is added
+   * and removed per task, so that only tasks whose compulsory part has
+   * changed must be updated rather than rebuilding and sorting the
+   * profile from scratch.
+   *
+   * Requires \code #include <gecode/int/task.hh> \endcode
+   */
+  class Profile {
+  public:
+    /// Point at which the usage changes
+    class Point {
+    public:
+      /// Time of the change
+      int t;
+      /// Change of usage
+      long long int h;
+      /// Change of number of tasks
+      int k;
+      /// Number of intervals that start or end at this time
+      int b;
+    };
+  protected:
+    /// Number of points
+    int n;
+    /// Number of points for which memory has been allocated
+    int l;
+    /// Points ordered by increasing time
+    Point* p;
+    /**
+     * \brief Change usage by \a h and number of tasks by \a k from time \a t on
+     *
+     * The number of intervals with a boundary at \a t is changed by \a b.
+     * A point is kept as long as some interval starts or ends at it, even
+     * if usage and number of tasks do not change.
+     */
+    void change(Space& home, int t, long long int h, int k, int b);
+  public:
+    /// Initialize empty profile
+    Profile(void);
+    /// Add usage \a h and \a k tasks during time interval [\a s,\a e)
+    void add(Space& home, int s, int e, long long int h, int k);
+    /// Remove usage \a h and \a k tasks during time interval [\a s,\a e)
+    void remove(Space& home, int s, int e, long long int h, int k);
+    /// Return number of points
+    int size(void) const;
+    /// Return point \a i
+    const Point& operator [](int i) const;
+    /// Return index of first point with time larger than \a t
+    int upper(int t) const;
+    /// Update profile during cloning from profile \a p
+    void update(Space& home, const Profile& p);
+    /// Release memory of profile
+    void dispose(Space& home);
+  };
+
 }}
 
 #include <gecode/int/task/event.hpp>
+#include <gecode/int/task/profile.hpp>
 
 #endif
 
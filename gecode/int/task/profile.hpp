@@ -0,0 +1,136 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.dev
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <algorithm>
+
+namespace Gecode { namespace Int {
+
+  forceinline
+  Profile::Profile(void) : n(0), l(0), p(nullptr) {}
+
+  forceinline void
+  Profile::change(Space& home, int t, long long int h, int k, int b) {
+    // Find first point not before t
+    int lo = 0, hi = n;
+    while (lo < hi) {
+      int m = lo + (hi - lo) / 2;
+      if (p[m].t < t)
+        lo = m+1;
+      else
+        hi = m;
+    }
+    if ((lo < n) && (p[lo].t == t)) {
+      p[lo].h += h; p[lo].k += k; p[lo].b += b;
+      if (p[lo].b == 0) {
+        // Remove point that is no longer a boundary of any interval
+        assert((p[lo].h == 0) && (p[lo].k == 0));
+        n--;
+        for (int i=lo; i<n; i++)
+          p[i] = p[i+1];
+      }
+      return;
+    }
+    if (n == l) {
+      int nl = std::max(2*l,8);
+      if (l == 0)
+        p = home.alloc<Point>(nl);
+      else
+        p = home.realloc<Point>(p,l,nl);
+      l = nl;
+    }
+    for (int i=n; i>lo; i--)
+      p[i] = p[i-1];
+    n++;
+    p[lo].t = t; p[lo].h = h; p[lo].k = k; p[lo].b = b;
+  }
+
+  forceinline void
+  Profile::add(Space& home, int s, int e, long long int h, int k) {
+    assert(s < e);
+    change(home,s,h,k,1);
+    change(home,e,-h,-k,1);
+  }
+
+  forceinline void
+  Profile::remove(Space& home, int s, int e, long long int h, int k) {
+    assert(s < e);
+    change(home,s,-h,-k,-1);
+    change(home,e,h,k,-1);
+  }
+
+  forceinline int
+  Profile::size(void) const {
+    return n;
+  }
+
+  forceinline const Profile::Point&
+  Profile::operator [](int i) const {
+    assert((i >= 0) && (i < n));
+    return p[i];
+  }
+
+  forceinline int
+  Profile::upper(int t) const {
+    int lo = 0, hi = n;
+    while (lo < hi) {
+      int m = lo + (hi - lo) / 2;
+      if (p[m].t <= t)
+        lo = m+1;
+      else
+        hi = m;
+    }
+    return lo;
+  }
+
+  forceinline void
+  Profile::update(Space& home, const Profile& pr) {
+    n = l = pr.n;
+    if (n > 0) {
+      p = home.alloc<Point>(n);
+      for (int i=0; i<n; i++)
+        p[i] = pr.p[i];
+    } else {
+      p = nullptr;
+    }
+  }
+
+  forceinline void
+  Profile::dispose(Space& home) {
+    if (l > 0)
+      home.free<Point>(p,l);
+    n = l = 0; p = nullptr;
+  }
+
+}}
+
+// STATISTICS: int-prop
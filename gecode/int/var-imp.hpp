@@ -198,6 +198,27 @@ namespace Gecode { namespace Int {
     void lst(RangeList* l);
     /// Size of holes in the domain
     unsigned int holes;
+    /// Value corresponding to the first bit of the dense index
+    int bmin;
+    /**
+     * \brief Dense index for domains with holes
+     *
+     * If the domain has holes and its width does not exceed \a idx_width
+     * when the first hole is created, bit \f$i\f$ is set if and only if
+     * \f$\mathit{bmin}+i\f$ is included in the domain. Only the bits
+     * between the minimum and maximum of the domain are maintained and
+     * only while the domain is not a range. As domains only shrink, the
+     * index is allocated once per space and reused.
+     */
+    Support::BitSetData* bits;
+    /// Maximal width of a domain for which a dense index is created
+    static const unsigned int idx_width = 512U;
+    /// Set bits \a f to \a l (both inclusive) in \a b
+    static void fill(Support::BitSetData* b, unsigned int f, unsigned int l);
+    /// Build dense index from the range list (if the width permits)
+    GECODE_INT_EXPORT void index(Space& home);
+    /// Replace domain by the values from \a b (in layout of the dense index)
+    GECODE_INT_EXPORT ModEvent narrow_b(Space& home, Support::BitSetData* b);
 
   protected:
     /// Constructor for cloning \a x
@@ -67,6 +67,11 @@ namespace Gecode { namespace Int {
 
   bool
   IntVarImp::in_full(int m) const {
+    if (bits != nullptr) {
+      unsigned int i = static_cast<unsigned int>(m - bmin);
+      return bits[i / Support::BitSetData::bpb]
+        .get(i % Support::BitSetData::bpb);
+    }
     if (closer_min(m)) {
       const RangeList* p = nullptr;
       const RangeList* c = fst();
@@ -203,7 +208,10 @@ namespace Gecode { namespace Int {
         f->prevnext(nullptr,l);
         l->prevnext(f,nullptr);
         fst(f); lst(l); holes = 1;
+        index(home);
       }
+    } else if ((bits != nullptr) && !in_full(m)) {
+      return ME_INT_NONE;
     } else if (m < fst()->next(nullptr)->min()) { // Concerns the first range...
       int f_max = fst()->max();
       if (m > f_max)
@@ -312,11 +320,129 @@ namespace Gecode { namespace Int {
         }
       }
     }
+    if (bits != nullptr) {
+      unsigned int i = static_cast<unsigned int>(m - bmin);
+      bits[i / Support::BitSetData::bpb].clear(i % Support::BitSetData::bpb);
+    }
     IntDelta d(m,m);
     return notify(home,me,d);
   }
 
 
+  /*
+   * Dense index
+   *
+   */
+
+  void
+  IntVarImp::index(Space& home) {
+    assert(!range());
+    if (bits == nullptr) {
+      if (width() > idx_width)
+        return;
+      bmin = dom.min();
+      bits = home.alloc<Support::BitSetData>
+        (Support::BitSetData::data(width()));
+    }
+    const unsigned int bpb = Support::BitSetData::bpb;
+    unsigned int l = static_cast<unsigned int>(dom.min() - bmin);
+    unsigned int u = static_cast<unsigned int>(dom.max() - bmin);
+    for (unsigned int i = l / bpb; i <= u / bpb; i++)
+      bits[i].init(false);
+    const RangeList* p = nullptr;
+    const RangeList* c = fst();
+    while (c != nullptr) {
+      fill(bits,static_cast<unsigned int>(c->min() - bmin),
+           static_cast<unsigned int>(c->max() - bmin));
+      const RangeList* n=c->next(p); p=c; c=n;
+    }
+  }
+
+  ModEvent
+  IntVarImp::narrow_b(Space& home, Support::BitSetData* b) {
+    assert((bits != nullptr) && !range());
+    const unsigned int bpb = Support::BitSetData::bpb;
+    unsigned int l = static_cast<unsigned int>(dom.min() - bmin);
+    unsigned int u = static_cast<unsigned int>(dom.max() - bmin);
+    // Clear bits outside the current bounds
+    for (unsigned int i = (l / bpb) * bpb; i < l; i++)
+      b[l / bpb].clear(i % bpb);
+    for (unsigned int i = u + 1U; (i % bpb) != 0U; i++)
+      b[u / bpb].clear(i % bpb);
+    // Count remaining values
+    unsigned int s = 0;
+    for (unsigned int i = l / bpb; i <= u / bpb; i++)
+      s += b[i].ones();
+    if (s == 0U)
+      return fail(home);
+    if (s == size())
+      return ME_INT_NONE;
+
+    // Construct new rangelist from the runs of set bits
+    RangeList* f = nullptr;
+    RangeList* r = nullptr;
+    unsigned int i = l;
+    while (true) {
+      // Find first value of the next run
+      unsigned int w = i / bpb;
+      if (b[w](i % bpb)) {
+        i = w*bpb + b[w].next(i % bpb);
+      } else {
+        do {
+          w++;
+        } while ((w <= u / bpb) && !b[w]());
+        if (w > u / bpb)
+          break;
+        i = w*bpb + b[w].next();
+      }
+      // Find last value of the run
+      unsigned int j = i;
+      w = j / bpb;
+      if ((~b[w])(j % bpb)) {
+        j = w*bpb + (~b[w]).next(j % bpb);
+      } else {
+        do {
+          w++;
+        } while ((w <= u / bpb) && b[w].all());
+        j = (w > u / bpb) ? u + 1U : w*bpb + (~b[w]).next();
+      }
+      RangeList* n = new (home) RangeList(bmin + static_cast<int>(i),
+                                          bmin + static_cast<int>(j) - 1,
+                                          r,nullptr);
+      if (r == nullptr)
+        f = n;
+      else
+        r->next(nullptr,n);
+      r = n;
+      if (j > u)
+        break;
+      i = j;
+    }
+    assert(f != nullptr);
+
+    fst()->dispose(home,nullptr,lst());
+    const int min1 = dom.min(); dom.min(f->min());
+    const int max1 = dom.max(); dom.max(r->max());
+
+    ModEvent me;
+    if (f == r) {
+      // Only a single range left
+      f->dispose(home);
+      fst(nullptr); holes = 0;
+      me = assigned() ? ME_INT_VAL : ME_INT_BND;
+    } else {
+      fst(f); lst(r);
+      holes = width() - s;
+      for (unsigned int k = l / bpb; k <= u / bpb; k++)
+        bits[k] = b[k];
+      me = ((dom.min() == min1) && (dom.max() == max1)) ?
+        ME_INT_DOM : ME_INT_BND;
+    }
+    IntDelta d;
+    return notify(home,me,d);
+  }
+
+
 
   /*
    * Copying variables
@@ -325,7 +451,7 @@ namespace Gecode { namespace Int {
 
   forceinline
   IntVarImp::IntVarImp(Space& home, IntVarImp& x)
-    : IntVarImpBase(home,x), dom(x.dom.min(),x.dom.max()) {
+    : IntVarImpBase(home,x), dom(x.dom.min(),x.dom.max()), bits(nullptr) {
     holes = x.holes;
     if (holes) {
       int m = 1;
@@ -354,6 +480,7 @@ namespace Gecode { namespace Int {
         RangeList* s_n=s_c->next(s_p); s_p=s_c; s_c=s_n;
       } while (s_c != nullptr);
       d_c->next(nullptr,nullptr);
+      index(home);
     } else {
       fst(nullptr);
     }
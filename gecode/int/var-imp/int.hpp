@@ -187,6 +187,24 @@ namespace Gecode { namespace Int {
     _lst = l;
   }
 
+  /*
+   * Dense index
+   *
+   */
+
+  forceinline void
+  IntVarImp::fill(Support::BitSetData* b, unsigned int f, unsigned int l) {
+    const unsigned int bpb = Support::BitSetData::bpb;
+    // Leading bits, full words, and trailing bits
+    for (; (f <= l) && ((f % bpb) != 0U); f++)
+      b[f / bpb].set(f % bpb);
+    for (; (f <= l) && (l - f + 1U >= bpb); f += bpb)
+      b[f / bpb].init(true);
+    for (; f <= l; f++)
+      b[f / bpb].set(f % bpb);
+  }
+
+
   /*
    * Creation of new variable implementations
    *
@@ -194,11 +212,12 @@ namespace Gecode { namespace Int {
 
   forceinline
   IntVarImp::IntVarImp(Space& home, int min, int max)
-    : IntVarImpBase(home), dom(min,max,nullptr,nullptr), holes(0) {}
+    : IntVarImpBase(home), dom(min,max,nullptr,nullptr), holes(0),
+      bits(nullptr) {}
 
   forceinline
   IntVarImp::IntVarImp(Space& home, const IntSet& d)
-    : IntVarImpBase(home), dom(d.min(),d.max()) {
+    : IntVarImpBase(home), dom(d.min(),d.max()), bits(nullptr) {
     if (d.ranges() > 1) {
       int n = d.ranges();
       assert(n >= 2);
@@ -217,6 +236,7 @@ namespace Gecode { namespace Int {
       r[n-1].min(d.min(n-1)); r[n-1].max(d.max(n-1));
       r[n-1].prevnext(&r[n-2],nullptr);
       holes = h;
+      index(home);
     } else {
       fst(nullptr); holes = 0;
     }
@@ -537,6 +557,28 @@ namespace Gecode { namespace Int {
       goto notify;
     }
 
+    if ((bits != nullptr) && !range()) {
+      // Narrow on the dense index
+      const unsigned int bpb = Support::BitSetData::bpb;
+      Support::BitSetData b[idx_width / Support::BitSetData::bpb];
+      unsigned int l = static_cast<unsigned int>(dom.min() - bmin);
+      unsigned int u = static_cast<unsigned int>(dom.max() - bmin);
+      for (unsigned int i = l / bpb; i <= u / bpb; i++)
+        b[i].init(false);
+      while (true) {
+        min0 = std::max(min0,dom.min()); max0 = std::min(max0,dom.max());
+        if (min0 <= max0)
+          fill(b,static_cast<unsigned int>(min0 - bmin),
+               static_cast<unsigned int>(max0 - bmin));
+        if (!ri())
+          break;
+        min0 = ri.min(); max0 = ri.max(); ++ri;
+      }
+      for (unsigned int i = l / bpb; i <= u / bpb; i++)
+        b[i].a(bits[i]);
+      return narrow_b(home,b);
+    }
+
     if (depends || range()) {
       // Construct new rangelist
       RangeList*   f = new (home) RangeList(min0,max0,nullptr,nullptr);
@@ -674,6 +716,8 @@ namespace Gecode { namespace Int {
       return ME_INT_NONE;
     }
   notify:
+    if (!range())
+      index(home);
     IntDelta d;
     return notify(home,me,d);
   }
@@ -841,6 +885,8 @@ namespace Gecode { namespace Int {
 
     return ME_INT_NONE;
   notify:
+    if (!range())
+      index(home);
     IntDelta d;
     return notify(home,me,d);
   }
@@ -855,6 +901,23 @@ namespace Gecode { namespace Int {
   template<class I>
   forceinline ModEvent
   IntVarImp::inter_v(Space& home, I& i, bool depends) {
+    if ((bits != nullptr) && !range()) {
+      // Intersect on the dense index
+      const unsigned int bpb = Support::BitSetData::bpb;
+      Support::BitSetData b[idx_width / Support::BitSetData::bpb];
+      unsigned int l = static_cast<unsigned int>(dom.min() - bmin);
+      unsigned int u = static_cast<unsigned int>(dom.max() - bmin);
+      for (unsigned int j = l / bpb; j <= u / bpb; j++)
+        b[j].init(false);
+      while (i() && (i.val() < dom.min()))
+        ++i;
+      for (; i() && (i.val() <= dom.max()); ++i) {
+        unsigned int j = static_cast<unsigned int>(i.val() - bmin);
+        if (bits[j / bpb].get(j % bpb))
+          b[j / bpb].set(j % bpb);
+      }
+      return narrow_b(home,b);
+    }
     Iter::Values::ToRanges<I> r(i);
     return inter_r(home,r,depends);
   }
@@ -862,6 +925,26 @@ namespace Gecode { namespace Int {
   template<class I>
   forceinline ModEvent
   IntVarImp::minus_v(Space& home, I& i, bool depends) {
+    if ((bits != nullptr) && !range()) {
+      // Remove values on the dense index
+      const unsigned int bpb = Support::BitSetData::bpb;
+      Support::BitSetData b[idx_width / Support::BitSetData::bpb];
+      unsigned int l = static_cast<unsigned int>(dom.min() - bmin);
+      unsigned int u = static_cast<unsigned int>(dom.max() - bmin);
+      for (unsigned int j = l / bpb; j <= u / bpb; j++)
+        b[j] = bits[j];
+      bool mod = false;
+      while (i() && (i.val() < dom.min()))
+        ++i;
+      for (; i() && (i.val() <= dom.max()); ++i) {
+        unsigned int j = static_cast<unsigned int>(i.val() - bmin);
+        if (b[j / bpb].get(j % bpb)) {
+          b[j / bpb].clear(j % bpb); mod = true;
+        }
+      }
+      return mod ? narrow_b(home,b) : ME_INT_NONE;
+    }
+
     if (depends) {
       Iter::Values::ToRanges<I> r(i);
       return minus_r(home, r, true);
@@ -987,11 +1070,13 @@ namespace Gecode { namespace Int {
       assert((dom.min() != fn->min()) || (dom.max() != ln->max()));
       dom.min(fn->min()); dom.max(ln->max());
       holes -= b;
+      index(home);
       return notify(home,ME_INT_BND,d);
     }
 
     if (h > 0) {
       assert((dom.min() == fn->min()) && (dom.max() == ln->max()));
+      index(home);
       return notify(home,ME_INT_DOM,d);
     }
 
@@ -46,6 +46,7 @@
 #include <cfloat>
 
 #include <functional>
+#include <typeinfo>
 
 #include <gecode/support.hh>
 
@@ -43,6 +43,11 @@
 
 #include <gecode/kernel.hh>
 
+#ifdef GECODE_PROPAGATION_STATISTICS
+#include <map>
+#include <string>
+#endif
+
 namespace Gecode {
 
   /*
@@ -130,6 +135,7 @@ namespace Gecode {
     pl.init();
     bl.init();
     b_status = b_commit = Brancher::cast(&bl);
+    sp = SP_FIFO;
     // Initialize array for forced deletion to be empty
     d_fst = d_cur = d_lst = nullptr;
     // Initialize space as stable but not failed
@@ -140,6 +146,9 @@ namespace Gecode {
     pc.p.bid_sc = (reserved_bid+1) << sc_bits;
     pc.p.n_sub  = 0;
     pc.p.vti.other();
+#ifdef GECODE_PROPAGATION_STATISTICS
+    pc.p.n_mod  = 0ULL;
+#endif
   }
 
   void
@@ -298,7 +307,7 @@ namespace Gecode {
         med_o = p->u.med;
         // Clear med but leave propagator in queue
         p->u.med = 0;
-        switch (p->propagate(*this,med_o)) {
+        switch (propagate(*p,med_o,stat)) {
         case ES_FAILED:
           goto failed;
         case ES_NOFIX:
@@ -360,7 +369,7 @@ namespace Gecode {
         med_o = p->u.med;
         // Clear med but leave propagator in queue
         p->u.med = 0;
-        switch (p->propagate(*this,med_o)) {
+        switch (propagate(*p,med_o,stat)) {
         case ES_FAILED:
           goto failed;
         case ES_NOFIX:
@@ -438,7 +447,7 @@ namespace Gecode {
         med_o = p->u.med;
         // Clear med but leave propagator in queue
         p->u.med = 0;
-        switch (p->propagate(*this,med_o)) {
+        switch (propagate(*p,med_o,stat)) {
         case ES_FAILED:
           GECODE_STATUS_TRACE(p,FAILED);
           goto failed;
@@ -727,6 +736,7 @@ namespace Gecode {
 #ifdef GECODE_HAS_CBS
       var_id_counter(s.var_id_counter),
 #endif
+      sp(s.sp),
       d_fst(&Actor::sentinel),d_cur(nullptr),d_lst(nullptr) {
 #ifdef GECODE_HAS_VAR_DISPOSE
     for (int i=0; i<AllVarConf::idx_d; i++)
@@ -791,7 +801,7 @@ namespace Gecode {
   }
 
   Space*
-  Space::_clone(void) {
+  Space::_clone(CloneStatistics& stat) {
     if (failed())
       throw SpaceFailed("Space::clone");
     if (!stable())
@@ -863,6 +873,7 @@ namespace Gecode {
           } while (a != nullptr);
         }
         c_a->prev(p_a); p_a = c_a; c_a = c_a->next();
+        stat.actors++;
       }
     }
     {
@@ -871,6 +882,7 @@ namespace Gecode {
       // Update branchers
       while (c_a != &bl) {
         c_a->prev(p_a); p_a = c_a; c_a = c_a->next();
+        stat.actors++;
       }
     }
 
@@ -885,10 +897,15 @@ namespace Gecode {
     // Copy propagation only data
     c->pc.p.n_sub  = pc.p.n_sub;
     c->pc.p.bid_sc = pc.p.bid_sc;
+#ifdef GECODE_PROPAGATION_STATISTICS
+    c->pc.p.n_mod  = 0ULL;
+#endif
 
     // Reset execution information
     c->pc.p.vti.other(); pc.p.vti.other();
 
+    stat.copied += c->mm.used();
+
     return c;
   }
 
@@ -935,6 +952,23 @@ namespace Gecode {
     }
   }
 
+#ifdef GECODE_PROPAGATION_STATISTICS
+  void
+  Space::propagation(SendPropagation send) const {
+    // Accumulate per class name and group, names might differ in address
+    std::map<std::pair<std::string,unsigned int>,
+             std::pair<unsigned long long int,unsigned long long int>> n;
+    ssd.data().gpi.executed([&n](const Kernel::GPI::Info& i) {
+      auto& c = n[std::make_pair(std::string(i.name.load()),i.gid)];
+      c.first  += i.propagate.load(std::memory_order_relaxed);
+      c.second += i.noop.load(std::memory_order_relaxed);
+    });
+    for (const auto& c : n)
+      send(c.first.first.c_str(),c.first.second,
+           c.second.first,c.second.second);
+  }
+#endif
+
   void
   LocalObject::fwdcopy(Space& home) {
     ActorLink::cast(this)->prev(copy(home));
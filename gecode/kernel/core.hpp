@@ -1717,6 +1717,29 @@ namespace Gecode {
     SS_BRANCH  ///< %Space must be branched (at least one brancher left)
   };
 
+  /**
+   * \brief Policy for scheduling propagators of the same cost
+   *
+   * Propagators are always executed in order of their cost (see
+   * PropCost), the policy only defines the order among propagators
+   * of the same cost.
+   *
+   * \ingroup TaskActor
+   */
+  enum SchedulePolicy {
+    SP_FIFO, ///< First-in first-out (default)
+    SP_LIFO, ///< Last-in first-out
+    /**
+     * \brief Prefer propagators with high AFC
+     *
+     * A propagator is executed before all other propagators of the
+     * same cost, if its accumulated failure count is larger than the
+     * count of the propagator to be executed next. Otherwise, it is
+     * scheduled first-in first-out.
+     */
+    SP_AFC
+  };
+
   /**
    * \brief %Statistics for execution of status
    *
@@ -1725,6 +1748,13 @@ namespace Gecode {
   public:
     /// Number of propagator executions
     unsigned long long int propagate;
+    /**
+     * \brief Number of propagator executions that modified no variable
+     *
+     * Only maintained if %Gecode has been built with propagation
+     * statistics (\c GECODE_PROPAGATION_STATISTICS), otherwise zero.
+     */
+    unsigned long long int noop;
     /// Initialize
     StatusStatistics(void);
     /// Reset information
@@ -1741,6 +1771,10 @@ namespace Gecode {
    */
   class CloneStatistics {
   public:
+    /// Number of bytes of space memory used by clones (approximately)
+    unsigned long long int copied;
+    /// Number of actors copied
+    unsigned long long int actors;
     /// Initialize
     CloneStatistics(void);
     /// Reset information
@@ -1821,6 +1855,8 @@ namespace Gecode {
      * If equal to &bl, no brancher does exist.
      */
     Brancher* b_commit;
+    /// Policy for scheduling propagators of the same cost
+    SchedulePolicy sp;
     /// Find brancher with identity \a id
     Brancher* brancher(unsigned int id);
 
@@ -1874,6 +1910,10 @@ namespace Gecode {
         unsigned int n_sub;
         /// View trace information
         ViewTraceInfo vti;
+#ifdef GECODE_PROPAGATION_STATISTICS
+        /// Number of variable modifications
+        unsigned long long int n_mod;
+#endif
       } p;
       /// Data available only during copying
       struct {
@@ -1889,6 +1929,9 @@ namespace Gecode {
     } pc;
     /// Put propagator \a p into right queue
     void enqueue(Propagator* p);
+    /// Execute propagator \a p with modification event delta \a med
+    ExecStatus propagate(Propagator& p, const ModEventDelta& med,
+                         StatusStatistics& stat);
     /**
      * \name update, and dispose variables
      */
@@ -1942,8 +1985,9 @@ namespace Gecode {
      * Throws an exception of type SpaceNotCloned when the copy constructor
      * of the Space class is not invoked during cloning.
      *
+     * The statistics information \a stat is updated.
      */
-    GECODE_KERNEL_EXPORT Space* _clone(void);
+    GECODE_KERNEL_EXPORT Space* _clone(CloneStatistics& stat);
 
     /**
      * \brief Commit choice \a c for alternative \a a
@@ -2719,6 +2763,66 @@ namespace Gecode {
     GECODE_KERNEL_EXPORT void afc_unshare(void);
     //@}
 
+    /// \name Propagator scheduling
+    //@{
+    /**
+     * \brief %Set policy for scheduling propagators of the same cost to \a p
+     *
+     * The policy is inherited by clones of the space.
+     */
+    void schedule(SchedulePolicy p);
+    /// Return policy for scheduling propagators of the same cost
+    SchedulePolicy schedule(void) const;
+    //@}
+
+#ifdef GECODE_PROPAGATION_STATISTICS
+    /// \name Propagation statistics
+    //@{
+    /// Signature for function transmitting propagation statistics
+    typedef std::function<void(const char* name, unsigned int gid,
+                               unsigned long long int propagate,
+                               unsigned long long int noop)> SendPropagation;
+    /**
+     * \brief Transmit propagation statistics per propagator class and group
+     *
+     * Calls \a send once for each propagator class (with the
+     * implementation-defined \a name as returned by \c typeid) and
+     * propagator group with identifier \a gid. The number of executions
+     * \a propagate and of executions that modified no variable \a noop
+     * are accumulated over this space and all spaces sharing global
+     * propagator information with it (that is, its clones). Failed
+     * executions and executions that subsume a propagator are not counted.
+     *
+     * As workers of parallel search engines update the counts without
+     * synchronization, the numbers might be slightly too small.
+     */
+    GECODE_KERNEL_EXPORT
+    void propagation(SendPropagation send) const;
+    //@}
+#endif
+
+    /// \name Low-level support for heap chunk caching
+    //@{
+    /// %Set number of heap chunks cached for this space and its clones to \a n
+    void chunk_cache(unsigned int n);
+    /// Return number of heap chunks cached for this space and its clones
+    unsigned int chunk_cache(void) const;
+    /// Return heap chunk statistics for this space and its clones
+    Kernel::HeapChunkStatistics chunk_statistics(void) const;
+    /**
+     * \brief %Set whether clones allocate their first heap chunk to fit the original space
+     *
+     * If \a p is true, a clone of this space (or of any of its clones)
+     * allocates a first heap chunk that is large enough to hold the
+     * memory currently used by the original space. For large spaces
+     * this replaces many small heap chunk requests by a single one.
+     * The policy is shared by all spaces of a search engine.
+     */
+    void chunk_presize(bool p);
+    /// Return whether clones presize their first heap chunk
+    bool chunk_presize(void) const;
+    //@}
+
   protected:
     /**
      * \brief Class to iterate over propagators of a space
@@ -3315,11 +3419,11 @@ namespace Gecode {
   }
 
   forceinline Space*
-  Space::clone(CloneStatistics&) const {
+  Space::clone(CloneStatistics& stat) const {
     // Clone is only const for search engines. During cloning, several data
     // structures are updated (e.g. forwarding pointers), so we have to
     // cast away the constness.
-    return const_cast<Space*>(this)->_clone();
+    return const_cast<Space*>(this)->_clone(stat);
   }
 
   forceinline void
@@ -3354,6 +3458,31 @@ namespace Gecode {
     ssd.data().gpi.decay(d);
   }
 
+  forceinline void
+  Space::chunk_cache(unsigned int n) {
+    ssd.data().sm.pool_cache(n);
+  }
+
+  forceinline unsigned int
+  Space::chunk_cache(void) const {
+    return ssd.data().sm.pool_cache();
+  }
+
+  forceinline Kernel::HeapChunkStatistics
+  Space::chunk_statistics(void) const {
+    return ssd.data().sm.statistics();
+  }
+
+  forceinline void
+  Space::chunk_presize(bool p) {
+    ssd.data().sm.presize(p);
+  }
+
+  forceinline bool
+  Space::chunk_presize(void) const {
+    return ssd.data().sm.presize();
+  }
+
   forceinline size_t
   Actor::dispose(Space&) {
     return sizeof(*this);
@@ -3632,7 +3761,8 @@ namespace Gecode {
 
   forceinline double
   Propagator::afc(void) const {
-    return const_cast<Propagator&>(*this).gpi().afc;
+    return const_cast<Propagator&>(*this).gpi().afc
+      .load(std::memory_order_relaxed);
   }
 
 #ifdef GECODE_HAS_CBS
@@ -4158,11 +4288,60 @@ namespace Gecode {
   Space::enqueue(Propagator* p) {
     ActorLink::cast(p)->unlink();
     ActorLink* c = &pc.p.queue[p->cost(*this,p->u.med).ac];
-    c->tail(ActorLink::cast(p));
+    switch (sp) {
+    case SP_FIFO:
+      c->tail(ActorLink::cast(p));
+      break;
+    case SP_LIFO:
+      c->head(ActorLink::cast(p));
+      break;
+    case SP_AFC:
+      if ((c->next() != c) &&
+          (p->afc() > Propagator::cast(c->next())->afc()))
+        c->head(ActorLink::cast(p));
+      else
+        c->tail(ActorLink::cast(p));
+      break;
+    default:
+      GECODE_NEVER;
+    }
     if (c > pc.p.active)
       pc.p.active = c;
   }
 
+  forceinline void
+  Space::schedule(SchedulePolicy p) {
+    sp = p;
+  }
+
+  forceinline SchedulePolicy
+  Space::schedule(void) const {
+    return sp;
+  }
+
+  forceinline ExecStatus
+  Space::propagate(Propagator& p, const ModEventDelta& med,
+                   StatusStatistics& stat) {
+#ifdef GECODE_PROPAGATION_STATISTICS
+    unsigned long long int n_mod = pc.p.n_mod;
+    ExecStatus es = p.propagate(*this,med);
+    /*
+     * Failure and subsumption are not counted as no-ops, the propagator
+     * is still valid here as subsumed propagators are only freed later.
+     */
+    if ((es != ES_FAILED) && (es != ES_SUBSUMED_)) {
+      bool nop = (n_mod == pc.p.n_mod);
+      if (nop)
+        stat.noop++;
+      p.gpi().executed(typeid(p).name(),nop);
+    }
+    return es;
+#else
+    (void) stat;
+    return p.propagate(*this,med);
+#endif
+  }
+
   forceinline void
   Space::fail(void) {
     pc.p.active = &pc.p.queue[PropCost::AC_MAX+1]+1;
@@ -4439,6 +4618,9 @@ namespace Gecode {
   template<class VIC>
   forceinline void
   VarImp<VIC>::schedule(Space& home, PropCond pc1, PropCond pc2, ModEvent me) {
+#ifdef GECODE_PROPAGATION_STATISTICS
+    home.pc.p.n_mod++;
+#endif
     if (b.base == nullptr)
       return;
     ActorLink** begin = actor(pc1);
@@ -4864,7 +5046,7 @@ namespace Gecode {
 
   forceinline void
   StatusStatistics::reset(void) {
-    propagate = 0;
+    propagate = 0; noop = 0;
   }
   forceinline
   StatusStatistics::StatusStatistics(void) {
@@ -4873,6 +5055,7 @@ namespace Gecode {
   forceinline StatusStatistics&
   StatusStatistics::operator +=(const StatusStatistics& s) {
     propagate += s.propagate;
+    noop += s.noop;
     return *this;
   }
   forceinline StatusStatistics
@@ -4882,21 +5065,25 @@ namespace Gecode {
   }
 
   forceinline void
-  CloneStatistics::reset(void) {}
+  CloneStatistics::reset(void) {
+    copied = 0; actors = 0;
+  }
 
   forceinline
   CloneStatistics::CloneStatistics(void) {
     reset();
   }
-  forceinline CloneStatistics
-  CloneStatistics::operator +(const CloneStatistics&) {
-    CloneStatistics s;
-    return s;
-  }
   forceinline CloneStatistics&
-  CloneStatistics::operator +=(const CloneStatistics&) {
+  CloneStatistics::operator +=(const CloneStatistics& s) {
+    copied += s.copied;
+    actors += s.actors;
     return *this;
   }
+  forceinline CloneStatistics
+  CloneStatistics::operator +(const CloneStatistics& s) {
+    CloneStatistics t(s);
+    return t += *this;
+  }
 
   forceinline void
   CommitStatistics::reset(void) {}
@@ -35,7 +35,15 @@
 
 namespace Gecode { namespace Kernel {
 
-  /// Global propagator information
+  /**
+   * \brief Global propagator information
+   *
+   * The information is shared by all spaces that are copies of each
+   * other and hence is accessed concurrently by the workers of parallel
+   * search engines. All frequent operations (incrementing the failure
+   * count and allocating information) are lock-free. The mutex is only
+   * needed for the rare operations of adding a block and rescaling.
+   */
   class GPI {
   public:
     /// Class for storing propagator information
@@ -46,9 +54,21 @@ namespace Gecode { namespace Kernel {
       /// Group identifier
       unsigned int gid;
       /// The afc value
-      double afc;
+      std::atomic<double> afc;
       /// Initialize
       void init(unsigned int pid, unsigned int gid);
+      /// Multiply afc value by \a f
+      void scale(double f);
+#ifdef GECODE_PROPAGATION_STATISTICS
+      /// Class name of the propagator (nullptr if never executed)
+      std::atomic<const char*> name;
+      /// Number of executions
+      std::atomic<unsigned long long int> propagate;
+      /// Number of executions that modified no variable
+      std::atomic<unsigned long long int> noop;
+      /// Record execution of propagator with class name \a n
+      void executed(const char* n, bool noop);
+#endif
     };
   private:
     /// Block of propagator information
@@ -60,25 +80,29 @@ namespace Gecode { namespace Kernel {
       Info info[n_info];
       /// Next block
       Block* next;
-      /// Number of free blocks
-      int free;
+      /// Number of free entries (might become negative when exhausted)
+      std::atomic<int> free;
       /// Initialize
       Block(void);
       /// Rescale used afc values in entries
       void rescale(void);
     };
     /// The current block
-    Block* b;
+    std::atomic<Block*> b;
     /// The inverse decay factor
-    double invd;
+    std::atomic<double> invd;
     /// Next free propagator id
     std::atomic<unsigned int> npid;
     /// Whether to unshare
-    bool us;
+    std::atomic<bool> us;
     /// The first block
     Block fst;
-    /// Mutex to synchronize globally shared access
+    /// Mutex to synchronize adding blocks and rescaling
     GECODE_KERNEL_EXPORT static Support::Mutex m;
+    /// Allocate uninitialized info entry
+    Info* allocate(void);
+    /// Rescale all afc values (as \a c has exceeded the limit)
+    void rescale(Info& c);
   public:
     /// Initialize
     GPI(void);
@@ -94,6 +118,11 @@ namespace Gecode { namespace Kernel {
     Info* allocate(unsigned int gid);
     /// Return next free propagator id
     unsigned int pid(void) const;
+#ifdef GECODE_PROPAGATION_STATISTICS
+    /// Call \a f for all executed propagator information
+    template<class Fun>
+    void executed(Fun f) const;
+#endif
     /// Provide access to unshare info and set to true
     bool unshare(void);
     /// Delete
@@ -103,18 +132,51 @@ namespace Gecode { namespace Kernel {
 
   forceinline void
   GPI::Info::init(unsigned int pid0, unsigned int gid0) {
-    pid=pid0; gid=gid0; afc=1.0;
+    pid=pid0; gid=gid0; afc.store(1.0, std::memory_order_relaxed);
+#ifdef GECODE_PROPAGATION_STATISTICS
+    name.store(nullptr, std::memory_order_relaxed);
+    propagate.store(0ULL, std::memory_order_relaxed);
+    noop.store(0ULL, std::memory_order_relaxed);
+#endif
   }
 
+  forceinline void
+  GPI::Info::scale(double f) {
+    double o = afc.load(std::memory_order_relaxed);
+    while (!afc.compare_exchange_weak(o, o * f, std::memory_order_relaxed))
+      ;
+  }
+
+#ifdef GECODE_PROPAGATION_STATISTICS
+  forceinline void
+  GPI::Info::executed(const char* n, bool nop) {
+    /*
+     * The counts are only statistics: increments by concurrent workers
+     * might get lost but no expensive read-modify-write is needed.
+     */
+    if (name.load(std::memory_order_relaxed) == nullptr)
+      name.store(n, std::memory_order_relaxed);
+    propagate.store(propagate.load(std::memory_order_relaxed) + 1ULL,
+                    std::memory_order_relaxed);
+    if (nop)
+      noop.store(noop.load(std::memory_order_relaxed) + 1ULL,
+                 std::memory_order_relaxed);
+  }
+#endif
+
 
   forceinline
   GPI::Block::Block(void)
-    : next(nullptr), free(n_info) {}
+    : next(nullptr), free(n_info) {
+    for (int i=0; i < n_info; i++)
+      info[i].init(0U,0U);
+  }
 
   forceinline void
   GPI::Block::rescale(void) {
-    for (int i=free; i < n_info; i++)
-      info[i].afc *= Kernel::Config::rescale;
+    for (int i=std::max(free.load(std::memory_order_relaxed),0);
+         i < n_info; i++)
+      info[i].scale(Kernel::Config::rescale);
   }
 
 
@@ -124,21 +186,30 @@ namespace Gecode { namespace Kernel {
 
   forceinline void
   GPI::fail(Info& c) {
+    double d = invd.load(std::memory_order_relaxed);
+    double o = c.afc.load(std::memory_order_relaxed);
+    double n;
+    do {
+      n = d * (o + 1.0);
+    } while (!c.afc.compare_exchange_weak(o, n, std::memory_order_relaxed));
+    if (n > Kernel::Config::rescale_limit)
+      rescale(c);
+  }
+
+  forceinline void
+  GPI::rescale(Info& c) {
     m.acquire();
-    c.afc = invd * (c.afc + 1.0);
-    if (c.afc > Kernel::Config::rescale_limit)
-      for (Block* i = b; i != nullptr; i = i->next)
+    // Another thread might have rescaled in the meantime
+    if (c.afc.load(std::memory_order_relaxed) > Kernel::Config::rescale_limit)
+      for (Block* i = b.load(std::memory_order_acquire);
+           i != nullptr; i = i->next)
         i->rescale();
     m.release();
   }
 
   forceinline double
   GPI::decay(void) const {
-    double d;
-    const_cast<GPI&>(*this).m.acquire();
-    d = 1.0 / invd;
-    const_cast<GPI&>(*this).m.release();
-    return d;
+    return 1.0 / invd.load(std::memory_order_relaxed);
   }
 
   forceinline unsigned int
@@ -148,51 +219,62 @@ namespace Gecode { namespace Kernel {
 
   forceinline bool
   GPI::unshare(void) {
-    bool u;
-    m.acquire();
-    u = us; us = true;
-    m.release();
-    return u;
+    return us.exchange(true, std::memory_order_acq_rel);
   }
 
   forceinline void
   GPI::decay(double d) {
-    m.acquire();
-    invd = 1.0 / d;
-    m.release();
+    invd.store(1.0 / d, std::memory_order_relaxed);
   }
 
   forceinline GPI::Info*
-  GPI::allocate(unsigned int p, unsigned int gid) {
-    Info* c;
-    m.acquire();
-    if (b->free == 0) {
-      Block* n = new Block;
-      n->next = b; b = n;
+  GPI::allocate(void) {
+    while (true) {
+      Block* c = b.load(std::memory_order_acquire);
+      int f = c->free.fetch_sub(1, std::memory_order_relaxed) - 1;
+      if (f >= 0)
+        return &c->info[f];
+      // Block is exhausted, only one thread adds a new block
+      m.acquire();
+      if (b.load(std::memory_order_relaxed) == c) {
+        Block* n = new Block;
+        n->next = c;
+        b.store(n, std::memory_order_release);
+      }
+      m.release();
     }
-    c = &b->info[--b->free];
-    m.release();
+  }
+
+  forceinline GPI::Info*
+  GPI::allocate(unsigned int p, unsigned int gid) {
+    Info* c = allocate();
     c->init(p,gid);
     return c;
   }
 
   forceinline GPI::Info*
   GPI::allocate(unsigned int gid) {
-    Info* c;
-    m.acquire();
-    if (b->free == 0) {
-      Block* n = new Block;
-      n->next = b; b = n;
-    }
-    c = &b->info[--b->free];
-    m.release();
+    Info* c = allocate();
     c->init(npid.fetch_add(1, std::memory_order_seq_cst),gid);
     return c;
   }
 
+#ifdef GECODE_PROPAGATION_STATISTICS
+  template<class Fun>
+  forceinline void
+  GPI::executed(Fun f) const {
+    for (const Block* c = b.load(std::memory_order_acquire);
+         c != nullptr; c = c->next)
+      for (int i=std::max(c->free.load(std::memory_order_relaxed),0);
+           i < Block::n_info; i++)
+        if (c->info[i].name.load(std::memory_order_relaxed) != nullptr)
+          f(c->info[i]);
+  }
+#endif
+
   forceinline
   GPI::~GPI(void) {
-    Block* n = b;
+    Block* n = b.load(std::memory_order_relaxed);
     while (n != &fst) {
       Block* d = n;
       n = n->next;
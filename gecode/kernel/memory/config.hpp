@@ -50,8 +50,18 @@ namespace Gecode { namespace Kernel {
   namespace MemoryConfig {
     /**
      * \brief How many heap chunks should be cached at most
+     *
+     * This is the default for the pool of heap chunks shared by a space
+     * and its clones, it can be changed by Space::chunk_cache().
      */
     const unsigned int n_hc_cache = 4*4;
+    /**
+     * \brief How many heap chunks should be cached at most per thread
+     *
+     * This is the default, it can be changed by
+     * SharedMemory::local_cache().
+     */
+    const unsigned int n_hc_cache_local = 4;
 
     /**
      * \brief Minimal size of a heap chunk requested from the OS
@@ -82,6 +92,15 @@ namespace Gecode { namespace Kernel {
      * for the clone is halfed.
      */
     const int hcsz_dec_ratio = 8;
+    /**
+     * \brief Maximal size of the first heap chunk of a clone
+     *
+     * If presizing is enabled (see Space::chunk_presize()), the first
+     * heap chunk of a clone is allocated such that it can hold the
+     * memory in use by the original space, but not more than
+     * \a hcsz_presize_max.
+     */
+    const size_t hcsz_presize_max = 64 * 1024 * 1024;
 
     /**
      * \brief Unit size for free lists
@@ -35,9 +35,12 @@
 
 namespace Gecode { namespace Kernel {
 
-  Support::Mutex& SharedMemory::m(void) {
-    static Support::Mutex _m;
-    return _m;
+  std::atomic<unsigned int>
+  SharedMemory::n_hc_local(MemoryConfig::n_hc_cache_local);
+
+  SharedMemory::Cache& SharedMemory::cache(void) {
+    thread_local static SharedMemory::Cache _c;
+    return _c;
   }
 
   void
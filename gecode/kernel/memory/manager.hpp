@@ -39,6 +39,7 @@
  */
 
 #include <memory>
+#include <atomic>
 
 namespace Gecode { namespace Kernel {
 
@@ -58,18 +59,65 @@ namespace Gecode { namespace Kernel {
     double area[1];
   };
 
-  /// Shared object for several memory areas
+  /// %Statistics for requests of heap chunks
+  class HeapChunkStatistics {
+  public:
+    /// Number of requests served from the cache of the requesting thread
+    unsigned long int local;
+    /// Number of requests served from the shared pool
+    unsigned long int pool;
+    /// Number of requests that required allocation from the heap
+    unsigned long int miss;
+    /// Initialize
+    HeapChunkStatistics(void);
+  };
+
+  /**
+   * \brief Shared object for several memory areas
+   *
+   * Heap chunks are cached at two levels: each thread has a small
+   * cache that is accessed without synchronization and only if that
+   * cache is empty (or full when releasing a chunk), a pool shared by
+   * a space and its clones is accessed under a mutex.
+   */
   class SharedMemory {
+  public:
+    /// Cache of heap chunks for a single thread
+    class Cache {
+    public:
+      /// How many heap chunks are available for caching
+      unsigned int n_hc;
+      /// A list of cached heap chunks
+      HeapChunk* hc;
+      /// Initialize
+      Cache(void);
+      /// Release all cached heap chunks
+      ~Cache(void);
+    };
   private:
     /// The components for shared heap memory
     struct {
       /// How many heap chunks are available for caching
       unsigned int n_hc;
+      /// How many heap chunks can be cached at most
+      unsigned int n_hc_max;
       /// A list of cached heap chunks
       HeapChunk* hc;
     } heap;
-    /// A mutex for access
-    GECODE_KERNEL_EXPORT static Support::Mutex& m(void);
+    /// A mutex for access to the shared pool
+    Support::Mutex m;
+    /// Number of requests served from a thread cache
+    std::atomic<unsigned long int> n_local;
+    /// Number of requests served from the pool
+    std::atomic<unsigned long int> n_pool;
+    /// Number of requests served from the heap
+    std::atomic<unsigned long int> n_miss;
+    /// Whether to presize the first heap chunk of a clone
+    std::atomic<bool> _presize;
+    /// How many heap chunks can be cached per thread at most
+    GECODE_KERNEL_EXPORT static std::atomic<unsigned int> n_hc_local;
+    /// Return cache for current thread
+    GECODE_KERNEL_EXPORT static Cache& cache(void);
   public:
     /// Initialize
     SharedMemory(void);
@@ -82,6 +130,26 @@ namespace Gecode { namespace Kernel {
     /// Free heap chunk (or cache for later)
     void free(HeapChunk* hc);
     //@}
+    /// \name Cache configuration and statistics
+    //@{
+    /// Set number of heap chunks cached in the shared pool to at most \a n
+    void pool_cache(unsigned int n);
+    /// Return number of heap chunks cached in the shared pool at most
+    unsigned int pool_cache(void);
+    /// Set number of heap chunks cached per thread to at most \a n
+    static void local_cache(unsigned int n);
+    /// Return number of heap chunks cached per thread at most
+    static unsigned int local_cache(void);
+    /// Return statistics
+    HeapChunkStatistics statistics(void) const;
+    //@}
+    /// \name Heap chunk sizing policy
+    //@{
+    /// Set whether the first heap chunk of a clone is presized
+    void presize(bool p);
+    /// Return whether the first heap chunk of a clone is presized
+    bool presize(void) const;
+    //@}
   };
 
 
@@ -147,6 +215,8 @@ namespace Gecode { namespace Kernel {
     void* alloc(SharedMemory& sm, size_t s);
     /// Get the memory area for subscriptions
     void* subscriptions(void) const;
+    /// Return memory in use (approximately)
+    size_t used(void) const;
 
   private:
     /// Start of free lists
@@ -183,8 +253,26 @@ namespace Gecode { namespace Kernel {
    */
 
   forceinline
-  SharedMemory::SharedMemory(void) {
+  HeapChunkStatistics::HeapChunkStatistics(void)
+    : local(0UL), pool(0UL), miss(0UL) {}
+
+  forceinline
+  SharedMemory::Cache::Cache(void)
+    : n_hc(0U), hc(nullptr) {}
+  forceinline
+  SharedMemory::Cache::~Cache(void) {
+    while (hc != nullptr) {
+      HeapChunk* c = hc;
+      hc = static_cast<HeapChunk*>(c->next);
+      Gecode::heap.rfree(c);
+    }
+  }
+
+  forceinline
+  SharedMemory::SharedMemory(void)
+    : n_local(0UL), n_pool(0UL), n_miss(0UL), _presize(false) {
     heap.n_hc = 0;
+    heap.n_hc_max = MemoryConfig::n_hc_cache;
     heap.hc = nullptr;
   }
   forceinline
@@ -198,8 +286,25 @@ namespace Gecode { namespace Kernel {
 
   forceinline HeapChunk*
   SharedMemory::alloc(size_t s, size_t l) {
+    // Try the cache of the current thread first
+    {
+      Cache& c = cache();
+      while ((c.hc != nullptr) && (c.hc->size < l)) {
+        c.n_hc--;
+        HeapChunk* hc = c.hc;
+        c.hc = static_cast<HeapChunk*>(hc->next);
+        Gecode::heap.rfree(hc);
+      }
+      if (c.hc != nullptr) {
+        c.n_hc--;
+        HeapChunk* hc = c.hc;
+        c.hc = static_cast<HeapChunk*>(hc->next);
+        n_local.fetch_add(1UL, std::memory_order_relaxed);
+        return hc;
+      }
+    }
     // To protect from exceptions from heap.ralloc()
-    Support::Lock guard(m());
+    Support::Lock guard(m);
     while ((heap.hc != nullptr) && (heap.hc->size < l)) {
       heap.n_hc--;
       HeapChunk* hc = heap.hc;
@@ -211,17 +316,27 @@ namespace Gecode { namespace Kernel {
       assert(heap.n_hc == 0);
       hc = static_cast<HeapChunk*>(Gecode::heap.ralloc(s));
       hc->size = s;
+      n_miss.fetch_add(1UL, std::memory_order_relaxed);
     } else {
       heap.n_hc--;
       hc = heap.hc;
       heap.hc = static_cast<HeapChunk*>(hc->next);
+      n_pool.fetch_add(1UL, std::memory_order_relaxed);
     }
     return hc;
   }
   forceinline void
   SharedMemory::free(HeapChunk* hc) {
-    Support::Lock guard(m());
-    if (heap.n_hc == MemoryConfig::n_hc_cache) {
+    {
+      Cache& c = cache();
+      if (c.n_hc < n_hc_local.load(std::memory_order_relaxed)) {
+        c.n_hc++;
+        hc->next = c.hc; c.hc = hc;
+        return;
+      }
+    }
+    Support::Lock guard(m);
+    if (heap.n_hc >= heap.n_hc_max) {
       Gecode::heap.rfree(hc);
     } else {
       heap.n_hc++;
@@ -229,6 +344,55 @@ namespace Gecode { namespace Kernel {
     }
   }
 
+  forceinline void
+  SharedMemory::pool_cache(unsigned int n) {
+    Support::Lock guard(m);
+    heap.n_hc_max = n;
+    while (heap.n_hc > n) {
+      heap.n_hc--;
+      HeapChunk* hc = heap.hc;
+      heap.hc = static_cast<HeapChunk*>(hc->next);
+      Gecode::heap.rfree(hc);
+    }
+  }
+  forceinline unsigned int
+  SharedMemory::pool_cache(void) {
+    Support::Lock guard(m);
+    return heap.n_hc_max;
+  }
+  forceinline void
+  SharedMemory::local_cache(unsigned int n) {
+    n_hc_local.store(n, std::memory_order_relaxed);
+    // Caches of other threads adapt when chunks are released
+    Cache& c = cache();
+    while (c.n_hc > n) {
+      c.n_hc--;
+      HeapChunk* hc = c.hc;
+      c.hc = static_cast<HeapChunk*>(hc->next);
+      Gecode::heap.rfree(hc);
+    }
+  }
+  forceinline unsigned int
+  SharedMemory::local_cache(void) {
+    return n_hc_local.load(std::memory_order_relaxed);
+  }
+  forceinline void
+  SharedMemory::presize(bool p) {
+    _presize.store(p, std::memory_order_relaxed);
+  }
+  forceinline bool
+  SharedMemory::presize(void) const {
+    return _presize.load(std::memory_order_relaxed);
+  }
+  forceinline HeapChunkStatistics
+  SharedMemory::statistics(void) const {
+    HeapChunkStatistics hcs;
+    hcs.local = n_local.load(std::memory_order_relaxed);
+    hcs.pool = n_pool.load(std::memory_order_relaxed);
+    hcs.miss = n_miss.load(std::memory_order_relaxed);
+    return hcs;
+  }
+
 
 }}
 
@@ -300,6 +464,11 @@ namespace Gecode { namespace Kernel {
     return &cur_hc->area[0];
   }
 
+  forceinline size_t
+  MemoryManager::used(void) const {
+    return requested - lsz;
+  }
+
   forceinline void
   MemoryManager::alloc_fill(SharedMemory& sm, size_t sz, bool first) {
     // Adjust current heap chunk size
@@ -348,11 +517,20 @@ namespace Gecode { namespace Kernel {
                                size_t s_sub)
     : cur_hcsz(mm.cur_hcsz), requested(0), slack(nullptr) {
     MemoryConfig::align(s_sub);
-    if ((mm.requested < MemoryConfig::hcsz_dec_ratio*mm.cur_hcsz) &&
-        (cur_hcsz > MemoryConfig::hcsz_min) &&
-        (s_sub*2 < cur_hcsz))
-      cur_hcsz >>= 1;
-    alloc_fill(sm,cur_hcsz+s_sub,true);
+    // Memory in use by the original space
+    size_t used = mm.used();
+    if (sm.presize() && (used > cur_hcsz)) {
+      // Try to fit the entire clone into a single heap chunk
+      size_t sz = std::min(used, MemoryConfig::hcsz_presize_max);
+      MemoryConfig::align(sz);
+      alloc_fill(sm,sz+s_sub,true);
+    } else {
+      if ((mm.requested < MemoryConfig::hcsz_dec_ratio*mm.cur_hcsz) &&
+          (cur_hcsz > MemoryConfig::hcsz_min) &&
+          (s_sub*2 < cur_hcsz))
+        cur_hcsz >>= 1;
+      alloc_fill(sm,cur_hcsz+s_sub,true);
+    }
     // Skip the memory area at the beginning for subscriptions
     lsz   -= s_sub;
     start += s_sub;
@@ -117,11 +117,19 @@ namespace Gecode { namespace Search {
     const unsigned int c_d = 8;
     /// Create a clone during recomputation if distance is greater than \a a_d (adaptive distance)
     const unsigned int a_d = 2;
+    /// Whether to adapt the commit distance online
+    const bool c_d_adaptive = false;
+    /// Maximal commit distance for adaptive commit distance
+    const unsigned int c_d_max = 64;
+    /// Number of recomputations before an adaptive commit distance is reconsidered
+    const unsigned int c_d_sample = 32;
 
     /// Minimal number of open nodes for stealing
     const unsigned int steal_limit = 3;
     /// Initial delay in milliseconds for all but first worker thread
     const unsigned int initial_delay = 5;
+    /// Maximal exponent for back-off of idle workers (yields are \f$2^b\f$)
+    const unsigned int steal_backoff = 6;
 
     /// Default discrepancy limit for LDS
     const unsigned int d_l = 5;
@@ -146,9 +154,13 @@ namespace Gecode { namespace Search {
 
   /**
    * \brief %Search engine statistics
+   *
+   * The clone statistics count the memory and the actors of the clones
+   * created by the search engine while exploring.
+   *
    * \ingroup TaskModelSearch
    */
-  class Statistics : public StatusStatistics {
+  class Statistics : public StatusStatistics, public CloneStatistics {
   public:
     /// Number of failed nodes in search tree
     unsigned long long int fail;
@@ -160,6 +172,14 @@ namespace Gecode { namespace Search {
     unsigned long int restart;
     /// Number of no-goods posted
     unsigned long int nogood;
+    /// Number of successful work steals (parallel engines)
+    unsigned long int steal_success;
+    /// Number of unsuccessful work steal attempts (parallel engines)
+    unsigned long int steal_fail;
+    /// Number of increases of the adaptive commit distance
+    unsigned long int c_d_inc;
+    /// Number of decreases of the adaptive commit distance
+    unsigned long int c_d_dec;
     /// Initialize
     Statistics(void);
     /// Reset
@@ -729,6 +749,11 @@ namespace Gecode { namespace Search {
      *    is created (approximately in the middle of the path) to speed up
      *    future recomputation. Note that small values of \a a_d can increase
      *    the memory consumption considerably.
+     *  - \a c_d_adaptive for adapting the commit distance: if true, the
+     *    engine measures the time for cloning and for recomputation
+     *    (commit and propagation) online and adjusts the commit distance
+     *    (starting from \a c_d) separately for bands of search tree depths.
+     *    The adjustments are recorded in the statistics.
      *
      * Full copying corresponds to a maximal recomputation distance
      * \a c_d of 1.
@@ -758,6 +783,8 @@ namespace Gecode { namespace Search {
       unsigned int c_d;
       /// Create a clone during recomputation if distance is greater than \a a_d (adaptive distance)
       unsigned int a_d;
+      /// Whether to adapt the commit distance (starting from \a c_d) online
+      bool c_d_adaptive;
       /// Discrepancy limit (for LDS)
       unsigned int d_l;
       /// Number of assets (engines) in a portfolio
@@ -1266,6 +1293,13 @@ namespace Gecode {
    * by the options \a o. The engine supports parallel execution of
    * assets by using the number of threads as defined by the options.
    *
+   * For best solution search, the assets share their incumbent: whenever
+   * an asset finds a better solution, all other assets are constrained
+   * by it before they continue. An asset that finds a solution that is
+   * not better than the incumbent continues with the incumbent as bound.
+   * No-goods are not exchanged between assets, as they refer to the
+   * branchers of the asset that has recorded them.
+   *
    * The class \a T can implement member functions
    * \code virtual bool master(const MetaInfo& mi) \endcode
    * and
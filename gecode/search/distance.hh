@@ -0,0 +1,195 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.dev
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef GECODE_SEARCH_DISTANCE_HH
+#define GECODE_SEARCH_DISTANCE_HH
+
+#include <cmath>
+#include <algorithm>
+
+#include <gecode/search.hh>
+
+namespace Gecode { namespace Search {
+
+  /**
+   * \brief Adaptive commit distance
+   *
+   * Estimates the time needed for a clone and for recomputing a single
+   * step (commit and propagation) online and adjusts the commit
+   * distance such that the cost for cloning per node and the expected
+   * cost for recomputation per node are balanced. With a commit distance
+   * \f$k\f$, a clone time \f$c\f$, and a time \f$r\f$ per recomputation
+   * step, cloning costs \f$c/k\f$ per node and recomputation after
+   * failure about \f$r\cdot k/4\f$ per node, hence the best commit
+   * distance is about \f$2\sqrt{c/r}\f$.
+   *
+   * As clone and propagation cost typically change with the depth in the
+   * search tree, the commit distance is maintained separately for bands
+   * of depths (with doubling width).
+   *
+   * If not enabled by the search options, the commit distance is just
+   * the commit distance from the options.
+   */
+  class AdaptiveDistance {
+  protected:
+    /// Information for a band of depths
+    class Band {
+    public:
+      /// Current commit distance
+      unsigned int c_d;
+      /// Estimated time for a clone (negative if unknown)
+      double clone;
+      /// Estimated time for a single recomputation step (negative if unknown)
+      double step;
+      /// Number of recomputations since last adjustment
+      unsigned int n;
+    };
+    /// Number of depth bands
+    static const unsigned int n_bands = 6;
+    /// Depth where the second band starts
+    static const unsigned int band_min = 8;
+    /// The bands
+    Band b[n_bands];
+    /// Whether the commit distance is adapted
+    bool adaptive;
+    /// Timer for measuring recomputation
+    Support::Timer t;
+    /// Return band for depth \a l
+    static unsigned int band(unsigned int l);
+    /// Update estimate \a e by sample \a s
+    static void estimate(double& e, double s);
+  public:
+    /// Initialize from options \a o
+    AdaptiveDistance(const Options& o);
+    /// Test whether the commit distance is adapted
+    explicit operator bool(void) const;
+    /// Return commit distance at depth \a l
+    unsigned int c_d(unsigned int l) const;
+    /// Return clone of space \a s at depth \a l and record it in \a stat
+    Space* clone(Statistics& stat, Space* s, unsigned int l);
+    /// Start recomputation
+    void start(void);
+    /**
+     * \brief Finish recomputation of \a d steps of space \a s at depth \a l
+     *
+     * Performs propagation of \a s (so that its cost is included) and
+     * possibly adjusts the commit distance. Adjustments are recorded in
+     * \a stat.
+     */
+    void stop(Statistics& stat, Space& s, unsigned int l, unsigned int d);
+  };
+
+
+  forceinline unsigned int
+  AdaptiveDistance::band(unsigned int l) {
+    unsigned int i = 0;
+    for (l /= band_min; (l > 0) && (i < n_bands-1); l >>= 1)
+      i++;
+    return i;
+  }
+
+  forceinline void
+  AdaptiveDistance::estimate(double& e, double s) {
+    // Exponential moving average
+    if (e < 0.0)
+      e = s;
+    else
+      e += (s - e) / 8.0;
+  }
+
+  forceinline
+  AdaptiveDistance::AdaptiveDistance(const Options& o)
+    : adaptive(o.c_d_adaptive) {
+    for (unsigned int i=0; i<n_bands; i++) {
+      b[i].c_d = std::max(o.c_d,1U);
+      b[i].clone = b[i].step = -1.0;
+      b[i].n = 0U;
+    }
+  }
+
+  forceinline
+  AdaptiveDistance::operator bool(void) const {
+    return adaptive;
+  }
+
+  forceinline unsigned int
+  AdaptiveDistance::c_d(unsigned int l) const {
+    return adaptive ? b[band(l)].c_d : b[0].c_d;
+  }
+
+  forceinline Space*
+  AdaptiveDistance::clone(Statistics& stat, Space* s, unsigned int l) {
+    if (!adaptive)
+      return s->clone(stat);
+    Support::Timer c;
+    c.start();
+    Space* r = s->clone(stat);
+    estimate(b[band(l)].clone,c.stop());
+    return r;
+  }
+
+  forceinline void
+  AdaptiveDistance::start(void) {
+    t.start();
+  }
+
+  forceinline void
+  AdaptiveDistance::stop(Statistics& stat, Space& s, unsigned int l,
+                         unsigned int d) {
+    // Recomputation is batched, so include the propagation
+    (void) s.status(stat);
+    Band& c = b[band(l)];
+    // The time includes one clone
+    double r = t.stop() - std::max(c.clone,0.0);
+    estimate(c.step,std::max(r,0.0) / std::max(d,1U));
+    if ((++c.n < Config::c_d_sample) || (c.clone < 0.0))
+      return;
+    c.n = 0U;
+    // Avoid division by zero for very cheap recomputation
+    double k = 2.0 * std::sqrt(c.clone / std::max(c.step,1e-6));
+    // Move halfway towards the best commit distance
+    unsigned int n = static_cast<unsigned int>
+      (std::lround((c.c_d + std::min(k,double(Config::c_d_max))) / 2.0));
+    n = std::min(std::max(n,1U),Config::c_d_max);
+    if (n > c.c_d)
+      stat.c_d_inc++;
+    else if (n < c.c_d)
+      stat.c_d_dec++;
+    c.c_d = n;
+  }
+
+}}
+
+#endif
+
+// STATISTICS: search-other
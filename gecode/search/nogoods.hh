@@ -68,6 +68,15 @@ namespace Gecode { namespace Search {
     NGL* root;
     /// Number of no-good literals with subscriptions
     unsigned int n;
+    /**
+     * \brief Add literals for edges \a s to \a n of path \a p after \a c
+     *
+     * Counts the no-goods in \a n_nogood and returns whether there
+     * is any no-good to be posted.
+     */
+    template<class Path>
+    static bool literals(Space& home, const Path& p, int s, int n,
+                         NGL* c, unsigned long int& n_nogood);
     /// Constructor for creation
     NoGoodsProp(Space& home, NGL* root);
     /// Constructor for cloning \a p
@@ -84,6 +93,15 @@ namespace Gecode { namespace Search {
     /// Post propagator for path \a p
     template<class Path>
     static ExecStatus post(Space& home, const Path& p);
+    /**
+     * \brief Post propagator for path \a p below a prefix
+     *
+     * The path \a p starts at a node that is reached from the root by
+     * the \a n_pre choices and alternatives archived in \a pre.
+     */
+    template<class Path>
+    static ExecStatus post(Space& home, const Path& p,
+                           Archive& pre, unsigned int n_pre);
     /// Delete propagator and return its size
     virtual size_t dispose(Space& home);
   };
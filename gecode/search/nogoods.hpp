@@ -135,10 +135,71 @@ namespace Gecode { namespace Search {
     assert((n-s > 1) ||
            ((n-s == 1) && (c != &nn)));
 
+    // Create literals
+    if (!literals(home,p,s,n,c,n_nogood))
+      return ES_OK;
+
+    const_cast<Path&>(p).ng(n_nogood);
+
+    (void) new (home) NoGoodsProp(home,nn.next());
+    return ES_OK;
+  }
+
+  template<class Path>
+  forceinline ExecStatus
+  NoGoodsProp::post(Space& home, const Path& p,
+                    Archive& pre, unsigned int n_pre) {
+    int n = std::min(p.ds.entries(),static_cast<int>(p.ngdl()));
+
+    unsigned long int n_nogood = 0;
+
+    // Eliminate the alternatives which are not no-goods at the end
+    while ((n > 0) && (p.ds[n-1].truealt() == 0U))
+      n--;
+
+    if (n == 0)
+      return ES_OK;
+
+    // A sentinel element
+    NoNGL nn;
+    // Current no-good literal
+    NGL* c = &nn;
+
+    // The prefix is a conjunction of subtree literals
+    for (unsigned int i=0U; i<n_pre; i++) {
+      const Choice* ch;
+      try {
+        ch = home.choice(pre);
+      } catch (SpaceNoBrancher&) {
+        // The brancher has been deleted in the meantime
+        return ES_OK;
+      }
+      unsigned int a; pre >> a;
+      NGL* l = home.ngl(*ch,a);
+      delete ch;
+      // Does the brancher support no-good literals?
+      if (l == nullptr)
+        return home.failed() ? ES_FAILED : ES_OK;
+      c = c->add(l,false);
+    }
+
+    // Create literals
+    if (!literals(home,p,0,n,c,n_nogood))
+      return ES_OK;
+
+    const_cast<Path&>(p).ng(n_nogood);
+
+    (void) new (home) NoGoodsProp(home,nn.next());
+    return ES_OK;
+  }
+
+  template<class Path>
+  forceinline bool
+  NoGoodsProp::literals(Space& home, const Path& p, int s, int n,
+                        NGL* c, unsigned long int& n_nogood) {
     // Remember the last leaf
     NGL* ll = nullptr;
 
-    // Create literals
     for (int i=s; i<n; i++) {
       // Add leaves
       for (unsigned int a=0U; a<p.ds[i].truealt(); a++) {
@@ -146,9 +207,9 @@ namespace Gecode { namespace Search {
         if (l == nullptr) {
           // The brancher does not support no-goods
           if (ll == nullptr)
-            return ES_OK;
+            return false;
           ll->next(nullptr);
-          break;
+          return true;
         }
         c = c->add(l,true); ll = c;
         n_nogood++;
@@ -159,16 +220,12 @@ namespace Gecode { namespace Search {
       } else if (!p.ds[i].rightmost()) {
         // The brancher does not support no-goods
         if (ll == nullptr)
-          return ES_OK;
+          return false;
         ll->next(nullptr);
-        break;
+        return true;
       }
     }
-
-    const_cast<Path&>(p).ng(n_nogood);
-
-    (void) new (home) NoGoodsProp(home,nn.next());
-    return ES_OK;
+    return true;
   }
 
 }}
@@ -38,6 +38,7 @@ namespace Gecode { namespace Search {
     : clone(Config::clone),
       threads(Config::threads),
       c_d(Config::c_d), a_d(Config::a_d),
+      c_d_adaptive(Config::c_d_adaptive),
       d_l(Config::d_l),
       assets(0), slice(Config::slice), nogoods_limit(0),
       stop(nullptr), cutoff(nullptr), tracer(nullptr) {}
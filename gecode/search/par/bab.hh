@@ -41,6 +41,7 @@ namespace Gecode { namespace Search { namespace Par {
   /// %Parallel branch-and-bound engine
   template<class Tracer>
   class BAB : public Engine<Tracer> {
+    friend class WorkerNoGoods<BAB>;
   protected:
     using Engine<Tracer>::idle;
     using Engine<Tracer>::busy;
@@ -76,6 +77,10 @@ namespace Gecode { namespace Search { namespace Par {
       using Engine<Tracer>::Worker::start;
       using Engine<Tracer>::Worker::tracer;
       using Engine<Tracer>::Worker::stop;
+      using Engine<Tracer>::Worker::victim;
+      using Engine<Tracer>::Worker::stolen;
+      using Engine<Tracer>::Worker::backoff;
+      using Engine<Tracer>::Worker::bo;
       /// Number of entries not yet constrained to be better
       int mark;
       /// Best solution found so far
@@ -98,6 +103,8 @@ namespace Gecode { namespace Search { namespace Par {
     };
     /// Array of worker references
     Worker** _worker;
+    /// No-goods of all workers
+    WorkerNoGoods<BAB> ngs;
     /// Best solution so far
     Space* best;
   public:
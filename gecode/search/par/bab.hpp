@@ -62,6 +62,7 @@ namespace Gecode { namespace Search { namespace Par {
     d = 0;
     mark = 0;
     idle = false;
+    bo = 0U;
     if ((s == nullptr) || (s->status(*this) == SS_FAILED)) {
       delete s;
       cur = nullptr;
@@ -83,7 +84,7 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Tracer>
   forceinline
   BAB<Tracer>::BAB(Space* s, const Options& o)
-    : Engine<Tracer>(o), best(nullptr) {
+    : Engine<Tracer>(o), ngs(*this), best(nullptr) {
     WrapTraceRecorder::engine(o.tracer, SearchTracer::EngineType::DFS,
                               workers());
     // Create workers
@@ -151,15 +152,18 @@ namespace Gecode { namespace Search { namespace Par {
   forceinline void
   BAB<Tracer>::Worker::find(void) {
     // Try to find new work (even if there is none)
-    for (unsigned int i=0U; i<engine().workers(); i++) {
+    unsigned int n = engine().workers();
+    unsigned int v = victim(n);
+    for (unsigned int i=0U; i<n; i++) {
       unsigned long int r_d = 0ul;
-      typename Engine<Tracer>::Worker* wi = engine().worker(i);
-      if (Space* s = wi->steal(r_d,wi->tracer,tracer)) {
+      typename Engine<Tracer>::Worker* wi = engine().worker((v+i) % n);
+      if (wi == this)
+        continue;
+      if (Space* s = wi->steal(r_d,wi->tracer,tracer,path)) {
         // Reset this guy
         m.acquire();
         idle = false;
-        // Not idle but also does not have the root of the tree
-        path.ngdl(0);
+        // The no-good depth limit has been set when stealing
         d = 0;
         cur = s;
         mark = 0;
@@ -168,10 +172,13 @@ namespace Gecode { namespace Search { namespace Par {
         Statistics t = *this;
         Search::Worker::reset(r_d);
         (*this) += t;
+        stolen();
         m.release();
         return;
       }
     }
+    // No work found, try again later
+    backoff();
   }
 
   /*
@@ -313,8 +320,8 @@ namespace Gecode { namespace Search { namespace Par {
               case SS_BRANCH:
                 {
                   Space* c;
-                  if ((d == 0) || (d >= engine().opt().c_d)) {
-                    c = cur->clone();
+                  if ((d == 0) || (d >= path.c_d())) {
+                    c = path.clone(*this,cur);
                     d = 1;
                   } else {
                     c = nullptr;
@@ -391,21 +398,19 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Tracer>
   NoGoods&
   BAB<Tracer>::nogoods(void) {
-    NoGoods* ng;
     // Grab wait lock for reset
     m_wait_reset.acquire();
     // Release workers for reset
     release(C_RESET);
     // Wait for reset cycle started
     e_reset_ack_start.wait();
-    ng = &worker(0)->nogoods();
     // Block workers again to ensure invariant
     block();
     // Release reset lock
     m_wait_reset.release();
     // Wait for reset cycle stopped
     e_reset_ack_stop.wait();
-    return *ng;
+    return ngs;
   }
 
   /*
@@ -41,6 +41,7 @@ namespace Gecode { namespace Search { namespace Par {
   /// %Parallel depth-first search engine
   template<class Tracer>
   class DFS : public Engine<Tracer> {
+    friend class WorkerNoGoods<DFS>;
   protected:
     using Engine<Tracer>::idle;
     using Engine<Tracer>::busy;
@@ -76,6 +77,10 @@ namespace Gecode { namespace Search { namespace Par {
       using Engine<Tracer>::Worker::start;
       using Engine<Tracer>::Worker::tracer;
       using Engine<Tracer>::Worker::stop;
+      using Engine<Tracer>::Worker::victim;
+      using Engine<Tracer>::Worker::stolen;
+      using Engine<Tracer>::Worker::backoff;
+      using Engine<Tracer>::Worker::bo;
       /// Initialize for space \a s with engine \a e
       Worker(Space* s, DFS& e);
       /// Provide access to engine
@@ -89,6 +94,8 @@ namespace Gecode { namespace Search { namespace Par {
     };
     /// Array of worker references
     Worker** _worker;
+    /// No-goods of all workers
+    WorkerNoGoods<DFS> ngs;
   public:
     /// Provide access to worker \a i
     Worker* worker(unsigned int i) const;
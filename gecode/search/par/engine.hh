@@ -46,6 +46,19 @@
 
 namespace Gecode { namespace Search { namespace Par {
 
+  /// No-goods recorded by the paths of all workers of an engine \a E
+  template<class E>
+  class WorkerNoGoods : public NoGoods {
+  protected:
+    /// The engine
+    const E& e;
+  public:
+    /// Initialize for engine \a e
+    WorkerNoGoods(const E& e);
+    /// Post no-goods of all workers
+    virtual void post(Space& home) const;
+  };
+
   /// %Parallel depth-first search engine
   template<class Tracer>
   class Engine : public Search::Engine, public Support::Terminator {
@@ -68,11 +81,22 @@ namespace Gecode { namespace Search { namespace Par {
       unsigned int d;
       /// Whether the worker is idle
       bool idle;
+      /// Random number generator for selecting victims for stealing
+      Support::RandomGenerator rnd;
+      /// Current back-off exponent when no work could be found
+      unsigned int bo;
+      /// Select first victim for stealing among \a n workers
+      unsigned int victim(unsigned int n);
+      /// Record successful steal
+      void stolen(void);
+      /// Record unsuccessful attempt to steal and back off
+      void backoff(void);
     public:
       /// Initialize for space \a s with engine \a e
       Worker(Space* s, Engine& e);
-      /// Hand over some work (nullptr if no work available)
-      Space* steal(unsigned long int& d, Tracer& myt, Tracer& ot);
+      /// Hand over some work for path \a t (nullptr if no work available)
+      Space* steal(unsigned long int& d, Tracer& myt, Tracer& ot,
+                   Path<Tracer>& t);
       /// Return statistics
       Statistics statistics(void);
       /// Provide access to engine
@@ -37,6 +37,27 @@
 
 namespace Gecode { namespace Search { namespace Par {
 
+  /*
+   * No-goods of all workers
+   */
+  template<class E>
+  forceinline
+  WorkerNoGoods<E>::WorkerNoGoods(const E& e0) : e(e0) {}
+
+  template<class E>
+  void
+  WorkerNoGoods<E>::post(Space& home) const {
+    unsigned long int n_ng = 0UL;
+    for (unsigned int i=0U; (i<e.workers()) && !home.failed(); i++) {
+      NoGoods& ng = e.worker(i)->nogoods();
+      ng.ng(0);
+      ng.post(home);
+      n_ng += ng.ng();
+    }
+    const_cast<WorkerNoGoods<E>*>(this)->ng(n_ng);
+  }
+
+
 
   /*
    * Basic access routines
@@ -98,8 +119,8 @@ namespace Gecode { namespace Search { namespace Par {
   forceinline
   Engine<Tracer>::Worker::Worker(Space* s, Engine& e)
     : tracer(e.opt().tracer), _engine(e),
-      path(s == nullptr ? 0 : e.opt().nogoods_limit), d(0),
-      idle(false) {
+      path(s == nullptr ? 0 : e.opt().nogoods_limit,e.opt()), d(0),
+      idle(false), rnd(Support::hwrnd()), bo(0U) {
     tracer.worker();
     if (s != nullptr) {
       if (s->status(*this) == SS_FAILED) {
@@ -267,16 +288,21 @@ namespace Gecode { namespace Search { namespace Par {
    */
   template<class Tracer>
   forceinline Space*
-  Engine<Tracer>::Worker::steal(unsigned long int& d, 
-                                Tracer& myt, Tracer& ot) {
+  Engine<Tracer>::Worker::steal(unsigned long int& d,
+                                Tracer& myt, Tracer& ot,
+                                Path<Tracer>& t) {
     /*
      * Make a quick check whether the worker might have work
      *
+     * The check does not require the mutex, so that idle workers
+     * do not contend for the mutex of workers without any work.
      * If that is not true any longer, the worker will be asked
      * again eventually.
      */
+    if (!path.steal())
+      return nullptr;
     m.acquire();
-    Space* s = path.steal() ? path.steal(*this,d,myt,ot) : nullptr;
+    Space* s = path.steal() ? path.steal(*this,d,myt,ot,t) : nullptr;
     m.release();
     // Tell that there will be one more busy worker
     if (s != nullptr)
@@ -284,6 +310,38 @@ namespace Gecode { namespace Search { namespace Par {
     return s;
   }
 
+  template<class Tracer>
+  forceinline unsigned int
+  Engine<Tracer>::Worker::victim(unsigned int n) {
+    // Randomize so that idle workers do not all start with the same victim
+    return rnd(n);
+  }
+
+  template<class Tracer>
+  forceinline void
+  Engine<Tracer>::Worker::stolen(void) {
+    // Requires that the worker's mutex is held
+    steal_success++;
+    bo = 0U;
+  }
+
+  template<class Tracer>
+  forceinline void
+  Engine<Tracer>::Worker::backoff(void) {
+    m.acquire();
+    steal_fail++;
+    m.release();
+    if (bo < Config::steal_backoff) {
+      // Exponential back-off by yielding
+      for (unsigned int i=1U << bo; i--; )
+        Support::Thread::yield();
+      bo++;
+    } else {
+      // Park the worker for a while
+      Support::Thread::sleep(1);
+    }
+  }
+
   /*
    * Return No-Goods
    */
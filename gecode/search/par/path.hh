@@ -39,11 +39,13 @@
 #define GECODE_SEARCH_PAR_PATH_HH
 
 #include <algorithm>
+#include <atomic>
 
 #include <gecode/search.hh>
 #include <gecode/search/support.hh>
 #include <gecode/search/worker.hh>
 #include <gecode/search/nogoods.hh>
+#include <gecode/search/distance.hh>
 
 namespace Gecode { namespace Search { namespace Par {
 
@@ -59,6 +61,9 @@ namespace Gecode { namespace Search { namespace Par {
    * distance is at least this large, an additional
    * clone is created.
    *
+   * The path also maintains the (possibly adaptive) commit
+   * distance, see AdaptiveDistance.
+   *
    */
   template<class Tracer>
   class Path : public NoGoods {
@@ -119,15 +124,38 @@ namespace Gecode { namespace Search { namespace Par {
     Support::DynamicStack<Edge,Heap> ds;
     /// Depth limit for no-good generation
     unsigned int _ngdl;
-    /// Number of edges that have work for stealing
-    unsigned int n_work;
+    /// Depth limit for no-good generation including stolen prefixes
+    unsigned int _ngl;
+    /// Choices and alternatives leading from the root to the path
+    Archive pre;
+    /// Number of choices in the prefix
+    unsigned int n_pre;
+    /// Set prefix after stealing alternative \a a at depth \a n of \a v
+    void prefix(const Path& v, int n, unsigned int a);
+    /// Commit distance
+    AdaptiveDistance ad;
+    /**
+     * \brief Number of edges that have work for stealing
+     *
+     * Only modified by the owning worker while holding its mutex, but
+     * read without synchronization by thieves for a quick check.
+     */
+    std::atomic<unsigned int> n_work;
+    /// Record that an edge with work has been added
+    void work_inc(void);
+    /// Record that an edge with work has been removed
+    void work_dec(void);
   public:
-    /// Initialize with no-good depth limit \a l
-    Path(unsigned int l);
+    /// Initialize with no-good depth limit \a l and options \a o
+    Path(unsigned int l, const Options& o);
     /// Return no-good depth limit
     unsigned int ngdl(void) const;
     /// Set no-good depth limit to \a l
     void ngdl(unsigned int l);
+    /// Return commit distance for the current depth
+    unsigned int c_d(void) const;
+    /// Return clone of space \a s to be pushed and record it in \a stat
+    Space* clone(Statistics& stat, Space* s);
     /// Push space \a c (a clone of \a s or nullptr)
     const Choice* push(Worker& stat, Space* s, Space* c, unsigned int nid);
     /// Generate path for next node
@@ -153,11 +181,11 @@ namespace Gecode { namespace Search { namespace Par {
     int entries(void) const;
     /// Reset stack and set no-good depth limit to \a l
     void reset(unsigned int l);
-    /// Make a quick check whether stealing might be feasible
+    /// Make a quick check whether stealing might be feasible (lock-free)
     bool steal(void) const;
-    /// Steal work at depth \a d
+    /// Steal work at depth \a d for path \a t
     Space* steal(Worker& stat, unsigned long int& d,
-                 Tracer& myt, Tracer& ot);
+                 Tracer& myt, Tracer& ot, Path& t);
     /// Post no-goods
     void virtual post(Space& home) const;
   };
@@ -129,8 +129,34 @@ namespace Gecode { namespace Search { namespace Par {
 
   template<class Tracer>
   forceinline
-  Path<Tracer>::Path(unsigned int l)
-    : ds(heap), _ngdl(l), n_work(0) {}
+  Path<Tracer>::Path(unsigned int l, const Options& o)
+    : ds(heap), _ngdl(l), _ngl(o.nogoods_limit), n_pre(0U), ad(o), n_work(0) {}
+
+  template<class Tracer>
+  forceinline unsigned int
+  Path<Tracer>::c_d(void) const {
+    return ad.c_d(static_cast<unsigned int>(ds.entries()));
+  }
+
+  template<class Tracer>
+  forceinline Space*
+  Path<Tracer>::clone(Statistics& stat, Space* s) {
+    return ad.clone(stat,s,static_cast<unsigned int>(ds.entries()));
+  }
+
+  template<class Tracer>
+  forceinline void
+  Path<Tracer>::work_inc(void) {
+    n_work.store(n_work.load(std::memory_order_relaxed) + 1,
+                 std::memory_order_relaxed);
+  }
+
+  template<class Tracer>
+  forceinline void
+  Path<Tracer>::work_dec(void) {
+    n_work.store(n_work.load(std::memory_order_relaxed) - 1,
+                 std::memory_order_relaxed);
+  }
 
   template<class Tracer>
   forceinline unsigned int
@@ -153,7 +179,7 @@ namespace Gecode { namespace Search { namespace Par {
     }
     Edge sn(s,c,nid);
     if (sn.work())
-      n_work++;
+      work_inc();
     ds.push(sn);
     stat.stack_depth(static_cast<unsigned long int>(ds.entries()));
     return sn.choice();
@@ -169,7 +195,7 @@ namespace Gecode { namespace Search { namespace Par {
         assert(ds.top().work());
         ds.top().next();
         if (!ds.top().work())
-          n_work--;
+          work_dec();
         return;
       }
   }
@@ -223,13 +249,13 @@ namespace Gecode { namespace Search { namespace Par {
           t.skip(ei);
         }
         if (ds.top().work())
-          n_work--;
+          work_dec();
         ds.pop().dispose();
       }
     } else {
       for (int i=l; i<n; i++) {
         if (ds.top().work())
-          n_work--;
+          work_dec();
         ds.pop().dispose();
       }
     }
@@ -239,22 +265,47 @@ namespace Gecode { namespace Search { namespace Par {
   template<class Tracer>
   forceinline void
   Path<Tracer>::reset(unsigned int l) {
-    n_work = 0;
+    n_work.store(0, std::memory_order_relaxed);
     while (!ds.empty())
       ds.pop().dispose();
     _ngdl = l;
+    pre = Archive(); n_pre = 0U;
+  }
+
+  template<class Tracer>
+  forceinline void
+  Path<Tracer>::prefix(const Path& v, int n, unsigned int a) {
+    pre = Archive(); n_pre = 0U;
+    unsigned int l = v.n_pre + static_cast<unsigned int>(n) + 1U;
+    /*
+     * The prefix is only known if the victim itself knows its prefix,
+     * that is, it either starts at the root or has a known prefix.
+     */
+    if (((v.n_pre > 0U) || (v.ngdl() > 0U)) && (l < _ngl)) {
+      pre = v.pre;
+      for (int i=0; i<n; i++) {
+        v.ds[i].choice()->archive(pre);
+        pre << v.ds[i].truealt();
+      }
+      v.ds[n].choice()->archive(pre);
+      pre << a;
+      n_pre = l;
+      _ngdl = _ngl - l;
+    } else {
+      _ngdl = 0U;
+    }
   }
 
   template<class Tracer>
   forceinline bool
   Path<Tracer>::steal(void) const {
-    return n_work > Config::steal_limit;
+    return n_work.load(std::memory_order_relaxed) > Config::steal_limit;
   }
 
   template<class Tracer>
   forceinline Space*
   Path<Tracer>::steal(Worker& stat, unsigned long int& d,
-                      Tracer& myt, Tracer& ot) {
+                      Tracer& myt, Tracer& ot, Path& t) {
     // Find position to steal: leave sufficient work
     int n = ds.entries()-1;
     unsigned int w = 0;
@@ -267,14 +318,16 @@ namespace Gecode { namespace Search { namespace Par {
         // Find last copy
         while (ds[l].space() == nullptr)
           l--;
-        Space* c = ds[l].space()->clone();
+        Space* c = ds[l].space()->clone(stat);
         // Recompute, if necessary
         for (int i=l; i<n; i++)
           commit(c,i);
         unsigned int a = ds[n].steal();
         c->commit(*ds[n].choice(),a);
         if (!ds[n].work())
-          n_work--;
+          work_dec();
+        // The thief can extract no-goods below the stolen node
+        t.prefix(*this,n,a);
         // No no-goods can be extracted above n
         ngdl(std::min(ngdl(),static_cast<unsigned int>(n)));
         d = stat.steal_depth(static_cast<unsigned long int>(n+1));
@@ -309,12 +362,14 @@ namespace Gecode { namespace Search { namespace Par {
       return s;
     }
     // General case for recomputation
+    if (ad)
+      ad.start();
     int l = lc();             // Position of last clone
     int n = ds.entries();     // Number of stack entries
     // New distance, if no adaptive recomputation
     d = static_cast<unsigned int>(n - l);
 
-    Space* s = ds[l].space()->clone(); // Last clone
+    Space* s = ds[l].space()->clone(stat); // Last clone
 
     if (d < a_d) {
       // No adaptive recomputation
@@ -344,13 +399,16 @@ namespace Gecode { namespace Search { namespace Par {
           unwind(i,t);
           return nullptr;
         }
-        ds[i].space(s->clone());
+        ds[i].space(s->clone(stat));
         d = static_cast<unsigned int>(n-i);
       }
       // Finally do the remaining commits
       for (; i<n; i++)
         commit(s,i);
     }
+    if (ad)
+      ad.stop(stat,*s,static_cast<unsigned int>(n),
+              static_cast<unsigned int>(n-l));
     return s;
   }
 
@@ -380,6 +438,8 @@ namespace Gecode { namespace Search { namespace Par {
       return s;
     }
     // General case for recomputation
+    if (ad)
+      ad.start();
     int l = lc();             // Position of last clone
     int n = ds.entries();     // Number of stack entries
     // New distance, if no adaptive recomputation
@@ -401,10 +461,10 @@ namespace Gecode { namespace Search { namespace Par {
       // It is important to replace the space on the stack with the
       // copy: a copy might be much smaller due to flushed caches
       // of propagators
-      Space* c = s->clone();
+      Space* c = s->clone(stat);
       ds[l].space(c);
     } else {
-      s = s->clone();
+      s = s->clone(stat);
     }
 
     if (d < a_d) {
@@ -438,20 +498,28 @@ namespace Gecode { namespace Search { namespace Par {
           unwind(i,t);
           return nullptr;
         }
-        ds[i].space(s->clone());
+        ds[i].space(s->clone(stat));
         d = static_cast<unsigned int>(n-i);
       }
       // Finally do the remaining commits
       for (; i<n; i++)
         commit(s,i);
     }
+    if (ad)
+      ad.stop(stat,*s,static_cast<unsigned int>(n),
+              static_cast<unsigned int>(n-l));
     return s;
   }
 
   template<class Tracer>
   void
   Path<Tracer>::post(Space& home) const {
-    GECODE_ES_FAIL(NoGoodsProp::post(home,*this));
+    if (n_pre == 0U) {
+      GECODE_ES_FAIL(NoGoodsProp::post(home,*this));
+    } else {
+      Archive p(pre);
+      GECODE_ES_FAIL(NoGoodsProp::post(home,*this,p,n_pre));
+    }
   }
 
 }}}
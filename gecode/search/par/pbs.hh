@@ -143,7 +143,12 @@ namespace Gecode { namespace Search { namespace Par {
     static const bool best = true;
     /// Initialize
     CollectBest(void);
-    /// Add a solution \a s by \a r and return whether is was better
+    /**
+     * \brief Add a solution \a s by \a r and return whether is was better
+     *
+     * If \a s is not better, \a r is constrained by the current
+     * incumbent before it resumes search.
+     */
     bool add(Space* s, Slave<CollectBest>* r);
     /// Check whether \a b better and update accordingly
     bool constrain(const Space& b);
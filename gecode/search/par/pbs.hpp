@@ -99,7 +99,10 @@ namespace Gecode { namespace Search { namespace Par {
       if (b->status() == SS_FAILED) {
         delete b;
       } else {
+        // The slave lags behind the incumbent: let it continue with the
+        // incumbent as its bound rather than with its own solution
         delete s;
+        r->constrain(*b);
         return false;
       }
     }
@@ -42,7 +42,7 @@ namespace Gecode { namespace Search { namespace Seq {
   template<class Tracer>
   forceinline
   BAB<Tracer>::BAB(Space* s, const Options& o)
-    : tracer(o.tracer), opt(o), path(opt.nogoods_limit), d(0), mark(0), 
+    : tracer(o.tracer), opt(o), path(opt.nogoods_limit,opt), d(0), mark(0), 
       best(nullptr) {
     if (tracer) {
       tracer.engine(SearchTracer::EngineType::BAB, 1U);
@@ -128,8 +128,8 @@ namespace Gecode { namespace Search { namespace Seq {
       case SS_BRANCH:
         {
           Space* c;
-          if ((d == 0) || (d >= opt.c_d)) {
-            c = cur->clone();
+          if ((d == 0) || (d >= path.c_d())) {
+            c = path.clone(*this,cur);
             d = 1;
           } else {
             c = nullptr;
@@ -159,7 +159,7 @@ namespace Gecode { namespace Search { namespace Seq {
           delete ch;
         } else {
           ds.top().next();
-          cur = ds.top().space()->clone();
+          cur = ds.top().space()->clone(*this);
           if (tracer)
             tracer.ei()->init(tracer.wid(), nid, a, *cur, *ch);
           cur->commit(*ch,a);
@@ -244,7 +244,7 @@ namespace Gecode { namespace Search { namespace Seq {
               if (d < alt-1)
                 exhausted = false;
               unsigned int d_a = (d >= alt-1) ? alt-1 : d;
-              Space* cc = cur->clone();
+              Space* cc = cur->clone(*this);
               Node sn(cc,ch,d_a-1,nid);
               ds.push(sn);
               stack_depth(static_cast<unsigned long int>(ds.entries()));
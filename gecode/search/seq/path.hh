@@ -44,6 +44,7 @@
 #include <gecode/search/support.hh>
 #include <gecode/search/worker.hh>
 #include <gecode/search/nogoods.hh>
+#include <gecode/search/distance.hh>
 
 namespace Gecode { namespace Search { namespace Seq {
 
@@ -59,6 +60,9 @@ namespace Gecode { namespace Search { namespace Seq {
    * distance is at least this large, an additional
    * clone is created.
    *
+   * The path also maintains the (possibly adaptive) commit
+   * distance, see AdaptiveDistance.
+   *
    */
   template<class Tracer>
   class GECODE_VTABLE_EXPORT Path : public NoGoods {
@@ -115,13 +119,19 @@ namespace Gecode { namespace Search { namespace Seq {
     Support::DynamicStack<Edge,Heap> ds;
     /// Depth limit for no-good generation
     unsigned int _ngdl;
+    /// Commit distance
+    AdaptiveDistance ad;
   public:
-    /// Initialize with no-good depth limit \a l
-    Path(unsigned int l);
+    /// Initialize with no-good depth limit \a l and options \a o
+    Path(unsigned int l, const Options& o);
     /// Return no-good depth limit
     unsigned int ngdl(void) const;
     /// Set no-good depth limit to \a l
     void ngdl(unsigned int l);
+    /// Return commit distance for the current depth
+    unsigned int c_d(void) const;
+    /// Return clone of space \a s to be pushed and record it in \a stat
+    Space* clone(Statistics& stat, Space* s);
     /// Push space \a c (a clone of \a s or nullptr)
     const Choice* push(Worker& stat, Space* s, Space* c, unsigned int nid);
     /// Generate path for next node
@@ -120,8 +120,20 @@ namespace Gecode { namespace Search { namespace Seq {
 
   template<class Tracer>
   forceinline
-  Path<Tracer>::Path(unsigned int l)
-    : ds(heap), _ngdl(l) {}
+  Path<Tracer>::Path(unsigned int l, const Options& o)
+    : ds(heap), _ngdl(l), ad(o) {}
+
+  template<class Tracer>
+  forceinline unsigned int
+  Path<Tracer>::c_d(void) const {
+    return ad.c_d(static_cast<unsigned int>(ds.entries()));
+  }
+
+  template<class Tracer>
+  forceinline Space*
+  Path<Tracer>::clone(Statistics& stat, Space* s) {
+    return ad.clone(stat,s,static_cast<unsigned int>(ds.entries()));
+  }
 
   template<class Tracer>
   forceinline unsigned int
@@ -245,12 +257,14 @@ namespace Gecode { namespace Search { namespace Seq {
       return s;
     }
     // General case for recomputation
+    if (ad)
+      ad.start();
     int l = lc();             // Position of last clone
     int n = ds.entries();     // Number of stack entries
     // New distance, if no adaptive recomputation
     d = static_cast<unsigned int>(n - l);
 
-    Space* s = ds[l].space()->clone(); // Last clone
+    Space* s = ds[l].space()->clone(stat); // Last clone
 
     if (d < a_d) {
       // No adaptive recomputation
@@ -280,13 +294,16 @@ namespace Gecode { namespace Search { namespace Seq {
           unwind(i,t);
           return nullptr;
         }
-        ds[i].space(s->clone());
+        ds[i].space(s->clone(stat));
         d = static_cast<unsigned int>(n-i);
       }
       // Finally do the remaining commits
       for (; i<n; i++)
         commit(s,i);
     }
+    if (ad)
+      ad.stop(stat,*s,static_cast<unsigned int>(n),
+              static_cast<unsigned int>(n-l));
     return s;
   }
 
@@ -316,6 +333,8 @@ namespace Gecode { namespace Search { namespace Seq {
       return s;
     }
     // General case for recomputation
+    if (ad)
+      ad.start();
     int l = lc();             // Position of last clone
     int n = ds.entries();     // Number of stack entries
     // New distance, if no adaptive recomputation
@@ -337,10 +356,10 @@ namespace Gecode { namespace Search { namespace Seq {
       // It is important to replace the space on the stack with the
       // copy: a copy might be much smaller due to flushed caches
       // of propagators
-      Space* c = s->clone();
+      Space* c = s->clone(stat);
       ds[l].space(c);
     } else {
-      s = s->clone();
+      s = s->clone(stat);
     }
 
     if (d < a_d) {
@@ -374,13 +393,16 @@ namespace Gecode { namespace Search { namespace Seq {
           unwind(i,t);
           return nullptr;
         }
-        ds[i].space(s->clone());
+        ds[i].space(s->clone(stat));
         d = static_cast<unsigned int>(n-i);
       }
       // Finally do the remaining commits
       for (; i<n; i++)
         commit(s,i);
     }
+    if (ad)
+      ad.stop(stat,*s,static_cast<unsigned int>(n),
+              static_cast<unsigned int>(n-l));
     return s;
   }
 
@@ -38,22 +38,32 @@ namespace Gecode { namespace Search {
   forceinline void
   Statistics::reset(void) {
     StatusStatistics::reset();
+    CloneStatistics::reset();
     fail=0ULL; node=0ULL; depth=0UL; restart=0UL; nogood=0UL;
+    steal_success=0UL; steal_fail=0UL;
+    c_d_inc=0UL; c_d_dec=0UL;
   }
 
   forceinline
   Statistics::Statistics(void)
     : fail(0ULL), node(0ULL),
-      depth(0UL), restart(0UL), nogood(0UL) {}
+      depth(0UL), restart(0UL), nogood(0UL),
+      steal_success(0UL), steal_fail(0UL),
+      c_d_inc(0UL), c_d_dec(0UL) {}
 
   forceinline Statistics&
   Statistics::operator +=(const Statistics& s) {
     (void) StatusStatistics::operator +=(s);
+    (void) CloneStatistics::operator +=(s);
     fail += s.fail;
     node += s.node;
     depth = std::max(depth,s.depth);
     restart += s.restart;
     nogood += s.nogood;
+    steal_success += s.steal_success;
+    steal_fail += s.steal_fail;
+    c_d_inc += s.c_d_inc;
+    c_d_dec += s.c_d_dec;
     return *this;
   }
 
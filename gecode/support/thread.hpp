@@ -249,6 +249,8 @@ namespace Gecode { namespace Support {
     static void run(Runnable* r);
     /// Put current thread to sleep for \a ms milliseconds
     static void sleep(unsigned int ms);
+    /// Offer the remainder of the current time slice to other threads
+    static void yield(void);
     /// Return number of processing units (1 if information not available)
     static unsigned int npu(void);
     /// acquire mutex \a m globally and possibly lock
@@ -158,6 +158,12 @@ namespace Gecode { namespace Support {
     std::this_thread::sleep_for(std::chrono::milliseconds(ms));
 #else
     (void) ms;
+#endif
+  }
+  forceinline void
+  Thread::yield(void) {
+#ifdef GECODE_HAS_THREADS
+    std::this_thread::yield();
 #endif
   }
   forceinline unsigned int
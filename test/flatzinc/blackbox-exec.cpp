@@ -41,6 +41,8 @@
 #include <string>
 
 #ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
 #include <windows.h>
 #else
 #include <fcntl.h>
@@ -208,6 +210,64 @@ namespace {
     }
   }
 
+  bool
+  read_word(uint64_t& w) {
+    unsigned char b[8];
+    if (!std::cin.read(reinterpret_cast<char*>(b), sizeof(b))) {
+      return false;
+    }
+    w = 0;
+    for (int i = 0; i < 8; ++i) {
+      w |= static_cast<uint64_t>(b[i]) << (8 * i);
+    }
+    return true;
+  }
+
+  void
+  write_word(std::string& out, uint64_t w) {
+    for (int i = 0; i < 8; ++i) {
+      out.push_back(static_cast<char>((w >> (8 * i)) & 0xff));
+    }
+  }
+
+  /// Echo every call of every binary frame after the handshake
+  int
+  binary_echo(void) {
+#ifdef _WIN32
+    (void)_setmode(_fileno(stdin), _O_BINARY);
+    (void)_setmode(_fileno(stdout), _O_BINARY);
+#endif
+    std::string handshake;
+    if (!std::getline(std::cin, handshake)) {
+      return 0;
+    }
+    write_response(handshake);
+    uint64_t calls;
+    while (read_word(calls)) {
+      std::string out;
+      for (uint64_t c = 0; c < calls; ++c) {
+        // Integer and float inputs are echoed word by word
+        for (int kind = 0; kind < 2; ++kind) {
+          uint64_t n;
+          if (!read_word(n)) {
+            return 1;
+          }
+          write_word(out, n);
+          for (uint64_t i = 0; i < n; ++i) {
+            uint64_t w;
+            if (!read_word(w)) {
+              return 1;
+            }
+            write_word(out, w);
+          }
+        }
+      }
+      std::cout.write(out.data(), static_cast<std::streamsize>(out.size()));
+      std::cout.flush();
+    }
+    return 0;
+  }
+
 }
 
 int
@@ -218,6 +278,9 @@ main(int argc, char* argv[]) {
 #ifndef _WIN32
   bool descendant_started = false;
 #endif
+  if (mode == "binary_echo") {
+    return binary_echo();
+  }
   std::string request;
   while (std::getline(std::cin, request)) {
     ++round;
@@ -278,6 +278,140 @@ namespace Test { namespace FlatZinc {
       }
     };
 
+    class NativeBinaryProtocol : public Base {
+    public:
+      NativeBinaryProtocol(void)
+        : Base("FlatZinc::blackbox::native_binary_protocol") {}
+      virtual bool run(void) {
+        std::vector<int64_t> int_input{-2};
+        std::vector<double> float_input{1.25};
+        std::vector<int64_t> int_output(1);
+        std::vector<double> float_output(1);
+        Gecode::FlatZinc::BlackBoxCall call = {
+          int_input, float_input, int_output, float_output
+        };
+        try {
+          const std::string request =
+            Gecode::FlatZinc::encode_blackbox_frames(&call, 1);
+          // Count, then length and value of both input arrays
+          if ((request.size() != 40) || (request[0] != 1) ||
+              (request[8] != 1) || (request[16] != static_cast<char>(0xfe)) ||
+              (request[23] != static_cast<char>(0xff)) || (request[24] != 1))
+            return false;
+          if (Gecode::FlatZinc::blackbox_frames_size(&call, 1) != 32)
+            return false;
+          // The response is the request without the leading count
+          Gecode::FlatZinc::decode_blackbox_frames(request.substr(8),
+                                                   &call, 1);
+        } catch (...) {
+          return false;
+        }
+        return (int_output[0] == -2) && (float_output[0] == 1.25);
+      }
+    };
+
+#if defined(_WIN32) || defined(GECODE_HAS_POSIX_BLACKBOX_EXEC)
+    class NativeExecBinary : public Base {
+    private:
+      std::string executable;
+    public:
+      NativeExecBinary(const std::string& executable0)
+        : Base("FlatZinc::blackbox::native_exec_binary"),
+          executable(executable0) {}
+      virtual bool run(void) {
+        using namespace Gecode::FlatZinc;
+        try {
+          BlackBoxExec black_box(executable, {"binary_echo"});
+          black_box.binary(true);
+          std::vector<int64_t> int_in[3] = {{1, -5}, {2, 7}, {3, 0}};
+          std::vector<double> float_in[3] = {{0.5}, {-1.5}, {2.0}};
+          std::vector<int64_t> int_out[3];
+          std::vector<double> float_out[3];
+          std::vector<BlackBoxCall> calls;
+          for (int i = 0; i < 3; i++) {
+            int_out[i].resize(2);
+            float_out[i].resize(1);
+            calls.push_back({int_in[i], float_in[i], int_out[i],
+                             float_out[i]});
+          }
+          // Two batched exchanges over the same negotiated session
+          for (int r = 0; r < 2; r++) {
+            black_box.run(calls.data(), calls.size());
+            for (int i = 0; i < 3; i++)
+              if ((int_out[i] != int_in[i]) || (float_out[i] != float_in[i]))
+                return false;
+          }
+        } catch (...) {
+          return false;
+        }
+        return true;
+      }
+    };
+
+    class NativeExecBinaryRefused : public Base {
+    private:
+      std::string executable;
+    public:
+      NativeExecBinaryRefused(const std::string& executable0)
+        : Base("FlatZinc::blackbox::native_exec_binary_refused"),
+          executable(executable0) {}
+      virtual bool run(void) {
+        using namespace Gecode::FlatZinc;
+        try {
+          BlackBoxExec black_box(executable, {"normal"});
+          black_box.binary(true);
+          std::vector<int64_t> int_out(1);
+          std::vector<double> float_out;
+          black_box.run({1}, {}, int_out, float_out);
+        } catch (Gecode::FlatZinc::Error& e) {
+          return e.toString().find("does not support binary framing") !=
+            std::string::npos;
+        } catch (...) {}
+        return false;
+      }
+    };
+#endif
+
+    /// Backend that counts its evaluations and returns the doubled input
+    class CountingBackend : public Gecode::FlatZinc::BlackBoxBackend {
+    public:
+      using BlackBoxBackend::run;
+      unsigned int calls;
+      CountingBackend(void) : calls(0) {}
+      void run(Gecode::FlatZinc::BlackBoxCall& call) override {
+        calls++;
+        call.int_output[0] = 2 * call.int_input[0];
+      }
+    };
+
+    class NativeCache : public Base {
+    public:
+      NativeCache(void) : Base("FlatZinc::blackbox::native_cache") {}
+      virtual bool run(void) {
+        using namespace Gecode::FlatZinc;
+        CountingBackend* counting = new CountingBackend;
+        BlackBoxCacheControlHandle control(new BlackBoxCacheControl(2));
+        BlackBoxCache cache(BlackBoxHandle(counting), control);
+        std::vector<int64_t> int_out(1);
+        std::vector<double> float_out;
+        // Input 1 is used again before input 3 evicts one entry
+        const int64_t inputs[] = {1, 2, 1, 3, 1, 2};
+        for (int64_t i : inputs) {
+          cache.run({i}, {}, int_out, float_out);
+          if (int_out[0] != 2 * i)
+            return false;
+        }
+        BlackBoxCacheStatistics s = control()->statistics();
+        if ((counting->calls != 4) || (s.hits != 2) || (s.misses != 4) ||
+            (s.evictions != 2))
+          return false;
+        // A zero limit bypasses the cache
+        control()->limit = 0;
+        cache.run({1}, {}, int_out, float_out);
+        return (counting->calls == 5) && (control()->statistics().hits == 2);
+      }
+    };
+
 #ifdef GECODE_HAS_THREADS
     template<class T>
     bool
@@ -372,6 +506,8 @@ namespace Test { namespace FlatZinc {
       /// Perform creation and registration
       Create(void) {
         (void) new NativeProtocol;
+        (void) new NativeCache;
+        (void) new NativeBinaryProtocol;
         (void) new FlatZincErrorTest("blackbox::malformed_annotation",
           std::string(blackbox_decl) +
           "var 0..1: y;\n"
@@ -384,6 +520,8 @@ namespace Test { namespace FlatZinc {
         const char* exec = std::getenv("GECODE_TEST_BLACKBOX_EXEC");
         if (exec != nullptr) {
           const std::string executable(exec);
+          (void) new NativeExecBinary(executable);
+          (void) new NativeExecBinaryRefused(executable);
           (void) new FlatZincTest("blackbox::constant_value",
             std::string(blackbox_decl) +
             "var 7..7: y :: output_var;\n"
@@ -437,6 +575,32 @@ namespace Test { namespace FlatZinc {
             "x = 1;\ny = 5;\n----------\n==========\n",
             false, {"-a"});
 
+          (void) new FlatZincTest("blackbox::async_evaluation",
+            std::string(blackbox_decl) +
+            "var 0..1: x;\n"
+            "var 0..1: y;\n"
+            "var 0..1: a :: output_var;\n"
+            "var 0..1: b :: output_var;\n"
+            "constraint gecode_blackbox([x], [], [a], []) :: " +
+            fixture_annotation("exec", executable, {"normal"}) + ";\n"
+            "constraint gecode_blackbox([y], [], [b], []) :: " +
+            fixture_annotation("exec", executable, {"normal"}) + ";\n"
+            "solve :: int_search([x,y], input_order, indomain_min, "
+            "complete) satisfy;\n",
+            "", false, {"-a", "-s", "-blackbox-async", "2"},
+            [](const std::string& output) {
+              const std::string solutions =
+                "a = 0;\nb = 0;\n----------\n"
+                "a = 0;\nb = 1;\n----------\n"
+                "a = 1;\nb = 0;\n----------\n"
+                "a = 1;\nb = 1;\n----------\n==========\n";
+              return (output.compare(0, solutions.size(), solutions) == 0) &&
+                (output.find("blackboxAsyncEvaluations=") !=
+                 std::string::npos) &&
+                (output.find("blackboxAsyncEvaluations=0\n") ==
+                 std::string::npos);
+            });
+
 #ifdef GECODE_HAS_FLOAT_VARS
           (void) new FlatZincErrorTest("blackbox::missing_bounds_reason_entry",
             std::string(blackbox_bounds_decl) +
@@ -33,9 +33,110 @@
 
 #include "test/flatzinc.hh"
 
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <sstream>
+
 namespace Test { namespace FlatZinc {
 
   namespace {
+
+    /// %Test that learning clauses does not change the solutions
+    class BoolClauseLearning : public Base {
+    protected:
+      /// Number of variables
+      static const int n = 40;
+      /// Number of clauses
+      static const int m = 170;
+      /// The model: random 3-SAT close to the phase transition
+      std::string source;
+      /// Solve model in file \a fzn with options \a args, store output in \a out
+      bool solve(const std::string& fzn, std::vector<std::string> args,
+                 std::string& out) {
+        Gecode::Support::Timer t_total;
+        t_total.start();
+        Gecode::FlatZinc::FlatZincOptions fznopt("Gecode/FlatZinc");
+        std::string cmd("fzn-gecode");
+        std::vector<char*> argv;
+        argv.push_back(const_cast<char*>(cmd.data()));
+        for (std::string& a : args)
+          argv.push_back(const_cast<char*>(a.data()));
+        int argc = static_cast<int>(argv.size());
+        fznopt.parse(argc, argv.data());
+        fznopt.allSolutions(true);
+        Gecode::FlatZinc::Printer p;
+        try {
+          std::unique_ptr<Gecode::FlatZinc::FlatZincSpace>
+            fg(Gecode::FlatZinc::parse(fzn, fznopt, p, olog));
+          if (!fg)
+            return false;
+          if (fg->clauseIpl != (fznopt.clause_learning() ?
+                                Gecode::IPL_ADVANCED : Gecode::IPL_DEF))
+            return false;
+          fg->createBranchers(p, fg->solveAnnotations(), fznopt,
+                              false, olog);
+          fg->shrinkArrays(p);
+          std::ostringstream os;
+          fg->run(os, p, fznopt, t_total);
+          out = os.str();
+          return true;
+        } catch (Gecode::FlatZinc::Error& e) {
+          if (opt.log)
+            olog << ind(2) << "FlatZinc error : " << e.toString() << std::endl;
+          return false;
+        }
+      }
+    public:
+      /// Create and register test
+      BoolClauseLearning(void)
+        : Base("FlatZinc::bool_clause::learning") {
+        std::ostringstream os;
+        os << "array [1.." << n << "] of var bool: x"
+           << " :: output_array([1.." << n << "]);\n";
+        // Fixed generator so that the instance does not depend on the seed
+        std::minstd_rand r(2718U);
+        for (int i=0; i<m; i++) {
+          std::ostringstream pos, neg;
+          for (int j=0; j<3; j++) {
+            std::ostringstream& l = (r() % 2U == 0U) ? pos : neg;
+            l << ((l.tellp() > 0) ? "," : "")
+              << "x[" << (1 + static_cast<int>(r() % n)) << "]";
+          }
+          os << "constraint bool_clause([" << pos.str() << "],["
+             << neg.str() << "]);\n";
+        }
+        os << "solve :: bool_search(x, input_order, indomain_min, complete)"
+           << " satisfy;\n";
+        source = os.str();
+      }
+      /// Perform test
+      virtual bool run(void) {
+        std::random_device rd;
+        std::string fzn = (std::filesystem::temp_directory_path() /
+                           ("gecode-test-" + std::to_string(rd()) + "-" +
+                            std::to_string(rd()) + ".fzn")).string();
+        {
+          std::ofstream os(fzn.c_str(), std::ios::binary | std::ios::trunc);
+          os << source;
+        }
+        std::string expected, learned;
+        bool ok = solve(fzn, {}, expected) &&
+          solve(fzn, {"-clause-learning"}, learned);
+        (void) std::remove(fzn.c_str());
+        if (ok && (expected != learned)) {
+          if (opt.log)
+            olog << ind(2) << "Expected:\n" << expected
+                 << ind(2) << "With learning:\n" << learned;
+          return false;
+        }
+        return ok;
+      }
+    };
+
+    BoolClauseLearning bool_clause_learning;
     /// Helper class to create and register tests
     class Create {
     public:
@@ -0,0 +1,212 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.dev
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "test/flatzinc.hh"
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <sstream>
+
+namespace Test { namespace FlatZinc {
+
+  namespace {
+
+    /// Model exercising all parts of a compiled model
+    const char* cache_model =
+      "array[1..2] of int: c = [2,3];\n"
+      "var 1..5: x :: output_var;\n"
+      "var 1..5: y :: output_var;\n"
+      "var 1..5: z = y;\n"
+      "var bool: b :: output_var;\n"
+      "array[1..2] of var int: xs :: output_array([1..2]) = [x,z];\n"
+#ifdef GECODE_HAS_SET_VARS
+      "var set of 1..3: s :: output_var;\n"
+#endif
+#ifdef GECODE_HAS_FLOAT_VARS
+      "var 0.0..10.0: f :: output_var;\n"
+#endif
+      "constraint int_lin_le(c,[x,y],-4) :: domain;\n"
+      "constraint int_lt_reif(x,y,b);\n"
+      "constraint int_ne(x,3);\n"
+#ifdef GECODE_HAS_SET_VARS
+      "constraint set_card(s,2);\n"
+#endif
+#ifdef GECODE_HAS_FLOAT_VARS
+      "constraint int2float(x,f);\n"
+#endif
+      ;
+
+    /// Return a fresh temporary file name with suffix \a s
+    std::string
+    temp_file_name(const std::string& s) {
+      std::random_device rd;
+      std::string n = "gecode-test-" + std::to_string(rd()) + "-" +
+        std::to_string(rd()) + s;
+      return (std::filesystem::temp_directory_path() / n).string();
+    }
+
+    /// %Test that compiled models are cached, reused, and invalidated
+    class FznCache : public Base {
+    protected:
+      /// Source file name
+      std::string fzn;
+      /// Cache file name
+      std::string cache;
+      /// Write \a source to the source file
+      void write(const std::string& source) {
+        std::ofstream os(fzn.c_str(), std::ios::binary | std::ios::trunc);
+        os << source;
+      }
+      /// Solve model after parsing it with \a parse, store output in \a out
+      template<class Parse>
+      bool solve(Parse parse, std::string& out) {
+        Gecode::Support::Timer t_total;
+        t_total.start();
+        Gecode::FlatZinc::FlatZincOptions fznopt("Gecode/FlatZinc");
+        fznopt.allSolutions(true);
+        Gecode::FlatZinc::Printer p;
+        try {
+          std::unique_ptr<Gecode::FlatZinc::FlatZincSpace> fg(parse(p));
+          if (!fg) {
+            if (opt.log)
+              olog << ind(2) << "Could not parse input" << std::endl;
+            return false;
+          }
+          fg->createBranchers(p, fg->solveAnnotations(), fznopt,
+                              false, olog);
+          fg->shrinkArrays(p);
+          std::ostringstream os;
+          fg->run(os, p, fznopt, t_total);
+          out = os.str();
+          return true;
+        } catch (Gecode::FlatZinc::Error& e) {
+          if (opt.log)
+            olog << ind(2) << "FlatZinc error : " << e.toString() << std::endl;
+          return false;
+        }
+      }
+      /// Solve \a source without cache, store output in \a out
+      bool reference(const std::string& source, std::string& out) {
+        return solve([&](Gecode::FlatZinc::Printer& p) {
+            std::istringstream is(source);
+            return Gecode::FlatZinc::parse(is, p, olog);
+          }, out);
+      }
+      /// Solve the source file using the cache, store output in \a out
+      bool cached(std::string& out) {
+        return solve([&](Gecode::FlatZinc::Printer& p) {
+            return Gecode::FlatZinc::parse(fzn, cache, p, olog);
+          }, out);
+      }
+      /// Mark the cache file as old and return its time
+      std::filesystem::file_time_type age(void) {
+        std::filesystem::file_time_type t =
+          std::filesystem::last_write_time(cache) - std::chrono::hours(1);
+        std::filesystem::last_write_time(cache, t);
+        return t;
+      }
+      /// Check the cached solve of \a source against the reference
+      bool check(const std::string& source, bool hit) {
+        std::string expected, out;
+        std::filesystem::file_time_type t = age();
+        if (!reference(source, expected) || !cached(out))
+          return false;
+        if (out != expected) {
+          if (opt.log)
+            olog << ind(2) << "Expected:\n" << expected
+                 << ind(2) << "Cached:\n" << out;
+          return false;
+        }
+        bool unchanged = std::filesystem::last_write_time(cache) == t;
+        if (unchanged != hit) {
+          if (opt.log)
+            olog << ind(2) << "Cache was " << (hit ? "" : "not ")
+                 << "expected to be reused" << std::endl;
+          return false;
+        }
+        return true;
+      }
+      /// Run all steps
+      bool steps(void) {
+        std::string first = std::string(cache_model) + "solve minimize x;\n";
+        std::string second = std::string(cache_model) + "solve maximize y;\n";
+        std::string out;
+        // Compile the model on first use
+        write(first);
+        if (!cached(out) || !std::filesystem::exists(cache) ||
+            std::filesystem::exists(cache + ".tmp"))
+          return false;
+        // Reuse it while the source is unchanged
+        if (!check(first, true))
+          return false;
+        // Recompile a damaged cache
+        std::filesystem::resize_file(cache,
+                                     std::filesystem::file_size(cache) / 2U);
+        if (!check(first, false) || !check(first, true))
+          return false;
+        // Recompile a changed source
+        write(second);
+        return check(second, false) && check(second, true);
+      }
+    public:
+      /// Create and register test
+      FznCache(void) : Base("FlatZinc::fzn_cache") {}
+      /// Perform test
+      virtual bool run(void) {
+        fzn = temp_file_name(".fzn");
+        cache = temp_file_name(".fznc");
+        bool ok;
+        try {
+          ok = steps();
+        } catch (std::filesystem::filesystem_error& e) {
+          if (opt.log)
+            olog << ind(2) << "Filesystem error: " << e.what() << std::endl;
+          ok = false;
+        }
+        (void) std::remove(fzn.c_str());
+        (void) std::remove(cache.c_str());
+        return ok;
+      }
+    };
+
+    FznCache fzn_cache;
+
+  }
+
+}}
+
+// STATISTICS: test-flatzinc
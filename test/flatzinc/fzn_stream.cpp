@@ -0,0 +1,189 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.dev
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "test/flatzinc.hh"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <sstream>
+
+namespace Test { namespace FlatZinc {
+
+  namespace {
+
+    /// Return a fresh temporary file name with suffix \a s
+    std::string
+    temp_file_name(const std::string& s) {
+      std::random_device rd;
+      std::string n = "gecode-test-" + std::to_string(rd()) + "-" +
+        std::to_string(rd()) + s;
+      return (std::filesystem::temp_directory_path() / n).string();
+    }
+
+    /// %Test that streaming constraints yields the same solutions
+    class FznStream : public Base {
+    protected:
+      /// The model
+      std::string source;
+      /// Solve model after parsing it with \a parse, store output in \a out
+      template<class Parse>
+      bool solve(Parse parse, const std::vector<std::string>& args,
+                 std::string& out) {
+        Gecode::Support::Timer t_total;
+        t_total.start();
+        Gecode::FlatZinc::FlatZincOptions fznopt("Gecode/FlatZinc");
+        std::vector<std::string> a(args);
+        std::string cmd("fzn-gecode");
+        std::vector<char*> argv;
+        argv.push_back(const_cast<char*>(cmd.data()));
+        for (std::string& s : a)
+          argv.push_back(const_cast<char*>(s.data()));
+        int argc = static_cast<int>(argv.size());
+        fznopt.parse(argc, argv.data());
+        fznopt.allSolutions(true);
+        Gecode::FlatZinc::Printer p;
+        try {
+          std::unique_ptr<Gecode::FlatZinc::FlatZincSpace>
+            fg(parse(fznopt, p));
+          if (!fg) {
+            if (opt.log)
+              olog << ind(2) << "Could not parse input" << std::endl;
+            return false;
+          }
+          fg->createBranchers(p, fg->solveAnnotations(), fznopt,
+                              false, olog);
+          fg->shrinkArrays(p);
+          std::ostringstream os;
+          fg->run(os, p, fznopt, t_total);
+          out = os.str();
+          return true;
+        } catch (Gecode::FlatZinc::Error& e) {
+          if (opt.log)
+            olog << ind(2) << "FlatZinc error : " << e.toString() << std::endl;
+          return false;
+        }
+      }
+    public:
+      /// Create and register test for \a name and \a source0
+      FznStream(const std::string& name, const std::string& source0)
+        : Base("FlatZinc::fzn_stream::"+name), source(source0) {}
+      /// Perform test
+      virtual bool run(void) {
+        std::string fzn = temp_file_name(".fzn");
+        {
+          std::ofstream os(fzn.c_str(), std::ios::binary | std::ios::trunc);
+          os << source;
+        }
+        std::string expected, out, stat;
+        bool ok =
+          solve([&](Gecode::FlatZinc::FlatZincOptions&,
+                    Gecode::FlatZinc::Printer& p) {
+                  std::istringstream is(source);
+                  return Gecode::FlatZinc::parse(is, p, olog);
+                }, {}, expected) &&
+          solve([&](Gecode::FlatZinc::FlatZincOptions& o,
+                    Gecode::FlatZinc::Printer& p) {
+                  return Gecode::FlatZinc::parse(fzn, o, p, olog);
+                }, {"-fzn-stream"}, out) &&
+          solve([&](Gecode::FlatZinc::FlatZincOptions& o,
+                    Gecode::FlatZinc::Printer& p) {
+                  return Gecode::FlatZinc::parse(fzn, o, p, olog);
+                }, {"-fzn-stream", "-s"}, stat);
+        (void) std::remove(fzn.c_str());
+        if (!ok)
+          return false;
+        if (out != expected) {
+          if (opt.log)
+            olog << ind(2) << "Expected:\n" << expected
+                 << ind(2) << "Streamed:\n" << out;
+          return false;
+        }
+        if ((stat.find("%%%mzn-stat: parseTime=") == std::string::npos) ||
+            (stat.compare(0, expected.size(), expected) != 0)) {
+          if (opt.log)
+            olog << ind(2) << "Statistics:\n" << stat;
+          return false;
+        }
+        return true;
+      }
+    };
+
+    FznStream simple("simple",
+      "array[1..2] of int: c = [1,-1];\n"
+      "var 1..4: x :: output_var;\n"
+      "var 1..4: y :: output_var;\n"
+      "var 1..4: z :: output_var;\n"
+      "constraint int_lin_le(c,[x,y],-1);\n"
+      "constraint int_le(z,3);\n"
+      "constraint int_ne(y,z);\n"
+      "solve satisfy;\n");
+
+    FznStream alias("alias",
+      "var 1..4: x :: output_var;\n"
+      "var 2..5: y :: output_var;\n"
+      "var 1..4: z :: output_var;\n"
+      "var 1..4: w :: output_var;\n"
+      "constraint int_eq(x,y);\n"
+      "constraint int_le(x,3);\n"
+      "constraint int_lt(x,z);\n"
+      "constraint int_eq(z,w);\n"
+      "constraint int_ge(w,3);\n"
+      "solve satisfy;\n");
+
+    FznStream clauses("clauses",
+      "var bool: a :: output_var;\n"
+      "var bool: b :: output_var;\n"
+      "var bool: c :: output_var;\n"
+      "var 0..1: i :: output_var;\n"
+      "constraint bool_clause([a,b],[c]);\n"
+      "constraint bool2int(c,i);\n"
+      "constraint bool_clause([c],[a]);\n"
+      "constraint bool_eq(b,c);\n"
+      "solve satisfy;\n");
+
+    FznStream optimize("optimize",
+      "array[1..3] of int: w = [3,4,5];\n"
+      "array[1..3] of var 0..3: q :: output_array([1..3]);\n"
+      "var 0..40: v :: output_var;\n"
+      "constraint int_lin_le(w,q,12);\n"
+      "constraint int_lin_eq([4,5,6,-1],[q[1],q[2],q[3],v],0);\n"
+      "solve maximize v;\n");
+
+  }
+
+}}
+
+// STATISTICS: test-flatzinc
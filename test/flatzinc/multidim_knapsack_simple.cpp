@@ -60,6 +60,25 @@ solve maximize INT____00001;\n\
 ", "x = array1d(1..5, [0, 1, 0, 1, 1]);\n\
 ----------\n\
 ==========\n\
+");
+        (void) new FlatZincTest("multidim_knapsack_simple::incremental",
+"predicate bool_lin_ge(array [int] of int: a, array [int] of var bool: x, var int: c);\n\
+predicate bool_lin_gt(array [int] of int: a, array [int] of var bool: x, var int: c);\n\
+predicate bool_lin_lt(array [int] of int: a, array [int] of var bool: x, var int: c);\n\
+predicate bool_lin_ne(array [int] of int: a, array [int] of var bool: x, var int: c);\n\
+array [1..3] of int: Capacities = [5, 10, 15];\n\
+array [1..5] of int: Profits = [5, 6, 3, 7, 4];\n\
+array [1..15] of int: Weights = [2, 3, 2, 1, 4, 4, 1, 2, 5, 3, 2, 3, 1, 3, 5];\n\
+var 0..25: INT____00001 :: is_defined_var :: var_is_introduced;\n\
+array [1..5] of var 0..1: x :: output_array([1..5]);\n\
+constraint int_lin_eq([-1, 5, 6, 3, 7, 4], [INT____00001, x[1], x[2], x[3], x[4], x[5]], 0) :: defines_var(INT____00001) :: incremental;\n\
+constraint int_lin_le([2, 1, 1, 3, 1], [x[1], x[2], x[3], x[4], x[5]], 5) :: incremental;\n\
+constraint int_lin_le([2, 4, 5, 3, 5], [x[1], x[2], x[3], x[4], x[5]], 15) :: incremental;\n\
+constraint int_lin_le([3, 4, 2, 2, 3], [x[1], x[2], x[3], x[4], x[5]], 10) :: incremental;\n\
+solve maximize INT____00001;\n\
+", "x = array1d(1..5, [0, 1, 0, 1, 1]);\n\
+----------\n\
+==========\n\
 ");
       }
     };
@@ -97,6 +97,7 @@ namespace Test { namespace Int {
       Gecode::dom(*this,x,_x);
     Gecode::BoolVar b(*this,0,1);
     r = Gecode::Reify(b,Gecode::RM_EQV);
+    schedule(static_cast<Gecode::SchedulePolicy>(t->_rand(3U)));
     if (opt.log)
       olog << ind(2) << "Initial: x[]=" << x
            << std::endl;
@@ -113,6 +114,7 @@ namespace Test { namespace Int {
       Gecode::dom(*this,x,_x);
     Gecode::BoolVar b(*this,0,1);
     r = Gecode::Reify(b,rm);
+    schedule(static_cast<Gecode::SchedulePolicy>(t->_rand(3U)));
     if (opt.log)
       olog << ind(2) << "Initial: x[]=" << x
            << " b=" << r.var() << std::endl;
@@ -162,7 +162,8 @@ namespace Test {
       /**
        * \brief Create test space without reification
        *
-       * Creates \a n variables with domain \a d for test \a t.
+       * Creates \a n variables with domain \a d for test \a t. The
+       * propagators are scheduled with a random scheduling policy.
        *
        */
       TestSpace(int n, Gecode::IntSet& d, Test* t);
@@ -170,7 +171,8 @@ namespace Test {
        * \brief Create test space with reification
        *
        * Creates \a n variables with domain \a d for test \a t and stores
-       * the reification mode \a rm.
+       * the reification mode \a rm. The propagators are scheduled with a
+       * random scheduling policy.
        *
        */
       TestSpace(int n, Gecode::IntSet& d, Test* t, Gecode::ReifyMode rm);
@@ -437,6 +437,58 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test for clause database
+     class ClauseDB : public Test {
+     protected:
+       /// Clauses in DIMACS format
+       Gecode::IntArgs c;
+       /// Whether every variable occurs twice in the variable array
+       bool twice;
+     public:
+       /// Construct and register test
+       ClauseDB(const std::string& s, int n, const Gecode::IntArgs& c0,
+                bool t=false, Gecode::IntPropLevel ipl=Gecode::IPL_DEF)
+         : Test("Bool::ClauseDB::"+s+"::"+str(ipl),n,0,1,false,ipl),
+           c(c0), twice(t) {}
+       /// Check whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         int i = 0;
+         while (i < c.size()) {
+           bool sat = false;
+           for (; (i < c.size()) && (c[i] != 0); i++)
+             if (c[i] > 0)
+               sat = sat || (x[(c[i]-1) % x.size()] == 1);
+             else
+               sat = sat || (x[(-c[i]-1) % x.size()] == 0);
+           i++;
+           if (!sat)
+             return false;
+         }
+         return true;
+       }
+       /// Post constraint
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         int n = x.size();
+         BoolVarArgs b(twice ? 2*n : n);
+         for (int i=n; i--; ) {
+           b[i]=channel(home,x[i]);
+           if (twice)
+             b[i+n]=b[i];
+         }
+         clause(home, b, c, ipl);
+       }
+       /// Return clauses for a chain of ternary clauses over \a n variables
+       static Gecode::IntArgs chain(int n) {
+         Gecode::IntArgs c;
+         for (int i=0; i<n; i++) {
+           c << (i+1) << -((i+1) % n + 1);
+           c << (((i % 3) == 0) ? -1 : 1) * ((i+2) % n + 1) << 0;
+         }
+         return c;
+       }
+     };
+
      /// %Test for if-then-else-constraint
      class ITEInt : public Test {
      public:
@@ -533,6 +585,31 @@ namespace Test { namespace Int {
      };
 
      Create c;
+
+     ClauseDB cdb_chain_3("Chain::3",3,ClauseDB::chain(3));
+     ClauseDB cdb_chain_6("Chain::6",6,ClauseDB::chain(6));
+     ClauseDB cdb_chain_7_learn("Chain::7",7,ClauseDB::chain(7),
+                                false,Gecode::IPL_ADVANCED);
+     ClauseDB cdb_chain_6_twice("Chain::6::Twice",6,
+                                Gecode::IntArgs({1,-8,3,0, 7,2,-10,0,
+                                                 -1,-2,0, 4,-11,12,0,
+                                                 -9,5,-6,0, 6,-4}),true);
+     ClauseDB cdb_chain_6_twice_learn("Chain::6::Twice",6,
+                                      Gecode::IntArgs({1,-8,3,0, 7,2,-10,0,
+                                                       -1,-2,0, 4,-11,12,0,
+                                                       -9,5,-6,0, 6,-4}),
+                                      true,Gecode::IPL_ADVANCED);
+     ClauseDB cdb_simplify("Simplify",4,
+                           Gecode::IntArgs({1,1,-2,0, 2,-2,3,0, -3,0,
+                                            3,-1,4,-1,0, 2,4,-4,1}));
+     ClauseDB cdb_simplify_learn("Simplify",4,
+                                 Gecode::IntArgs({1,1,-2,0, 2,-2,3,0, -3,0,
+                                                  3,-1,4,-1,0, 2,4,-4,1}),
+                                 false,Gecode::IPL_ADVANCED);
+     ClauseDB cdb_unit("Unit",3,Gecode::IntArgs({-1,0, 2,0, 1,3}));
+     ClauseDB cdb_empty("Empty",3,Gecode::IntArgs({1,2,0, 0, 3}));
+     ClauseDB cdb_none("None",2,Gecode::IntArgs());
+
      ITEInt itebnd(Gecode::IPL_BND);
      ITEInt itedom(Gecode::IPL_DOM);
      ITEBool itebool;
@@ -573,6 +573,28 @@ namespace Test { namespace Int {
             }
           }
         }
+
+        // Time-table edge-finding and energetic reasoning
+        IntPropLevel ttef[] = {
+          static_cast<IntPropLevel>(IPL_BND | IPL_ADVANCED),
+          static_cast<IntPropLevel>(IPL_DOM | IPL_ADVANCED),
+          static_cast<IntPropLevel>(IPL_BND | IPL_BASIC_ADVANCED),
+          static_cast<IntPropLevel>(IPL_DOM | IPL_BASIC_ADVANCED)
+        };
+        for (IntPropLevel ipl : ttef) {
+          (void) new ManFixPCumulative(3,p5,u5,0,ipl);
+          for (int c=-3; c<4; c++) {
+            (void) new ManFixPCumulative(c,p1,u3,0,ipl);
+            (void) new ManFixPCumulative(c,p2,u2,0,ipl);
+            (void) new ManFixPCumulative(c,p3,u3,0,ipl);
+            (void) new ManFixPCumulative(c,p3,u4,0,ipl);
+            (void) new ManFixPCumulative(c,p4,u3,Gecode::Int::Limits::min,ipl);
+            (void) new ManFlexCumulative(c,0,2,u3,0,ipl);
+            (void) new ManFlexCumulative(c,3,5,u4,0,ipl);
+            (void) new ManFlexCumulative(c,3,5,u3,
+                                         Gecode::Int::Limits::min,ipl);
+          }
+        }
       }
     };
 
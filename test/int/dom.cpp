@@ -35,6 +35,9 @@
 
 #include "test/int.hh"
 
+#include <algorithm>
+#include <vector>
+
 namespace Test { namespace Int {
 
    /// %Tests for domain constraints
@@ -198,6 +201,298 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Space for testing the dense index of variable domains
+     class IndexSpace : public Gecode::Space {
+     public:
+       /// Variables under test
+       Gecode::IntVarArray x;
+       /// Create space with \a n variables with domain \a d
+       IndexSpace(int n, const Gecode::IntSet& d) : x(*this,n,d) {}
+       /// Constructor for cloning \a s
+       IndexSpace(IndexSpace& s) : Gecode::Space(s) {
+         x.update(*this,s.x);
+       }
+       /// Copy during cloning
+       virtual Gecode::Space* copy(void) {
+         return new IndexSpace(*this);
+       }
+     };
+
+     /// %Test for the dense index of variable domains with holes
+     class Index : public Base {
+     protected:
+       /// Operations performed on the variable
+       enum Op {
+         OP_NQ, OP_LQ, OP_GQ, OP_INTER, OP_MINUS, OP_NARROW
+       };
+       /// Minimum of the initial domain
+       int l;
+       /// Width of the initial domain
+       int w;
+       /// Reference domain: \f$l+i\f$ is included iff \a r[i] is true
+       std::vector<bool> r;
+       /// Whether \a v is included in the reference domain
+       bool in(int v) const {
+         return (v >= l) && (v < l+w) && r[static_cast<size_t>(v-l)];
+       }
+       /// Return size \a n, minimum \a mi, and maximum \a ma of reference
+       void info(unsigned int& n, int& mi, int& ma) const {
+         n = 0; mi = l+w; ma = l-1;
+         for (int v=l; v<l+w; v++)
+           if (in(v)) {
+             n++; mi = std::min(mi,v); ma = std::max(ma,v);
+           }
+       }
+       /// Check that \a x agrees with the reference domain
+       bool same(Gecode::Int::IntView x) const {
+         unsigned int n; int mi, ma;
+         info(n,mi,ma);
+         if ((x.size() != n) || (x.min() != mi) || (x.max() != ma)) {
+           olog << ind(3) << "Domain " << x << " has wrong size or bounds"
+                << std::endl;
+           return false;
+         }
+         bool range = true;
+         for (int v=l-2; v<l+w+2; v++) {
+           if (x.in(v) != in(v)) {
+             olog << ind(3) << "Domain " << x << " wrong for " << v
+                  << std::endl;
+             return false;
+           }
+           if ((v >= mi) && (v <= ma) && !in(v))
+             range = false;
+         }
+         Gecode::Int::ViewRanges<Gecode::Int::IntView> xr(x);
+         for (int v=l; v<l+w; ) {
+           if (!in(v)) {
+             v++; continue;
+           }
+           int u = v;
+           while (in(u+1))
+             u++;
+           if (!xr() || (xr.min() != v) || (xr.max() != u)) {
+             olog << ind(3) << "Domain " << x << " has wrong ranges"
+                  << std::endl;
+             return false;
+           }
+           ++xr; v = u+1;
+         }
+         if (xr() || (x.range() != range)) {
+           olog << ind(3) << "Domain " << x << " has wrong ranges"
+                << std::endl;
+           return false;
+         }
+         return true;
+       }
+       /// Perform operation \a o with values \a v on \a home and check it
+       bool op(IndexSpace& home, Op o, std::vector<int>& v) {
+         using namespace Gecode;
+         Int::IntView x(home.x[0]);
+         unsigned int n0; int mi0, ma0;
+         info(n0,mi0,ma0);
+         Iter::Values::Array a(v.data(),static_cast<int>(v.size()));
+         ModEvent me = ME_INT_NONE;
+         switch (o) {
+         case OP_NQ:
+           olog << ind(2) << "nq " << v[0] << std::endl;
+           me = x.nq(home,v[0]);
+           if (in(v[0]))
+             r[static_cast<size_t>(v[0]-l)] = false;
+           break;
+         case OP_LQ:
+           olog << ind(2) << "lq " << v[0] << std::endl;
+           me = x.lq(home,v[0]);
+           for (int u=std::max(v[0]+1,l); u<l+w; u++)
+             r[static_cast<size_t>(u-l)] = false;
+           break;
+         case OP_GQ:
+           olog << ind(2) << "gq " << v[0] << std::endl;
+           me = x.gq(home,v[0]);
+           for (int u=l; u<std::min(v[0],l+w); u++)
+             r[static_cast<size_t>(u-l)] = false;
+           break;
+         case OP_INTER: case OP_NARROW:
+           {
+             olog << ind(2) << ((o == OP_INTER) ? "inter_v" : "narrow_v")
+                  << " " << v.size() << " values in ["
+                  << (v.empty() ? 0 : v.front()) << ".."
+                  << (v.empty() ? 0 : v.back()) << "]" << std::endl;
+             me = (o == OP_INTER) ?
+               x.inter_v(home,a,false) : x.narrow_v(home,a,false);
+             std::vector<bool> n(r.size(),false);
+             for (int u : v)
+               if (in(u))
+                 n[static_cast<size_t>(u-l)] = true;
+             r = n;
+           }
+           break;
+         case OP_MINUS:
+           olog << ind(2) << "minus_v " << v.size() << " values in ["
+                << (v.empty() ? 0 : v.front()) << ".."
+                << (v.empty() ? 0 : v.back()) << "]" << std::endl;
+           me = x.minus_v(home,a,false);
+           for (int u : v)
+             if (in(u))
+               r[static_cast<size_t>(u-l)] = false;
+           break;
+         default: GECODE_NEVER;
+         }
+         unsigned int n1; int mi1, ma1;
+         info(n1,mi1,ma1);
+         ModEvent e;
+         if (n1 == 0U)
+           e = ME_INT_FAILED;
+         else if (n1 == n0)
+           e = ME_INT_NONE;
+         else if (n1 == 1U)
+           e = ME_INT_VAL;
+         else if ((mi1 != mi0) || (ma1 != ma0))
+           e = ME_INT_BND;
+         else
+           e = ME_INT_DOM;
+         if (me != e) {
+           olog << ind(3) << "Modification event " << me
+                << " instead of " << e << std::endl;
+           return false;
+         }
+         return (me == ME_INT_FAILED) || same(x);
+       }
+       /// Return sorted values from \a mi to \a ma, each with probability \a p/8
+       std::vector<int> values(int mi, int ma, unsigned int p, bool dom) {
+         std::vector<int> v;
+         for (int u=mi; u<=ma; u++)
+           if ((!dom || in(u)) && (_rand(8U) < p))
+             v.push_back(u);
+         return v;
+       }
+     public:
+       /// Create and register test with initial domain \f$[l_0,l_0+w_0-1]\f$
+       Index(int l0, int w0)
+         : Base("Int::Dom::Index::"+str(w0)), l(l0), w(w0) {}
+       /// Run test
+       virtual bool run(void) {
+         using namespace Gecode;
+         IndexSpace* s = new IndexSpace(1,IntSet(l,l+w-1));
+         r.assign(static_cast<size_t>(w),true);
+         // Create a hole, remove it again, and create a new hole
+         int m = l+w/2;
+         std::vector<int> v0({m}), v1({m+1}), v2({m+3});
+         if (!op(*s,OP_NQ,v0) || !op(*s,OP_GQ,v1) || !op(*s,OP_NQ,v2) ||
+             !op(*s,OP_NQ,v2)) {
+           delete s; return false;
+         }
+         while (true) {
+           Int::IntView x(s->x[0]);
+           if (x.assigned())
+             break;
+           int mi = x.min(), ma = x.max();
+           std::vector<int> v;
+           Op o;
+           switch (_rand(8U)) {
+           case 0: case 1:
+             // Also values that are already removed or outside the bounds
+             o = OP_NQ; v.push_back(mi-2+static_cast<int>(_rand(x.width()+4U)));
+             break;
+           case 2:
+             o = OP_LQ; v.push_back(mi+static_cast<int>(_rand(x.width())));
+             break;
+           case 3:
+             o = OP_GQ; v.push_back(mi+static_cast<int>(_rand(x.width())));
+             break;
+           case 4:
+             // Iterator might start and end outside the bounds
+             o = OP_INTER; v = values(mi-3,ma+3,7U,false);
+             break;
+           case 5:
+             o = OP_NARROW; v = values(mi,ma,7U,true);
+             break;
+           default:
+             // Iterator might start and end outside the bounds
+             o = OP_MINUS; v = values(mi-3,ma+3,1U,false);
+             break;
+           }
+           if (((o == OP_INTER) || (o == OP_NARROW)) && v.empty())
+             continue;
+           if (!op(*s,o,v)) {
+             delete s; return false;
+           }
+           if (s->failed())
+             break;
+           if (_rand(16U) == 0U) {
+             // Cloning rebuilds the index
+             (void) s->status();
+             IndexSpace* c = static_cast<IndexSpace*>(s->clone());
+             delete s; s = c;
+             if (!same(Int::IntView(s->x[0]))) {
+               delete s; return false;
+             }
+           }
+         }
+         delete s;
+         return true;
+       }
+     };
+
+     /// %Test for the memory used by the dense index
+     class IndexMemory : public Base {
+     protected:
+       /// Number of variables
+       static const int n = 64;
+       /// Return memory used by a clone of \a s
+       static unsigned long long int memory(IndexSpace& s) {
+         (void) s.status();
+         Gecode::CloneStatistics cs;
+         delete s.clone(cs);
+         return cs.copied;
+       }
+     public:
+       /// Create and register test
+       IndexMemory(void) : Base("Int::Dom::Index::Memory") {}
+       /// Run test
+       virtual bool run(void) {
+         using namespace Gecode;
+         // Maximal width of indexed domains (IntVarImp::idx_width)
+         const unsigned int w = 512U;
+         // Values removed from the domains
+         std::vector<int> h;
+         for (int v=1; v<static_cast<int>(w); v+=4)
+           h.push_back(v);
+         // Remove values one at a time: width w is indexed, w+1 is not
+         IndexSpace a(n,IntSet(0,static_cast<int>(w)-1));
+         IndexSpace b(n,IntSet(0,static_cast<int>(w)));
+         for (int i=0; i<n; i++)
+           for (int v : h) {
+             Iter::Values::Singleton va(v), vb(v);
+             if ((Int::IntView(a.x[i]).minus_v(a,va,false) != ME_INT_DOM) ||
+                 (Int::IntView(b.x[i]).minus_v(b,vb,false) != ME_INT_DOM))
+               return false;
+           }
+         // Same domains, but created directly
+         IntArgs d;
+         for (int v=0; v<static_cast<int>(w); v++)
+           if (!std::binary_search(h.begin(),h.end(),v))
+             d << v;
+         IndexSpace c(n,IntSet(d));
+         unsigned long long int ma = memory(a);
+         unsigned long long int mb = memory(b);
+         unsigned long long int mc = memory(c);
+         unsigned long long int mi = static_cast<unsigned long long int>
+           (Support::BitSetData::data(w) * sizeof(Support::BitSetData));
+         olog << ind(2) << "Memory: indexed " << ma << ", directly created "
+              << mc << ", not indexed " << mb << ", index per variable "
+              << mi << std::endl;
+         return (ma == mc) && (ma > mb) && (ma - mb <= n * mi);
+       }
+     };
+
+     Index ix16(-10,16);
+     Index ix64(-33,64);
+     Index ix100(-50,100);
+     Index ix511(-256,511);
+     Index ix512(-256,512);
+     Index ix513(-256,513);
+     IndexMemory ixm;
+
      DomInt di1(1);
      DomInt di3(3);
      DomRange dr1(1);
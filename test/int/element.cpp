@@ -109,6 +109,27 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test for element with the same shared integer array posted twice
+     class IntIntVarTwice : public Test {
+     protected:
+       /// Shared array of integers
+       Gecode::IntSharedArray c;
+     public:
+       /// Create and register test
+       IntIntVarTwice(const std::string& s, const Gecode::IntArgs& c0)
+         : Test("Element::Int::Int::Var::Twice::"+s,3,-2,4), c(c0) {}
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         return (x[0]>= 0) && (x[0]<c.size()) && c[x[0]]==x[2] &&
+           (x[1]>= 0) && (x[1]<c.size()) && c[x[1]]==x[2];
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         Gecode::element(home, c, x[0], x[2]);
+         Gecode::element(home, c, x[1], x[2]);
+       }
+     };
+
      /// %Test for element with integer array and integer and Boolean variable
      class IntBoolVar : public Test {
      protected:
@@ -563,6 +584,24 @@ namespace Test { namespace Int {
            (void) new IntIntInt("D",ic4,i);
          }
 
+         // Large arrays use a shared index
+         IntArgs lc1(300), lc2(300), lbc(300);
+         for (int i=0; i<300; i++) {
+           lc1[i] = (i*7) % 13 - 6;
+           lc2[i] = (i < 290) ? 100+i : (i*5) % 7 + 287;
+           lbc[i] = (i*11) % 3 == 1;
+         }
+         (void) new IntIntVar("Large::A",lc1,-8,8);
+         (void) new IntIntVar("Large::B",lc2,286,293);
+         (void) new IntIntVar("Large::C",lc2,-4,4);
+         (void) new IntIntVarTwice("Large",lc1);
+         for (int i=-4; i<=4; i++)
+           (void) new IntIntInt("Large",lc1,i);
+         (void) new IntIntShared("Large",lc1);
+         (void) new IntBoolVar("Large",lbc);
+         for (int i=0; i<=1; i++)
+           (void) new IntBoolInt("Large",lbc,i);
+
          (void) new IntIntShared("A",ic1);
          (void) new IntIntShared("B",ic2);
          (void) new IntIntShared("C",ic3);
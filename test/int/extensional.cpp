@@ -38,10 +38,18 @@
 #include "test/int.hh"
 
 #include <gecode/minimodel.hh>
+#include <gecode/int/extensional.hh>
 #include <climits>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <random>
 #include <string>
+#include <vector>
 
 namespace Test { namespace Int {
 
@@ -70,6 +78,19 @@ namespace Test { namespace Int {
        }
      }
 
+     /// Return name suffix for word kernels \a wk
+     std::string
+     word_kernel_name(Gecode::Int::Extensional::WordKernel wk) {
+       switch (wk) {
+       case Gecode::Int::Extensional::WK_AVX2:
+         return "::AVX2";
+       case Gecode::Int::Extensional::WK_AVX512:
+         return "::AVX512";
+       default:
+         return "";
+       }
+     }
+
      /// %Test with simple regular expression
      class RegSimpleA : public Test {
      public:
@@ -393,6 +414,203 @@ namespace Test { namespace Int {
      };
 
      ///% Transform a TupleSet into a DFA
+     /// Return fresh name for a temporary file
+     std::string
+     temp_file_name(void) {
+       std::random_device rd;
+       std::string n = "gecode-test-" + std::to_string(rd()) + "-" +
+         std::to_string(rd()) + ".bin";
+       return (std::filesystem::temp_directory_path() / n).string();
+     }
+
+     /// Return DFA \a d after saving it to and loading it from a file
+     Gecode::DFA
+     file_dfa(const Gecode::DFA& d) {
+       std::string fn = temp_file_name();
+       d.save(fn);
+       Gecode::DFA l = Gecode::DFA::load(fn);
+       (void) std::remove(fn.c_str());
+       return l;
+     }
+
+     /// Return tuple set \a ts after saving it to and loading it from a file
+     Gecode::TupleSet
+     file_tuple_set(const Gecode::TupleSet& ts) {
+       std::string fn = temp_file_name();
+       ts.save(fn);
+       Gecode::TupleSet l = Gecode::TupleSet::load(fn);
+       (void) std::remove(fn.c_str());
+       return l;
+     }
+
+     /// %Test with simple regular expression via a DFA loaded from a file
+     class RegFile : public Test {
+     public:
+       /// Create and register test
+       RegFile(void) : Test("Extensional::Reg::File",4,2,2) {}
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         return (((x[0] == 0) || (x[0] == 2)) &&
+                 ((x[1] == -1) || (x[1] == 1)) &&
+                 ((x[2] == 0) || (x[2] == 1)) &&
+                 ((x[3] == 0) || (x[3] == 1)));
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         DFA d((REG(0) | REG(2)) +
+               (REG(-1) | REG(1)) +
+               (REG(7) | REG(0) | REG(1)) +
+               (REG(0) | REG(1)));
+         DFA l = file_dfa(d);
+         assert(d == l);
+         extensional(home, x, l);
+       }
+     };
+
+     /// %Test with simple regular expression via a reduced MDD
+     class MDDSimpleA : public Test {
+     public:
+       /// Create and register test
+       MDDSimpleA(void) : Test("Extensional::MDD::Simple::A",4,2,2) {}
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         return (((x[0] == 0) || (x[0] == 2)) &&
+                 ((x[1] == -1) || (x[1] == 1)) &&
+                 ((x[2] == 0) || (x[2] == 1)) &&
+                 ((x[3] == 0) || (x[3] == 1)));
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         MDD m(4, DFA((REG(0) | REG(2)) +
+                      (REG(-1) | REG(1)) +
+                      (REG(7) | REG(0) | REG(1)) +
+                      (REG(0) | REG(1))));
+         extensional(home, x, m);
+       }
+     };
+
+     /// %Test with regular expression from Roland Yap via a reduced MDD
+     class MDDRoland : public Test {
+     public:
+       /// Create and register test
+       MDDRoland(int n)
+         : Test("Extensional::MDD::Roland::"+str(n),n,0,1) {}
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         int n = x.size();
+         return
+           ((n > 1) && (x[n-2] == 0)) ||
+           ((n > 0) && (x[n-1] == 0));
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         REG r0(0), r1(1);
+         REG r01 = r0 | r1;
+         extensional(home, x, MDD(x.size(), DFA(*r01 + r0 + r01(0,1))));
+       }
+     };
+
+     /// %Test with an MDD built from a tuple set
+     class MDDTupleSet : public Test {
+     public:
+       /// Create and register test
+       MDDTupleSet(void) : Test("Extensional::MDD::TupleSet",4,0,2) {}
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         int s = 0;
+         for (int i=0; i<x.size(); i++)
+           s += x[i];
+         return (s % 3 == 1) && (x[0] <= x[3]);
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         TupleSet t(4);
+         for (int a=0; a<=2; a++)
+           for (int b=0; b<=2; b++)
+             for (int c=0; c<=2; c++)
+               for (int d=0; d<=2; d++)
+                 if (((a+b+c+d) % 3 == 1) && (a <= d))
+                   t.add({a,b,c,d});
+         t.finalize();
+         extensional(home, x, MDD(t));
+       }
+     };
+
+     /// %Test with the intersection of two MDDs
+     class MDDIntersect : public Test {
+     public:
+       /// Create and register test
+       MDDIntersect(void) : Test("Extensional::MDD::Intersect",4,-1,3) {}
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         for (int i=0; i<x.size(); i++)
+           if ((x[i] < 0) || (x[i] > 2))
+             return false;
+         return (x[0] != 1) && (x[1] <= x[2]);
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         REG r(IntArgs({0,1,2}));
+         REG r02 = REG(0) | REG(2);
+         MDD a(4, DFA(r02 + r + r + r));
+         MDD b(4, DFA(r + ((REG(0) + r) | (REG(1) + (REG(1) | REG(2))) |
+                           (REG(2) + REG(2))) + r));
+         MDD c = a & b;
+         extensional(home, x, c);
+         // The same MDD can be shared by several propagators
+         extensional(home, x, c);
+       }
+     };
+
+     /// %Test with an MDD that has no solutions
+     class MDDEmpty : public Test {
+     public:
+       /// Create and register test
+       MDDEmpty(void) : Test("Extensional::MDD::Empty",3,0,1) {}
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment&) const {
+         return false;
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         MDD a(3, DFA(REG(0)(3,3)));
+         MDD b(3, DFA(REG(1)(3,3)));
+         a &= b;
+         assert(a.empty());
+         extensional(home, x, a);
+       }
+     };
+
+     /// %Test with an MDD on Boolean variables
+     class MDDBool : public Test {
+     public:
+       /// Create and register test
+       MDDBool(void) : Test("Extensional::MDD::Bool",5,0,1) {}
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         int s = 0;
+         for (int i=0; i<x.size(); i++)
+           s += x[i];
+         return (s == 2) && (x[0] == 0);
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         BoolVarArgs y(x.size());
+         for (int i = x.size(); i--; )
+           y[i] = channel(home, x[i]);
+         MDD m(x.size(), DFA(REG(0) + *REG(0) + REG(1) +
+                             *REG(0) + REG(1) + *REG(0)));
+         extensional(home, y, m);
+       }
+     };
+
      Gecode::DFA tupleset2dfa(Gecode::TupleSet ts) {
        using namespace Gecode;
        REG expression;
@@ -473,15 +691,28 @@ namespace Test { namespace Int {
        Gecode::TupleSet ts;
        /// Whether to validate dfa2tupleset
        bool toDFA;
+       /// Word kernels to use
+       Gecode::Int::Extensional::WordKernel wk;
      public:
        /// Create and register test
        TupleSetTest(const std::string& s, bool p,
                     Gecode::IntSet d0, Gecode::TupleSet ts0, bool td,
-                    Gecode::ExtensionalPropKind epk0)
+                    Gecode::ExtensionalPropKind epk0,
+                    Gecode::Int::Extensional::WordKernel wk0 =
+                      Gecode::Int::Extensional::WK_SCALAR)
          : Test("Extensional::TupleSet::" + extensional_kind_name(epk0) +
-                "::" + str(p) + "::" + s,
+                "::" + str(p) + "::" + s + word_kernel_name(wk0),
                 ts0.arity(),d0,true,Gecode::IPL_DOM),
-           pos(p), epk(epk0), ts(ts0), toDFA(td) {
+           pos(p), epk(epk0), ts(ts0), toDFA(td), wk(wk0) {
+       }
+       /// Perform test with the word kernels \a wk
+       virtual bool run(void) {
+         using namespace Gecode::Int::Extensional;
+         WordKernel o = word_kernel();
+         (void) word_kernel(wk);
+         bool r = Test::run();
+         (void) word_kernel(o);
+         return r;
        }
        /// %Test whether \a x is solution
        virtual bool solution(const Assignment& x) const {
@@ -520,8 +751,10 @@ namespace Test { namespace Int {
        /// Create and register test
        RandomTupleSetTest(const std::string& s, bool p,
                           Gecode::IntSet d0, Gecode::TupleSet ts0,
-                          Gecode::ExtensionalPropKind epk0)
-         : TupleSetTest(s,p,d0,ts0,false,epk0) {
+                          Gecode::ExtensionalPropKind epk0,
+                          Gecode::Int::Extensional::WordKernel wk0 =
+                            Gecode::Int::Extensional::WK_SCALAR)
+         : TupleSetTest(s,p,d0,ts0,false,epk0,wk0) {
          testsearch = false;
        }
        /// Create and register initial assignment
@@ -531,6 +764,39 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test with tuple set saved to and loaded from a file
+     class TupleSetFileTest : public TupleSetTest {
+     protected:
+       /// The tuple set loaded from file (loaded on first use)
+       Gecode::TupleSet lts;
+       /// Return the loaded tuple set
+       const Gecode::TupleSet& loaded(void) {
+         if (!lts) {
+           lts = file_tuple_set(ts);
+           assert(lts == ts);
+           assert(lts.representation() == ts.representation());
+         }
+         return lts;
+       }
+     public:
+       /// Create and register test
+       TupleSetFileTest(const std::string& s, bool p,
+                        Gecode::IntSet d0, Gecode::TupleSet ts0,
+                        Gecode::ExtensionalPropKind epk0)
+         : TupleSetTest(s + "::File",p,d0,ts0,false,epk0) {}
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         extensional(home, x, loaded(), pos, ipl);
+       }
+       /// Post reified constraint on \a x for \a r
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x,
+                         Gecode::Reify r) {
+         using namespace Gecode;
+         extensional(home, x, loaded(), pos, r, ipl);
+       }
+     };
+
      /// Sparse smoke test for very low-density unary tuple sets
      class SparseTupleSetUnary : public ::Test::Base {
      public:
@@ -1315,6 +1581,231 @@ namespace Test { namespace Int {
        }
      };
 
+     /// Binary files preserve tuple sets and DFAs and reject bad input
+     class TupleSetFile : public ::Test::Base {
+     public:
+       TupleSetFile(void)
+         : ::Test::Base("Int::Extensional::TupleSet::File") {}
+
+       virtual bool run(void) {
+         using namespace Gecode;
+
+         for (ExtensionalPropKind epk :
+                { EPK_DENSE, EPK_SPARSE, EPK_DENSE_COMPRESSED }) {
+           TupleSet ts(3);
+           for (int i=0; i<200; i++)
+             ts.add({i % 7, (3*i) % 11 - 5, i});
+           ts.finalize(epk);
+           TupleSet l = file_tuple_set(ts);
+           if ((l.representation() != epk) || (l != ts) ||
+               (l.hash() != ts.hash()) || (l.words() != ts.words()))
+             return false;
+           for (int a=0; a<3; a++) {
+             TupleSet::Ranges r(ts,a), q(l,a);
+             for (; r() && q(); ++r, ++q)
+               if ((r.min() != q.min()) || (r.max() != q.max()))
+                 return false;
+             if (r() || q())
+               return false;
+           }
+           TupleSet e(2);
+           e.finalize(epk);
+           TupleSet le = file_tuple_set(e);
+           if ((le.tuples() != 0) || (le.arity() != 2) ||
+               (le.representation() != epk))
+             return false;
+         }
+
+         DFA d((REG(0) + REG(1)) | (REG(2) + REG(3)));
+         DFA ld = file_dfa(d);
+         if ((ld != d) || (ld.hash() != d.hash()) ||
+             (ld.symbol_min() != 0) || (ld.symbol_max() != 3))
+           return false;
+
+         std::string fn = temp_file_name();
+         try {
+           TupleSet u(2);
+           u.add({1,2});
+           u.save(fn);
+           return false;
+         } catch (const Gecode::Int::NotYetFinalized&) {
+         }
+         try {
+           (void) TupleSet::load(fn);
+           return false;
+         } catch (const Gecode::Int::InvalidFile&) {
+         }
+         // A DFA file is not a tuple set file
+         d.save(fn);
+         try {
+           (void) TupleSet::load(fn);
+           (void) std::remove(fn.c_str());
+           return false;
+         } catch (const Gecode::Int::InvalidFile&) {
+         }
+         // Truncated files are rejected
+         {
+           TupleSet ts(2);
+           for (int i=0; i<100; i++)
+             ts.add({i, i+1});
+           ts.finalize();
+           ts.save(fn);
+           std::filesystem::resize_file
+             (fn, std::filesystem::file_size(fn) / 2U);
+           try {
+             (void) TupleSet::load(fn);
+             (void) std::remove(fn.c_str());
+             return false;
+           } catch (const Gecode::Int::InvalidFile&) {
+           }
+         }
+         (void) std::remove(fn.c_str());
+         return true;
+       }
+     };
+
+     /// Corrupted and truncated binary files are rejected
+     class TupleSetFileCorrupt : public ::Test::Base {
+     protected:
+       /// Size of the file header
+       static const std::size_t header = 128U;
+       /// Return contents of file \a fn
+       static std::string read(const std::string& fn) {
+         std::ifstream is(fn.c_str(), std::ios::in | std::ios::binary);
+         return std::string(std::istreambuf_iterator<char>(is),
+                            std::istreambuf_iterator<char>());
+       }
+       /// Write \a b to file \a fn
+       static void write(const std::string& fn, const std::string& b) {
+         std::ofstream os(fn.c_str(), std::ios::out | std::ios::binary |
+                          std::ios::trunc);
+         os.write(b.data(), static_cast<std::streamsize>(b.size()));
+       }
+       /// Return \a b with the 32 bit word at \a i replaced by \a f of it
+       template<class F>
+       static std::string word(std::string b, std::size_t i, F f) {
+         unsigned int w;
+         std::memcpy(&w, b.data()+i, sizeof(w));
+         w = f(w);
+         std::memcpy(&b[i], &w, sizeof(w));
+         return b;
+       }
+       /// Return \a b with header field \a i set to \a v
+       static std::string field(std::string b, int i,
+                                unsigned long long v) {
+         std::uint64_t w = v;
+         std::memcpy(&b[32U+8U*static_cast<std::size_t>(i)], &w, sizeof(w));
+         return b;
+       }
+       /// Check that the tuple set in \a b is rejected or equal to \a ts
+       static bool tuple_set(const std::string& fn, const std::string& b,
+                             const Gecode::TupleSet& ts) {
+         write(fn, b);
+         try {
+           Gecode::TupleSet l = Gecode::TupleSet::load(fn);
+           return l == ts;
+         } catch (const Gecode::Int::InvalidFile&) {
+           return true;
+         }
+       }
+       /// Check that the DFA in \a b is rejected
+       static bool rejected(const std::string& fn, const std::string& b) {
+         write(fn, b);
+         try {
+           (void) Gecode::DFA::load(fn);
+           return false;
+         } catch (const Gecode::Int::InvalidFile&) {
+           return true;
+         }
+       }
+     public:
+       TupleSetFileCorrupt(void)
+         : ::Test::Base("Int::Extensional::TupleSet::File::Corrupt") {}
+
+       virtual bool run(void) {
+         using namespace Gecode;
+         std::string fn = temp_file_name();
+         bool ok = true;
+
+         for (ExtensionalPropKind epk :
+                {EPK_DENSE, EPK_SPARSE, EPK_DENSE_COMPRESSED}) {
+           TupleSet ts(3);
+           for (int i=0; i<70; i++)
+             ts.add({i % 5, (3*i) % 7, (i < 35) ? i % 3 : 8 + i % 2});
+           ts.finalize(epk);
+           ts.save(fn);
+           const std::string b = read(fn);
+           // Every truncation is rejected
+           for (std::size_t n=0U; ok && (n<b.size()); n += 4U) {
+             write(fn, b.substr(0U,n));
+             try {
+               (void) TupleSet::load(fn);
+               ok = false;
+             } catch (const Gecode::Int::InvalidFile&) {
+             }
+           }
+           // Every corrupted word of the sections is rejected unless it
+           // is padding
+           for (std::size_t i=header; ok && (i+4U<=b.size()); i += 4U)
+             ok = tuple_set(fn, word(b, i, [](unsigned int w) {
+                   return w+1U;
+                 }), ts) &&
+               tuple_set(fn, word(b, i, [](unsigned int) {
+                   return 0x7fffffffU;
+                 }), ts) &&
+               tuple_set(fn, word(b, i, [](unsigned int w) {
+                   return w-1U;
+                 }), ts);
+         }
+
+         // Header fields that size data structures must match the
+         // transitions of a DFA
+         if (ok) {
+           REG r = (REG(0) + REG(1) + REG(2)) | (REG(1) + REG(2)(0,3)) |
+             REG(5)(2,4);
+           DFA d(r);
+           d.save(fn);
+           const std::string b = read(fn);
+           ok = rejected(fn, field(b, 1, d.n_symbols() - 1U)) &&
+             rejected(fn, field(b, 1, d.n_symbols() + 1U)) &&
+             rejected(fn, field(b, 1, 1ULL << 30)) &&
+             rejected(fn, field(b, 3, d.max_degree() - 1U)) &&
+             rejected(fn, field(b, 3, d.max_degree() + 1U)) &&
+             rejected(fn, field(b, 0, d.n_transitions() + 2U)) &&
+             rejected(fn, b.substr(0U, b.size()-1U));
+           // Corrupted transitions are rejected or yield a usable DFA
+           for (std::size_t i=header; ok && (i+4U<=b.size()); i += 4U)
+             for (unsigned int v : {1U, 0x7fffffffU}) {
+               write(fn, word(b, i, [v](unsigned int w) {
+                     return (v == 1U) ? w+1U : v;
+                   }));
+               try {
+                 DFA l = DFA::load(fn);
+                 class Use : public Space {
+                 public:
+                   IntVarArray x;
+                   Use(const DFA& e) : x(*this,4,-1,6) {
+                     extensional(*this, x, e);
+                   }
+                   Use(Use& s) : Space(s) {
+                     x.update(*this, s.x);
+                   }
+                   virtual Space* copy(void) {
+                     return new Use(*this);
+                   }
+                 };
+                 Use* u = new Use(l);
+                 (void) u->status();
+                 delete u;
+               } catch (const Gecode::Int::InvalidFile&) {
+               }
+             }
+         }
+         (void) std::remove(fn.c_str());
+         return ok;
+       }
+     };
+
      /// Disabled compact propagators preserve pending work when cloned
      class TupleSetDisabledClone : public ::Test::Base {
      public:
@@ -1982,6 +2473,16 @@ namespace Test { namespace Int {
          Gecode::Support::RandomGenerator rand(42);
 
          using namespace Gecode;
+         // Word kernels supported by the processor
+         std::vector<Gecode::Int::Extensional::WordKernel> wks;
+         {
+           using namespace Gecode::Int::Extensional;
+           WordKernel o = word_kernel();
+           for (WordKernel wk : {WK_SCALAR, WK_AVX2, WK_AVX512})
+             if (word_kernel(wk) == wk)
+               wks.push_back(wk);
+           (void) word_kernel(o);
+         }
          for (ExtensionalPropKind epk :
                 { EPK_DENSE, EPK_SPARSE, EPK_DENSE_COMPRESSED }) {
            for (bool pos : { false, true }) {
@@ -1994,11 +2495,13 @@ namespace Test { namespace Int {
                .add({1, 5, 2, 5}).add({5, 3, 3, 2})
                .finalize(epk);
              (void) new TupleSetTest("A",pos,IntSet(0,6),ts,true,epk);
+             (void) new TupleSetFileTest("A",pos,IntSet(0,6),ts,epk);
            }
            {
              TupleSet ts(4);
              ts.finalize(epk);
              (void) new TupleSetTest("Empty",pos,IntSet(1,2),ts,true,epk);
+             (void) new TupleSetFileTest("Empty",pos,IntSet(1,2),ts,epk);
            }
            {
              TupleSet ts(4);
@@ -2040,6 +2543,9 @@ namespace Test { namespace Int {
              (void) new TupleSetTest("MinMax",pos,
                                      IntSet(IntArgs({m,m+1,m+4,M-3,M-2,M})),
                                      ts,true,epk);
+             (void) new TupleSetFileTest("MinMax",pos,
+                                         IntSet(IntArgs({m,m+1,m+4,M-3,M-2,M})),
+                                         ts,epk);
            }
            {
              TupleSet ts(7);
@@ -2053,7 +2559,9 @@ namespace Test { namespace Int {
                ts.add(tuple);
              }
              ts.finalize(epk);
-             (void) new RandomTupleSetTest("Triangle",pos,IntSet(0,6),ts,epk);
+             for (Gecode::Int::Extensional::WordKernel wk : wks)
+               (void) new RandomTupleSetTest("Triangle",pos,IntSet(0,6),ts,
+                                             epk,wk);
            }
            {
              for (int i = 0; i <= 64*6; i+=32)
@@ -2062,11 +2570,11 @@ namespace Test { namespace Int {
            {
              const double prob_small =
                (epk == EPK_DENSE) ? 0.05 : 0.01;
-             (void) new RandomTupleSetTest("Rand(10,-1,2)", pos,
-                                           IntSet(-1,2),
-                                           randomTupleSet(10, -1, 2, prob_small,
-                                                          epk, rand),
-                                           epk);
+             TupleSet small = randomTupleSet(10, -1, 2, prob_small,
+                                             epk, rand);
+             for (Gecode::Int::Extensional::WordKernel wk : wks)
+               (void) new RandomTupleSetTest("Rand(10,-1,2)", pos,
+                                             IntSet(-1,2), small, epk, wk);
              if (epk == EPK_DENSE)
                (void) new RandomTupleSetTest("Rand(5,-10,10)", pos,
                                              IntSet(-10,10),
@@ -2115,7 +2623,9 @@ namespace Test { namespace Int {
              t.add({1,1,1,1,1,1,1,1,1,1});
              t.add({1,2,3,4,4,2,1,2,3,3});
              t.finalize(epk);
-             (void) new RandomTupleSetTest("FewHuge",pos,IntSet(1,4),t,epk);
+             for (Gecode::Int::Extensional::WordKernel wk : wks)
+               (void) new RandomTupleSetTest("FewHuge",pos,IntSet(1,4),t,
+                                             epk,wk);
            }
            (void) new TupleSetBase(pos,epk);
            (void) new TupleSetLarge(0.05,pos,epk);
@@ -2155,6 +2665,16 @@ namespace Test { namespace Int {
      RegOpt ro6(static_cast<int>(USHRT_MAX-1));
      RegOpt ro7(static_cast<int>(USHRT_MAX));
 
+     RegFile rf;
+
+     MDDSimpleA mdd_sa;
+     MDDRoland mdd_r1(1);
+     MDDRoland mdd_r4(4);
+     MDDTupleSet mdd_ts;
+     MDDIntersect mdd_i;
+     MDDEmpty mdd_e;
+     MDDBool mdd_b;
+
      SparseTupleSetUnary sparse_tuple_set_unary;
      SparseTupleSetTernary sparse_tuple_set_ternary;
      SparseTupleSetHighArity sparse_tuple_set_high_arity;
@@ -2170,6 +2690,8 @@ namespace Test { namespace Int {
      TupleSetSupportOffsetBoundary tuple_set_support_offset_boundary;
      TupleSetTerminalFinalizationFailure tuple_set_terminal_failure;
      TupleSetDFARepresentation tuple_set_dfa_representation;
+     TupleSetFile tuple_set_file;
+     TupleSetFileCorrupt tuple_set_file_corrupt;
      TupleSetDisabledClone tuple_set_disabled_clone;
      TupleSetAutoDefaultDispatch tuple_set_auto_default_dispatch;
      DenseCompressedTupleSetWideGap dense_compressed_tuple_set_wide_gap;
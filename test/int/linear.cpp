@@ -331,6 +331,22 @@ namespace Test { namespace Int {
                (void) new IntVar("14",d1,a4,IRT_EQ,IPL_DOM);
                (void) new IntVar("15",d1,a5,IRT_EQ,IPL_DOM);
              }
+             // Incremental propagators
+             IntPropLevel ia =
+               static_cast<IntPropLevel>(IPL_BND | IPL_ADVANCED);
+             for (IntRelTypes irts; irts(); ++irts) {
+               (void) new IntInt("12",d1,a2,irts.irt(),0,ia);
+               (void) new IntInt("13",d1,a3,irts.irt(),0,ia);
+               (void) new IntInt("14",d1,a4,irts.irt(),0,ia);
+               (void) new IntInt("15",d1,a5,irts.irt(),0,ia);
+               (void) new IntInt("23",d2,a3,irts.irt(),0,ia);
+               (void) new IntInt("25",d2,a5,irts.irt(),0,ia);
+               (void) new IntInt("32",d3,a2,irts.irt(),1500000000,ia);
+               if (i < 5) {
+                 (void) new IntVar("13",d1,a3,irts.irt(),ia);
+                 (void) new IntVar("25",d2,a5,irts.irt(),ia);
+               }
+             }
            }
          }
          {
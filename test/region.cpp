@@ -64,6 +64,54 @@ namespace Test {
 
   Region r;
 
+  /// %Test for caching of heap chunks
+  class HeapChunk : public Test::Base {
+  protected:
+    /// Test space
+    class TestSpace : public Gecode::Space {
+    public:
+      /// Constructor for creation
+      TestSpace(void) {}
+      /// Constructor for cloning \a s
+      TestSpace(TestSpace& s) : Space(s) {}
+      /// Copy during cloning
+      virtual Space* copy(void) {
+        return new TestSpace(*this);
+      }
+    };
+    /// How many clones to create
+    static const int n_clones = 64;
+  public:
+    /// Initialize test
+    HeapChunk(void) : Test::Base("HeapChunk") {}
+    /// Perform actual tests
+    bool run(void) {
+      using namespace Gecode;
+      unsigned int l = Kernel::SharedMemory::local_cache();
+      // Without any caching, all requests must go to the heap
+      Kernel::SharedMemory::local_cache(0U);
+      TestSpace* s = new TestSpace;
+      s->chunk_cache(0U);
+      for (int i=n_clones; i--; )
+        delete s->clone();
+      Kernel::HeapChunkStatistics a = s->chunk_statistics();
+      if ((a.local != 0UL) || (a.pool != 0UL) || (a.miss < n_clones))
+        return false;
+      // With caching, all but the first request can be served from caches
+      Kernel::SharedMemory::local_cache(1U);
+      s->chunk_cache(1U);
+      for (int i=n_clones; i--; )
+        delete s->clone();
+      Kernel::HeapChunkStatistics b = s->chunk_statistics();
+      Kernel::SharedMemory::local_cache(l);
+      delete s;
+      return (b.miss - a.miss <= 1UL) &&
+        (b.local + b.pool >= n_clones - 1UL);
+    }
+  };
+
+  HeapChunk hc;
+
 }
 
 // STATISTICS: test-core
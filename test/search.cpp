@@ -389,16 +389,21 @@ namespace Test {
       unsigned int c_d;
       /// Adaptive recomputation distance
       unsigned int a_d;
+      /// Whether to adapt the commit distance
+      bool c_d_adaptive;
       /// Number of threads
       unsigned int t;
     public:
       /// Initialize test
       DFS(HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
-          unsigned int c_d0, unsigned int a_d0, unsigned int t0)
+          unsigned int c_d0, unsigned int a_d0, unsigned int t0,
+          bool c_d_adaptive0=false)
         : Test("DFS::"+Model::name()+"::"+
                str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
-               str(c_d0)+"::"+str(a_d0)+"::"+str(t0),
-               htb1,htb2,htb3), c_d(c_d0), a_d(a_d0), t(t0) {}
+               str(c_d0)+"::"+str(a_d0)+"::"+str(t0)+
+               (c_d_adaptive0 ? "::Adaptive" : ""),
+               htb1,htb2,htb3), c_d(c_d0), a_d(a_d0),
+          c_d_adaptive(c_d_adaptive0), t(t0) {}
       /// Run test
       virtual bool run(void) {
         Model* m = new Model(htb1,htb2,htb3);
@@ -406,6 +411,7 @@ namespace Test {
         Gecode::Search::Options o;
         o.c_d = c_d;
         o.a_d = a_d;
+        o.c_d_adaptive = c_d_adaptive;
         o.threads = t;
         o.stop = &f;
         Gecode::DFS<Model> dfs(m,o);
@@ -469,17 +475,22 @@ namespace Test {
       unsigned int c_d;
       /// Adaptive recomputation distance
       unsigned int a_d;
+      /// Whether to adapt the commit distance
+      bool c_d_adaptive;
       /// Number of threads
       unsigned int t;
     public:
       /// Initialize test
       BAB(HowToConstrain htc,
           HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
-          unsigned int c_d0, unsigned int a_d0, unsigned int t0)
+          unsigned int c_d0, unsigned int a_d0, unsigned int t0,
+          bool c_d_adaptive0=false)
         : Test("BAB::"+Model::name()+"::"+str(htc)+"::"+
                str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
-               str(c_d0)+"::"+str(a_d0)+"::"+str(t0),
-               htb1,htb2,htb3,htc), c_d(c_d0), a_d(a_d0), t(t0) {}
+               str(c_d0)+"::"+str(a_d0)+"::"+str(t0)+
+               (c_d_adaptive0 ? "::Adaptive" : ""),
+               htb1,htb2,htb3,htc), c_d(c_d0), a_d(a_d0),
+          c_d_adaptive(c_d_adaptive0), t(t0) {}
       /// Run test
       virtual bool run(void) {
         Model* m = new Model(htb1,htb2,htb3,htc);
@@ -487,6 +498,7 @@ namespace Test {
         Gecode::Search::Options o;
         o.c_d = c_d;
         o.a_d = a_d;
+        o.c_d_adaptive = c_d_adaptive;
         o.threads = t;
         o.stop = &f;
         Gecode::BAB<Model> bab(m,o);
@@ -543,6 +555,87 @@ namespace Test {
       }
     };
 
+    /// Space with a pigeonhole subproblem explored before its only solutions
+    class Pigeons : public TestSpace {
+    public:
+      /// Whether the pigeonhole subproblem can be avoided
+      BoolVar e;
+      /// Pigeons
+      IntVarArray x;
+      /// Constructor for space creation with \a n pigeons
+      Pigeons(int n, bool escape)
+        : e(*this,0,escape ? 1 : 0), x(*this,n,0,n-1) {
+        // Without escape, n pigeons are placed in n-1 holes
+        for (int i=0; i<n; i++)
+          rel(*this, x[i], IRT_LQ, n-2, Reify(e,RM_PMI));
+        distinct(*this, x, IPL_VAL);
+        rel(*this, x[0], IRT_LE, x[n-1]);
+        Gecode::branch(*this, e, BOOL_VAL_MIN());
+        Gecode::branch(*this, x, INT_VAR_NONE(), INT_VAL_MIN());
+      }
+      /// Constructor for cloning \a s
+      Pigeons(Pigeons& s) : TestSpace(s) {
+        e.update(*this, s.e);
+        x.update(*this, s.x);
+      }
+      /// Copy during cloning
+      virtual Space* copy(void) {
+        return new Pigeons(*this);
+      }
+      /// Add constraint for next better solution
+      virtual void constrain(const Space&) {
+      }
+      /// Return number of solutions
+      virtual int solutions(void) const {
+        return 0;
+      }
+      /// Verify that this is best solution
+      virtual bool best(void) const {
+        return false;
+      }
+    };
+
+    /// %Test for no-goods of parallel restart-based search
+    class RBSNoGoods : public Test {
+    private:
+      /// Whether the model has solutions
+      bool sol;
+      /// Number of threads
+      unsigned int t;
+    public:
+      /// Initialize test
+      RBSNoGoods(bool s0, unsigned int t0)
+        : Test(std::string("RBS::NoGoods::")+(s0 ? "Sol" : "Fail")+
+               "::"+str(t0),HTB_BINARY,HTB_BINARY,HTB_BINARY),
+          sol(s0), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        Pigeons* m = new Pigeons(6,sol);
+        // Guard against restarts that make no progress
+        Gecode::Search::FailStop f(100000);
+        Gecode::Search::Options o;
+        o.threads = t;
+        o.stop = &f;
+        o.nogoods_limit = 128;
+        // Each restart proves only a small part of the subproblem
+        o.cutoff = Gecode::Search::Cutoff::constant(4);
+        Gecode::RBS<Pigeons,Gecode::DFS> rbs(m,o);
+        delete m;
+        Pigeons* s = rbs.next();
+        Gecode::Search::Statistics stat = rbs.statistics();
+        bool ok;
+        if (sol) {
+          // No-goods must not remove the solutions
+          ok = (s != nullptr) && (s->e.val() == 1) && s->x.assigned();
+        } else {
+          // Search can only be complete by no-goods from earlier restarts
+          ok = (s == nullptr) && !rbs.stopped();
+        }
+        delete s;
+        return ok && (stat.restart > 0) && (stat.nogood > 0);
+      }
+    };
+
     /// %Test for portfolio-based search
     template<class Model, template<class> class Engine>
     class PBS : public Test {
@@ -728,6 +821,114 @@ namespace Test {
       {HTC_LEX_LE, HTC_LEX_GR, HTC_BAL_LE, HTC_BAL_GR};
 
 
+    /// %Test for clone statistics of search engines
+    class CloneStats : public Test {
+    private:
+      /// Number of threads
+      unsigned int t;
+    public:
+      /// Initialize test
+      CloneStats(unsigned int t0)
+        : Test("Clone::Statistics::"+str(t0),
+               HTB_BINARY,HTB_BINARY,HTB_BINARY), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        HasSolutions* m = new HasSolutions(htb1,htb2,htb3);
+        (void) m->status();
+        // A single clone copies all propagators and branchers
+        Gecode::CloneStatistics cs;
+        Space* c = m->clone(cs);
+        delete c;
+        unsigned long long int n_a =
+          PropagatorGroup::all.size(*m) + BrancherGroup::all.size(*m);
+        if ((cs.actors != n_a) || (cs.copied == 0ULL))
+          return false;
+        cs.reset();
+        if ((cs.actors != 0ULL) || (cs.copied != 0ULL))
+          return false;
+        // Search engines accumulate the statistics of their clones
+        for (unsigned int c_d : {1U, 8U}) {
+          Gecode::Search::Options o;
+          o.c_d = c_d;
+          o.a_d = c_d;
+          o.threads = t;
+          Gecode::DFS<HasSolutions> dfs(m,o);
+          int n = m->solutions();
+          while (HasSolutions* s = dfs.next()) {
+            n--; delete s;
+          }
+          Gecode::Search::Statistics stat = dfs.statistics();
+          if ((n != 0) || (stat.actors == 0ULL) || (stat.copied == 0ULL))
+            return false;
+          stat.reset();
+          if ((stat.actors != 0ULL) || (stat.copied != 0ULL))
+            return false;
+        }
+        delete m;
+        return true;
+      }
+    };
+
+    /// %Test for scheduling policies of propagators
+    class Schedule : public Test {
+    private:
+      /// Scheduling policy
+      Gecode::SchedulePolicy sp;
+      /// Number of threads
+      unsigned int t;
+      /// Map scheduling policy to string
+      static std::string str(Gecode::SchedulePolicy sp) {
+        switch (sp) {
+        case Gecode::SP_FIFO: return "FIFO";
+        case Gecode::SP_LIFO: return "LIFO";
+        case Gecode::SP_AFC:  return "AFC";
+        default: GECODE_NEVER;
+        }
+        return "";
+      }
+    public:
+      /// Initialize test
+      Schedule(Gecode::SchedulePolicy sp0, unsigned int t0)
+        : Test("Schedule::"+str(sp0)+"::"+Test::str(t0),
+               HTB_BINARY,HTB_BINARY,HTB_BINARY), sp(sp0), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        HasSolutions* m = new HasSolutions(htb1,htb2,htb3);
+        m->schedule(sp);
+        // Clones inherit the policy
+        (void) m->status();
+        Space* c = m->clone();
+        bool ok = (c->schedule() == sp);
+        delete c;
+        Gecode::Search::Options o;
+        o.threads = t;
+        Gecode::DFS<HasSolutions> dfs(m,o);
+        int n = m->solutions();
+        delete m;
+        while (HasSolutions* s = dfs.next()) {
+          ok = ok && (s->schedule() == sp);
+          n--; delete s;
+        }
+        // Propagation does not depend on the policy
+        for (int e=0; e<2; e++) {
+          Pigeons* p = new Pigeons(5,e != 0);
+          p->schedule(sp);
+          Gecode::DFS<Pigeons> pdfs(p,o);
+          delete p;
+          Pigeons* s = pdfs.next();
+          ok = ok && ((s != nullptr) == (e != 0)) &&
+            ((s == nullptr) || (s->schedule() == sp));
+          if ((s != nullptr) && (t == 1)) {
+            // First solution in search order
+            for (int i=0; i<s->x.size(); i++)
+              ok = ok && (s->x[i].val() == i);
+          }
+          delete s;
+        }
+        return ok && (n == 0);
+      }
+    };
+
     /// Help class to create and register tests
     class Create {
     public:
@@ -750,6 +951,23 @@ namespace Test {
                                     c_d, a_d, t);
             }
 
+        // Depth-first search with adaptive commit distance
+        for (unsigned int t = 1; t<=4; t++)
+          for (unsigned int c_d = 1; c_d<10; c_d += 4)
+            for (BranchTypes htb1; htb1(); ++htb1)
+              (void) new DFS<HasSolutions>
+                (htb1.htb(),HTB_BINARY,HTB_BINARY,c_d,2,t,true);
+
+        // Clone statistics
+        for (unsigned int t = 1; t<=2; t++)
+          (void) new CloneStats(t);
+
+        // Scheduling policies
+        for (unsigned int t = 1; t<=2; t++)
+          for (Gecode::SchedulePolicy sp :
+                 {Gecode::SP_FIFO, Gecode::SP_LIFO, Gecode::SP_AFC})
+            (void) new Schedule(sp,t);
+
         // Limited discrepancy search
         for (unsigned int t = 1; t<=4; t++) {
           for (BranchTypes htb1; htb1(); ++htb1)
@@ -780,6 +998,12 @@ namespace Test {
               (void) new BAB<HasSolutions>
                 (HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d,a_d,t);
             }
+        // Best solution search with adaptive commit distance
+        for (unsigned int t = 1; t<=4; t++)
+          for (unsigned int c_d = 1; c_d<10; c_d += 4)
+            for (ConstrainTypes htc; htc(); ++htc)
+              (void) new BAB<HasSolutions>
+                (htc.htc(),HTB_BINARY,HTB_BINARY,HTB_BINARY,c_d,2,t,true);
         // Restart-based search
         for (unsigned int t=1; t<=4; t++) {
           (void) new RBS<HasSolutions,Gecode::DFS>("DFS",t);
@@ -792,6 +1016,11 @@ namespace Test {
           (void) new RBS<SolveImmediate,Gecode::LDS>("LDS",t);
           (void) new RBS<SolveImmediate,Gecode::BAB>("BAB",t);
         }
+        // No-goods from all workers
+        for (unsigned int t=1; t<=4; t++) {
+          (void) new RBSNoGoods(false,t);
+          (void) new RBSNoGoods(true,t);
+        }
         // Portfolio-based search
         for (unsigned int a=1; a<=4; a++)
           for (unsigned int t=1; t<=2*a; t++) {
@@ -0,0 +1,180 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.dev
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/*
+ * Throughput of the line and the binary protocol for executable blackboxes
+ *
+ * Usage: gecode-bench-blackbox [calls [inputs [batch]]]
+ *
+ * Starts this program again as a local echo server (with the argument
+ * "serve") and measures the number of evaluations per second for the
+ * line protocol, for binary framing with one call per exchange, and for
+ * binary framing with batches of calls.
+ *
+ */
+
+#include <gecode/flatzinc/blackbox-backend.hh>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+using namespace Gecode;
+using namespace Gecode::FlatZinc;
+
+/// Read one little-endian word from standard input
+bool
+read_word(uint64_t& w) {
+  unsigned char b[8];
+  if (!std::cin.read(reinterpret_cast<char*>(b), sizeof(b)))
+    return false;
+  w = 0;
+  for (int i=0; i<8; i++)
+    w |= static_cast<uint64_t>(b[i]) << (8*i);
+  return true;
+}
+
+/// Echo server: outputs are the inputs of each call
+int
+serve(void) {
+#ifdef _WIN32
+  (void) _setmode(_fileno(stdin), _O_BINARY);
+  (void) _setmode(_fileno(stdout), _O_BINARY);
+#endif
+  std::ios::sync_with_stdio(false);
+  std::string line;
+  while (std::getline(std::cin, line)) {
+    std::cout << line << '\n' << std::flush;
+    if (line + '\n' != blackbox_binary_handshake)
+      continue;
+    uint64_t n;
+    std::vector<char> frame;
+    while (read_word(n)) {
+      frame.clear();
+      for (uint64_t c=0; c<2*n; c++) {
+        uint64_t m;
+        if (!read_word(m))
+          return 1;
+        size_t s = frame.size();
+        frame.resize(s + 8*(m+1));
+        for (int i=0; i<8; i++)
+          frame[s+i] = static_cast<char>((m >> (8*i)) & 0xff);
+        if (!std::cin.read(&frame[s+8], static_cast<std::streamsize>(8*m)))
+          return 1;
+      }
+      std::cout.write(frame.data(), static_cast<std::streamsize>(frame.size()));
+      std::cout.flush();
+    }
+    return 0;
+  }
+  return 0;
+}
+
+/// Run \a calls evaluations in batches of \a batch and return the time in ms
+double
+measure(BlackBoxExec& bb, int calls, int inputs, int batch) {
+  std::vector<std::vector<int64_t> > ii(batch), io(batch);
+  std::vector<std::vector<double> > fi(batch), fo(batch);
+  std::vector<BlackBoxCall> c;
+  for (int b=0; b<batch; b++) {
+    ii[b].resize(inputs); io[b].resize(inputs);
+    fi[b].resize(inputs); fo[b].resize(inputs);
+    c.push_back({ii[b], fi[b], io[b], fo[b]});
+  }
+  Support::Timer timer;
+  timer.start();
+  for (int i=0; i<calls; i += batch) {
+    int n = std::min(batch, calls - i);
+    for (int b=0; b<n; b++)
+      for (int j=0; j<inputs; j++) {
+        ii[b][j] = i + b - j;
+        fi[b][j] = 0.25 * (i + b + j);
+      }
+    bb.run(c.data(), static_cast<size_t>(n));
+    for (int b=0; b<n; b++)
+      if ((io[b] != ii[b]) || (fo[b] != fi[b])) {
+        std::cerr << "Wrong echo for call " << (i+b) << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+  }
+  return timer.stop();
+}
+
+int
+main(int argc, char* argv[]) {
+  if ((argc > 1) && (std::string(argv[1]) == "serve"))
+    return serve();
+  int calls = (argc > 1) ? std::atoi(argv[1]) : 20000;
+  int inputs = (argc > 2) ? std::atoi(argv[2]) : 8;
+  int batch = (argc > 3) ? std::atoi(argv[3]) : 64;
+  if ((calls < 1) || (inputs < 0) || (batch < 1)) {
+    std::cerr << "Usage: " << argv[0] << " [calls [inputs [batch]]]"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << "Calls: " << calls << ", integer and float inputs: "
+            << inputs << ", batch: " << batch << std::endl;
+
+  const char* name[] = {"line", "binary", "batched"};
+  double line = 0.0;
+  try {
+    for (int p=0; p<3; p++) {
+      BlackBoxExec bb(argv[0], {"serve"});
+      bb.binary(p > 0);
+      double ms = measure(bb, calls, inputs, (p == 2) ? batch : 1);
+      if (p == 0)
+        line = ms;
+      std::cout << std::setw(8) << name[p] << ": "
+                << std::fixed << std::setprecision(2) << ms << " ms, "
+                << (1000.0 * calls / ms) << " calls/s";
+      if (p > 0)
+        std::cout << ", speedup " << (line / ms);
+      std::cout << std::endl;
+    }
+  } catch (Error& e) {
+    std::cerr << "Error: " << e.toString() << std::endl;
+    return EXIT_FAILURE;
+  }
+  return 0;
+}
+
+// STATISTICS: test-any
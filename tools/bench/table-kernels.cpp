@@ -0,0 +1,141 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.dev
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/*
+ * Microbenchmark for the word kernels of the compact-table propagators
+ *
+ * Usage: gecode-bench-table [tuples [arity [domain [nodes [seed]]]]]
+ *
+ * Posts a positive and a negative table constraint over a random
+ * tuple set and explores a fixed number of search nodes, once for
+ * each instruction set supported by the processor.
+ *
+ */
+
+#include <gecode/int.hh>
+#include <gecode/search.hh>
+#include <gecode/int/extensional.hh>
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+
+using namespace Gecode;
+
+/// Model with a positive and a negative table constraint
+class Table : public Space {
+protected:
+  /// The variables
+  IntVarArray x;
+public:
+  /// Post constraints
+  Table(const TupleSet& ts, const TupleSet& nts, int n)
+    : x(*this,ts.arity(),0,n-1) {
+    extensional(*this, x, ts);
+    extensional(*this, x, nts, false);
+    branch(*this, x, INT_VAR_SIZE_MIN(), INT_VAL_SPLIT_MIN());
+  }
+  /// Constructor for cloning
+  Table(Table& s) : Space(s) {
+    x.update(*this, s.x);
+  }
+  /// Perform copying
+  virtual Space* copy(void) {
+    return new Table(*this);
+  }
+};
+
+/// Return a random tuple set
+TupleSet
+random(Rnd& r, int t, int a, int n) {
+  TupleSet ts(a);
+  IntArgs tuple(a);
+  for (int i=0; i<t; i++) {
+    for (int j=0; j<a; j++)
+      tuple[j] = static_cast<int>(r(static_cast<unsigned int>(n)));
+    ts.add(tuple);
+  }
+  ts.finalize();
+  return ts;
+}
+
+int
+main(int argc, char* argv[]) {
+  int t = (argc > 1) ? std::atoi(argv[1]) : 500000;
+  int a = (argc > 2) ? std::atoi(argv[2]) : 4;
+  int n = (argc > 3) ? std::atoi(argv[3]) : 40;
+  unsigned long long int l =
+    (argc > 4) ? std::strtoull(argv[4],nullptr,10) : 2000ULL;
+  unsigned int seed =
+    (argc > 5) ? static_cast<unsigned int>(std::atoi(argv[5])) : 1U;
+
+  Rnd r(seed);
+  TupleSet ts = random(r,t,a,n);
+  TupleSet nts = random(r,t/4,a,n);
+  std::cout << "Tuples: " << ts.tuples() << ", words: " << ts.words()
+            << ", arity: " << a << ", domain: " << n
+            << ", nodes: " << l << std::endl;
+
+  using namespace Int::Extensional;
+  const char* name[] = {"scalar", "avx2", "avx512"};
+  double scalar = 0.0;
+  WordKernel best = word_kernel(WK_AVX512);
+  for (int k=WK_SCALAR; k<=best; k++) {
+    WordKernel wk = word_kernel(static_cast<WordKernel>(k));
+    Table* s = new Table(ts,nts,n);
+    Search::Options o;
+    o.stop = Search::Stop::node(l);
+    Support::Timer timer;
+    timer.start();
+    DFS<Table> e(s,o);
+    delete s;
+    unsigned long int sols = 0;
+    while (Table* sol = e.next()) {
+      sols++; delete sol;
+    }
+    double ms = timer.stop();
+    delete o.stop;
+    if (wk == WK_SCALAR)
+      scalar = ms;
+    std::cout << std::setw(8) << name[wk] << ": "
+              << std::fixed << std::setprecision(2) << ms << " ms, "
+              << e.statistics().node << " nodes, "
+              << sols << " solutions";
+    if (wk != WK_SCALAR)
+      std::cout << ", speedup " << (scalar / ms);
+    std::cout << std::endl;
+  }
+  return 0;
+}
+
+// STATISTICS: test-any
@@ -59,9 +59,11 @@ int main(int argc, char** argv) {
   Rnd rnd(opt.seed());
   try {
     if (!strcmp(filename, "-")) {
-      fg = FlatZinc::parse(cin, p, std::cerr, nullptr, rnd);
+      fg = new FlatZinc::FlatZincSpace(rnd);
+      fg->clauseIpl = opt.clause_learning() ? IPL_ADVANCED : IPL_DEF;
+      fg = FlatZinc::parse(cin, p, std::cerr, fg, rnd);
     } else {
-      fg = FlatZinc::parse(filename, p, std::cerr, nullptr, rnd);
+      fg = FlatZinc::parse(filename, opt, p, std::cerr, nullptr, rnd);
     }
 
     if (fg) {